@@ -6,6 +6,7 @@
  *************************************************************************************************/
 #pragma once
 #include <string>
+#include <string_view>
 // #include "utils_logger.h"
 /**
  * @enum    ErrorCode
@@ -37,6 +38,7 @@ enum ErrorCode
     Error_IDOI_FileWritePointerNull =   5001,   //    写入文件指针为空
     Error_IDOI_FileVerifyError      =   5002,   // 读取文件头校验失败
     Error_IDOI_File_Write = 5003,    // IDOI 写文件指针错误
+    Error_IDOI_RecordVerifyError    =   5004,   // IDOI 记录越界或校验失败
 
     Error_Image_Resize_Crash =  3001,   // 图片缩放错误
     Error_Image_Resize_Crash_OnLabel = 3002,  // 在显示过程中的缩放出错
@@ -80,7 +82,7 @@ class Utils_Exception : public std::exception
     std::string ms_ErrorMsg_;  ///< 错误消息
 
     /**
-     * @fn  Utils_Exception::Utils_Exception(int num = 100, std::string str = "Unknown exception")
+     * @fn  Utils_Exception::Utils_Exception(int num = 100, std::string_view str = "Unknown exception")
      *
      * @brief   初始对象生成 默认会出现  位置错误 对于错误异常 直接处理结果
      *
@@ -90,12 +92,26 @@ class Utils_Exception : public std::exception
      * @param   num (Optional) Number of
      * @param   str (Optional) The string
      */
-    Utils_Exception(int num = 100, std::string str = "Unknown exception")
+    Utils_Exception(int num = 100, std::string_view str = "Unknown exception")
+        : mi_ErrorCode_(num), ms_ErrorMsg_(str)
     {
         // LOG(INFO) << "错误代码:" << err_num << ":" << err_str;
-        mi_ErrorCode_ = num;
-        ms_ErrorMsg_ = str;
         // log出异常
         LError("Exception occur:\t Code:{}\tMess:{}", mi_ErrorCode_, ms_ErrorMsg_);
     }
+
+    /**
+     * @fn  const char *Utils_Exception::what() const noexcept override
+     *
+     * @brief   错误消息  与异常对象的生命周期相同
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @return  A pointer to a const char
+     */
+    const char *what() const noexcept override
+    {
+        return ms_ErrorMsg_.c_str();
+    }
 };
@@ -0,0 +1,99 @@
+/**
+ * @file    Code\utils\bench_utils_binary.cc.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   二进制写入 速度测试  Utils_Files::WriteData (每个值一次 fstream::write) 对比 Utils_BinaryWriter
+ *          * 参数 值的个数 (默认 4M) 输出文件 (默认临时目录)
+ *          * 每项写入 count 个 uint32 + count 个 double, 以及 count / 16 个 32 字节定长字符串
+ *          * 时间包含关闭文件, 不包含 fsync
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#include "./utils_binary.h"
+#include "./utils_files.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+static double Seconds(std::chrono::steady_clock::time_point t0)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+}
+
+static void Report(const char *name, size_t bytes, double t)
+{
+    printf("%-28s: %8.1f MB %8.3f s %10.1f MB/s\n", name, bytes / 1e6, t, bytes / 1e6 / t);
+}
+
+int main(int argc, char **argv)
+{
+    const size_t count = argc > 1 ? static_cast<size_t>(atoll(argv[1])) : (size_t(4) << 20);
+    const std::string file = argc > 2 ? argv[2] : (std::filesystem::temp_directory_path() / "bench_utils_binary.bin").string();
+
+    std::vector<uint32_t> u32(count);
+    std::vector<double> f64(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        u32[i] = static_cast<uint32_t>(i * 2654435761u);
+        f64[i] = static_cast<double>(i) * 0.5;
+    }
+    const std::string name = "camera_0001";
+    const size_t strings = count / 16;
+    const size_t bytes = count * (sizeof(uint32_t) + sizeof(double)) + strings * 32;
+
+    // fstream  每个值一次 write
+    auto t0 = std::chrono::steady_clock::now();
+    {
+        std::fstream out(file, std::ios::out | std::ios::binary | std::ios::trunc);
+        for (size_t i = 0; i < count; i++)
+        {
+            Utils_Files::WriteData(&out, u32[i]);
+            Utils_Files::WriteData(&out, f64[i]);
+        }
+        for (size_t i = 0; i < strings; i++)
+            Utils_Files::WriteStringBinary(&out, name, 32);
+    }
+    Report("fstream WriteData", bytes, Seconds(t0));
+
+    for (Utils_Endian endian : { Utils_Endian::kLittle, Utils_Endian::kBig })
+    {
+        const bool le = endian == Utils_Endian::kLittle;
+        Utils_BinaryWriter::Options opt;
+        opt.endian = endian;
+
+        // 每个值一次 Put
+        t0 = std::chrono::steady_clock::now();
+        {
+            Utils_BinaryWriter w;
+            w.Open(file, opt);
+            for (size_t i = 0; i < count; i++)
+            {
+                w.Put(u32[i]);
+                w.Put(f64[i]);
+            }
+            for (size_t i = 0; i < strings; i++)
+                w.PutString(name, 32);
+        }
+        Report(le ? "writer Put little" : "writer Put big", bytes, Seconds(t0));
+
+        // 整个数组
+        t0 = std::chrono::steady_clock::now();
+        {
+            Utils_BinaryWriter w;
+            w.Open(file, opt);
+            w.PutArray(u32);
+            w.PutArray(f64);
+            for (size_t i = 0; i < strings; i++)
+                w.PutString(name, 32);
+        }
+        Report(le ? "writer PutArray little" : "writer PutArray big", bytes, Seconds(t0));
+    }
+
+    std::remove(file.c_str());
+    return 0;
+}
@@ -0,0 +1,104 @@
+/**
+ * @file    Code\utils\bench_utils_csv.cc.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   CSV 读写 吞吐量测试  生成测量日志格式的文件 (时间, 传感器, 6 个浮点数, 少量带引号的备注)
+ *          * 输出 写入 / 单线程解析 / 多线程解析 / fstream + getline + Str2Vec 的 MB/s
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#include "./utils_csv.h"
+#include "./utils_string.h"
+
+#include <chrono>
+#include <fstream>
+#include <random>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+static double Seconds(std::chrono::steady_clock::time_point t0)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+}
+
+int main(int argc, char **argv)
+{
+    size_t mb = argc > 1 ? static_cast<size_t>(atoi(argv[1])) : 256;
+    int threads = argc > 2 ? atoi(argv[2]) : static_cast<int>(std::thread::hardware_concurrency());
+    const char *file = argc > 3 ? argv[3] : "bench_utils_csv.tmp.csv";
+
+    // 1. 写入
+    Utils_Csv::Options opt;
+    opt.header = true;
+    std::mt19937 rng(2019);
+    std::uniform_real_distribution<double> dist(-100.0, 100.0);
+    auto t0 = std::chrono::steady_clock::now();
+    size_t rows = 0;
+    {
+        Utils_CsvWriter writer(opt, 4 << 20);
+        if (!writer.Open(file))
+        {
+            printf("open %s failed\n", file);
+            return 1;
+        }
+        writer.Row("time", "sensor", "ax", "ay", "az", "gx", "gy", "gz", "note");
+        char sensor[16];
+        for (size_t bytes = 0; bytes < (mb << 20); rows++)
+        {
+            snprintf(sensor, sizeof(sensor), "imu_%02d", static_cast<int>(rows % 8));
+            writer.Row(rows, sensor, dist(rng), dist(rng), dist(rng), dist(rng), dist(rng), dist(rng),
+                       rows % 1000 == 0 ? "resync, \"frame lost\"" : "");
+            bytes += 120;
+        }
+        writer.Close();
+    }
+    double t_write = Seconds(t0);
+
+    Utils_CsvReader reader(opt);
+    if (!reader.Open(file))
+        return 1;
+    FILE *fp = fopen(file, "rb");
+    fseek(fp, 0, SEEK_END);
+    double size_mb = ftell(fp) / double(1 << 20);
+    fclose(fp);
+
+    // 2. 单线程
+    int col = reader.Column("az");
+    double sum = 0;
+    t0 = std::chrono::steady_clock::now();
+    size_t n1 = reader.ForEach([&](const Utils_CsvRow &row) { sum += row.GetOr(col, 0.0); });
+    double t_serial = Seconds(t0);
+
+    // 3. 多线程  每个线程单独累加
+    std::vector<double> part(static_cast<size_t>(threads > 0 ? threads : 1) + 64, 0.0);
+    t0 = std::chrono::steady_clock::now();
+    size_t n2 = reader.ForEachParallel([&](const Utils_CsvRow &row, int worker) {
+        part[worker] += row.GetOr(col, 0.0);
+    }, threads);
+    double t_parallel = Seconds(t0);
+
+    // 4. 原来的方式 getline + Str2Vec
+    t0 = std::chrono::steady_clock::now();
+    std::ifstream in(file);
+    std::string line;
+    size_t n3 = 0;
+    double sum3 = 0;
+    std::getline(in, line);
+    while (std::getline(in, line))
+    {
+        std::vector<std::string> f = Utils_String::Str2Vec(line, ',', false);
+        if (f.size() > 4)
+            sum3 += atof(f[4].c_str());
+        n3++;
+    }
+    double t_old = Seconds(t0);
+
+    printf("file     : %.1f MB  %zu rows\n", size_mb, rows);
+    printf("write    : %8.1f MB/s\n", size_mb / t_write);
+    printf("serial   : %8.1f MB/s  rows %zu\n", size_mb / t_serial, n1);
+    printf("parallel : %8.1f MB/s  rows %zu  threads %d\n", size_mb / t_parallel, n2, threads);
+    printf("getline  : %8.1f MB/s  rows %zu  (%.3f %.3f)\n", size_mb / t_old, n3, sum, sum3);
+    remove(file);
+    return 0;
+}
@@ -0,0 +1,101 @@
+/**
+ * @file    Code\utils\bench_utils_encoding.cc.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   编码转换 吞吐量测试  三种语料: 纯 ASCII 日志, 中文为主的文本, 中英混合的路径和日志
+ *          * 输出每种操作的 MB/s (按输入字节计算), 并与逐字节的 UTF-8 校验对比
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#include "./utils_encoding.h"
+
+#include <chrono>
+#include <random>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// 逐字节的参考实现 用于对比 ASCII 快速路径的收益
+static bool NaiveIsUtf8(const std::string &s)
+{
+    const unsigned char *p = reinterpret_cast<const unsigned char *>(s.data());
+    const unsigned char *end = p + s.size();
+    while (p < end)
+    {
+        unsigned c = *p;
+        int n = c < 0x80 ? 1 : c < 0xC2 ? 0 : c < 0xE0 ? 2 : c < 0xF0 ? 3 : c < 0xF5 ? 4 : 0;
+        if (n == 0 || end - p < n)
+            return false;
+        for (int i = 1; i < n; i++)
+            if ((p[i] & 0xC0) != 0x80)
+                return false;
+        p += n;
+    }
+    return true;
+}
+
+static std::string MakeCorpus(const std::vector<std::string> &words, size_t bytes, std::mt19937 &rng)
+{
+    std::string s;
+    s.reserve(bytes + 64);
+    while (s.size() < bytes)
+        s += words[rng() % words.size()];
+    return s;
+}
+
+template<typename Fn>
+static double Run(size_t bytes, int rounds, Fn &&fn)
+{
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; i++)
+        fn();
+    auto t1 = std::chrono::steady_clock::now();
+    return bytes * static_cast<double>(rounds) / std::chrono::duration<double>(t1 - t0).count() / (1 << 20);
+}
+
+int main(int argc, char **argv)
+{
+    size_t mb = argc > 1 ? static_cast<size_t>(atoi(argv[1])) : 16;
+    int rounds = argc > 2 ? atoi(argv[2]) : 5;
+    std::mt19937 rng(2019);
+
+    struct Corpus
+    {
+        const char *name;
+        std::string utf8;
+    };
+    std::vector<Corpus> corpora = {
+        { "ascii", MakeCorpus({ "[2019-12-25 10:00:01.123] [info] camera 01 open ok, exposure=1200us\n",
+                                "D:/data/camera_01/image_000123.bmp\n", "frame 42 checksum mismatch, resync\n" },
+                              mb << 20, rng) },
+        { "cjk", MakeCorpus({ "通过最小二乘得到数据的拟合参数，", "相机打开成功，曝光时间一千二百微秒。",
+                              "文件夹不存在，自动创建。", "串口帧校验失败，重新同步帧头。" },
+                            mb << 20, rng) },
+        { "mixed", MakeCorpus({ "D:/数据/相机_01/图像_000123.bmp\n", "[info] 相机 01 打开成功 exposure=1200us\n",
+                                "[warn] 文件夹 logs 不存在, 自动创建\n", "frame 42 校验失败 resync\n" },
+                              mb << 20, rng) },
+    };
+
+    size_t sink = 0;
+    printf("%-6s %10s %10s %10s %10s %10s %10s\n", "corpus", "naive", "IsUtf8", "8->16", "16->8", "8->gbk", "gbk->8");
+    for (const Corpus &c : corpora)
+    {
+        std::u16string wide;
+        std::string narrow, gbk, back;
+        Utils_Encoding::Utf8ToUtf16(c.utf8, wide);
+        Utils_Encoding::Utf8ToGbk(c.utf8, gbk);
+        size_t n = c.utf8.size();
+
+        double naive = Run(n, rounds, [&] { sink += NaiveIsUtf8(c.utf8); });
+        double valid = Run(n, rounds, [&] { sink += Utils_Encoding::IsUtf8(c.utf8); });
+        double to16 = Run(n, rounds, [&] { sink += Utils_Encoding::Utf8ToUtf16(c.utf8, wide); });
+        double to8 = Run(n, rounds, [&] { sink += Utils_Encoding::Utf16ToUtf8(wide, narrow); });
+        double togbk = Run(n, rounds, [&] { sink += Utils_Encoding::Utf8ToGbk(c.utf8, gbk); });
+        double fromgbk = Run(n, rounds, [&] { sink += Utils_Encoding::GbkToUtf8(gbk, back); });
+
+        printf("%-6s %10.0f %10.0f %10.0f %10.0f %10.0f %10.0f  MB/s  %s\n", c.name, naive, valid, to16, to8, togbk, fromgbk,
+               (narrow == c.utf8 && back == c.utf8) ? "roundtrip ok" : "ROUNDTRIP MISMATCH");
+    }
+    printf("(%zu)\n", sink);
+    return 0;
+}
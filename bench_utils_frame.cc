@@ -0,0 +1,84 @@
+/**
+ * @file    Code\utils\bench_utils_frame.cc.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   串口帧解析 吞吐量测试  随机长度的帧 + 注入错误 (比特翻转 垃圾字节 截断帧)
+ *          * 随机大小的分包输入, 输出 MB/s 和 帧/s
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#include "./utils_frame.h"
+
+#include <chrono>
+#include <random>
+#include <cstdio>
+
+int main(int argc, char **argv)
+{
+    size_t total_mb = argc > 1 ? static_cast<size_t>(atoi(argv[1])) : 64;
+    double error_rate = argc > 2 ? atof(argv[2]) : 0.01;
+
+    Utils_FrameDecoder::Config cfg;
+    cfg.len_adjust = 5;         // 帧头 2 + 长度 1 + CRC16 2
+    cfg.check = Utils_FrameDecoder::Check_CRC16;
+
+    // 生成测试数据
+    std::mt19937 rng(2019);
+    std::vector<uchar> stream;
+    stream.reserve(total_mb << 20);
+    size_t sent = 0, injected = 0;
+    uchar frame[300];
+    while (stream.size() < (total_mb << 20))
+    {
+        size_t payload = 4 + rng() % 60;
+        frame[0] = 0xAA;
+        frame[1] = 0x55;
+        frame[2] = static_cast<uchar>(payload);
+        for (size_t i = 0; i < payload; i++)
+            frame[3 + i] = static_cast<uchar>(rng());
+        size_t n = Utils_FrameDecoder::AppendCheck(cfg, frame, 3 + payload);
+
+        if (std::uniform_real_distribution<double>(0, 1)(rng) < error_rate)
+        {
+            injected++;
+            switch (rng() % 3)
+            {
+                case 0: frame[rng() % n] ^= static_cast<uchar>(1 << (rng() % 8)); break;   // 比特翻转
+                case 1: n = 1 + rng() % (n - 1); break;                                     // 截断
+                default:                                                                    // 垃圾字节
+                    for (int i = 0; i < 16; i++)
+                        stream.push_back(static_cast<uchar>(rng()));
+                    break;
+            }
+        }
+        else
+        {
+            sent++;
+        }
+        stream.insert(stream.end(), frame, frame + n);
+    }
+
+    Utils_FrameDecoder decoder(cfg, 1 << 16);
+    size_t frames = 0, checksum = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    size_t off = 0;
+    while (off < stream.size())
+    {
+        size_t chunk = std::min(stream.size() - off, static_cast<size_t>(1 + rng() % 4096));
+        frames += decoder.Feed(stream.data() + off, chunk, [&](const Utils_FrameDecoder::Frame &f) {
+            checksum += f.payload[0];
+        });
+        off += chunk;
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    double sec = std::chrono::duration<double>(t1 - t0).count();
+
+    const Utils_FrameDecoder::Stats &st = decoder.GetStats();
+    printf("bytes        : %zu\n", stream.size());
+    printf("frames clean : %zu  injected errors: %zu\n", sent, injected);
+    printf("frames found : %zu  bad_check: %zu  bad_length: %zu  dropped: %zu\n",
+           frames, st.bad_check, st.bad_length, st.dropped_bytes);
+    printf("throughput   : %.1f MB/s  %.2f Mframes/s  (%zu)\n",
+           stream.size() / sec / (1 << 20), frames / sec / 1e6, checksum & 0xFF);
+    return 0;
+}
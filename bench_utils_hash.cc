@@ -0,0 +1,107 @@
+/**
+ * @file    Code\utils\bench_utils_hash.cc.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   哈希 速度测试  std::hash / Utils_Crc32c 对比 Utils_Hash / Utils_Hasher
+ *          * 第一个参数为内存中数据的 MB 数 (默认 256), 另外输出 16 / 64 字节短键的 Mhash/s
+ *          * 参数为目录时另外对该目录做一次 Utils_Dedup::Find
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#include "./utils_hash.h"
+#include "./utils_record.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+static double Seconds(std::chrono::steady_clock::time_point t0)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+}
+
+static void Report(const char *name, size_t bytes, double t, uint64_t check)
+{
+    printf("%-24s: %8.3f s %10.2f GB/s  (%016llx)\n", name, t, bytes / 1e9 / t, static_cast<unsigned long long>(check));
+}
+
+static void ReportKeys(const char *name, size_t count, double t, uint64_t check)
+{
+    printf("%-24s: %8.3f s %10.1f Mhash/s  (%016llx)\n", name, t, count / 1e6 / t, static_cast<unsigned long long>(check));
+}
+
+int main(int argc, char **argv)
+{
+    const bool dir = argc > 1 && fs::is_directory(argv[1]);
+    const size_t mb = (argc > 1 && !dir) ? static_cast<size_t>(atoll(argv[1])) : 256;
+    std::vector<uint8_t> data(mb << 20);
+    uint32_t seed = 1;
+    for (uint8_t &b : data)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        b = static_cast<uint8_t>(seed >> 24);
+    }
+    const std::string_view view(reinterpret_cast<const char *>(data.data()), data.size());
+
+    auto t0 = std::chrono::steady_clock::now();
+    uint64_t h = std::hash<std::string_view>()(view);
+    Report("std::hash", data.size(), Seconds(t0), h);
+
+    t0 = std::chrono::steady_clock::now();
+    h = Utils_Crc32c::Compute(data.data(), data.size());
+    Report("Utils_Crc32c", data.size(), Seconds(t0), h);
+
+    t0 = std::chrono::steady_clock::now();
+    h = Utils_Hash::Hash64(data.data(), data.size());
+    Report("Utils_Hash::Hash64", data.size(), Seconds(t0), h);
+
+    t0 = std::chrono::steady_clock::now();
+    h = Utils_Hash::Hash128(data.data(), data.size()).low;
+    Report("Utils_Hash::Hash128", data.size(), Seconds(t0), h);
+
+    t0 = std::chrono::steady_clock::now();
+    Utils_Hasher hasher;
+    for (size_t off = 0; off < data.size(); off += 65536)
+        hasher.Update(data.data() + off, std::min<size_t>(65536, data.size() - off));
+    h = hasher.Digest64();
+    Report("Utils_Hasher 64KB", data.size(), Seconds(t0), h);
+
+    // 短键  哈希表的典型用法
+    for (size_t key : { 16, 64 })
+    {
+        const size_t count = data.size() / key;
+        uint64_t sum = 0;
+        t0 = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < count; i++)
+            sum += std::hash<std::string_view>()(view.substr(i * key, key));
+        ReportKeys(key == 16 ? "std::hash 16B" : "std::hash 64B", count, Seconds(t0), sum);
+
+        sum = 0;
+        t0 = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < count; i++)
+            sum += Utils_Hash::Hash64(data.data() + i * key, key);
+        ReportKeys(key == 16 ? "Utils_Hash 16B" : "Utils_Hash 64B", count, Seconds(t0), sum);
+    }
+
+    if (dir)
+    {
+        Utils_Dedup::Options opt;
+        Utils_Dedup::Stats stats;
+        t0 = std::chrono::steady_clock::now();
+        const std::vector<Utils_DuplicateGroup> groups = Utils_Dedup::Find({ argv[1] }, opt, &stats);
+        const double t = Seconds(t0);
+        uint64_t wasted = 0;
+        for (const Utils_DuplicateGroup &g : groups)
+            wasted += g.size * (g.files.size() - 1);
+        printf("Utils_Dedup::Find       : %8.3f s %zu files, %zu edge hashed, %zu full hashed, %zu groups, %.1f MB duplicated\n",
+               t, stats.files, stats.edge_hashed, stats.full_hashed, groups.size(), wasted / 1e6);
+    }
+    return 0;
+}
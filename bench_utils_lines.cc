@@ -0,0 +1,115 @@
+/**
+ * @file    Code\utils\bench_utils_lines.cc.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   按行读取 速度测试  std::getline 对比 Utils_LineReader / Utils_Lines::ForEachLine / CountLines
+ *          * 参数为文件时读取该文件, 否则生成 MB 数 (默认 512) 的日志样式文本
+ *          * 第一遍预热系统缓存, 冷缓存需要先清空系统缓存 (echo 3 > /proc/sys/vm/drop_caches)
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#include "./utils_lines.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+
+namespace fs = std::filesystem;
+
+static double Seconds(std::chrono::steady_clock::time_point t0)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+}
+
+static void Report(const char *name, size_t lines, size_t bytes, double t)
+{
+    printf("%-24s: %12zu lines %8.3f s %10.1f MB/s %8.1f Mlines/s\n", name, lines, t, bytes / 1e6 / t, lines / 1e6 / t);
+}
+
+int main(int argc, char **argv)
+{
+    std::string file;
+    bool generated = false;
+    if (argc > 1 && fs::is_regular_file(argv[1]))
+    {
+        file = argv[1];
+    }
+    else
+    {
+        const size_t mb = argc > 1 ? static_cast<size_t>(atoll(argv[1])) : 512;
+        file = (fs::temp_directory_path() / "bench_utils_lines.log").string();
+        std::ofstream out(file, std::ios::binary);
+        std::string line;
+        for (size_t i = 0, bytes = 0; bytes < (mb << 20); i++)
+        {
+            line = "[2026-10-19 12:00:00." + std::to_string(i % 1000) + "] [info] camera " + std::to_string(i % 8) +
+                " frame " + std::to_string(i) + " exposure " + std::to_string(i % 977) + " us" +
+                std::string(i % 61, '.') + "\n";
+            out << line;
+            bytes += line.size();
+        }
+        generated = true;
+    }
+    const size_t bytes = static_cast<size_t>(fs::file_size(file));
+
+    // std::getline  同时用作预热
+    auto t0 = std::chrono::steady_clock::now();
+    size_t lines = 0, chars = 0;
+    {
+        std::ifstream in(file, std::ios::binary);
+        for (std::string line; std::getline(in, line);)
+        {
+            lines++;
+            chars += line.size();
+        }
+    }
+    Report("std::getline", lines, bytes, Seconds(t0));
+
+    t0 = std::chrono::steady_clock::now();
+    size_t n = 0, c = 0;
+    {
+        Utils_LineReader reader;
+        reader.Open(file);
+        for (std::string_view line; reader.Next(line);)
+        {
+            n++;
+            c += line.size();
+        }
+    }
+    Report("LineReader", n, bytes, Seconds(t0));
+    if (n != lines)
+        printf("line count mismatch %zu != %zu\n", n, lines);
+
+    const int hw = static_cast<int>(std::thread::hardware_concurrency());
+    for (int threads : { 1, 2, 4, hw })
+    {
+        if (threads <= 0)
+            continue;
+        std::atomic<size_t> total(0);
+        t0 = std::chrono::steady_clock::now();
+        Utils_Lines::ForEachLine(file, [&](std::string_view line) { total.fetch_add(line.size(), std::memory_order_relaxed); }, threads);
+        char name[32];
+        snprintf(name, sizeof(name), "ForEachLine x%d", threads);
+        Report(name, lines, bytes, Seconds(t0));
+    }
+
+    for (int threads : { 1, hw })
+    {
+        if (threads <= 0)
+            continue;
+        t0 = std::chrono::steady_clock::now();
+        Utils_Lines::CountLines(file, n, threads);
+        char name[32];
+        snprintf(name, sizeof(name), "CountLines x%d", threads);
+        Report(name, n, bytes, Seconds(t0));
+    }
+
+    if (generated)
+        fs::remove(file);
+    return c == chars ? 0 : 1;
+}
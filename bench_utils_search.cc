@@ -0,0 +1,118 @@
+/**
+ * @file    Code\utils\bench_utils_search.cc.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   多模式查找 吞吐量测试  生成 spdlog 格式的日志, 少量行带 Utils_Exception 的错误代码
+ *          * 模式为 ErrorCode 中全部错误代码 以及常见的错误关键字
+ *          * 输出 自动机单线程 / 多线程 / 逐个模式 string_view::find 的 MB/s
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#include "./utils_search.h"
+#include "./utils_mmap.h"
+
+#include <chrono>
+#include <random>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+static double Seconds(std::chrono::steady_clock::time_point t0)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+}
+
+int main(int argc, char **argv)
+{
+    size_t mb = argc > 1 ? static_cast<size_t>(atoi(argv[1])) : 256;
+    int threads = argc > 2 ? atoi(argv[2]) : static_cast<int>(std::thread::hardware_concurrency());
+    const char *file = argc > 3 ? argv[3] : "bench_utils_search.tmp.log";
+
+    const int codes[] = { 1000, 1001, 5000, 5001, 5002, 5003, 3001, 3002, 4002, 4003, 4004, 6001 };
+    std::vector<std::string> pats;
+    for (int c : codes)
+        pats.push_back("Code:" + std::to_string(c));
+    for (const char *s : { "[error]", "[critical]", "Exception occur", "timeout", "checksum mismatch",
+                           "open failed", "resync", "frame lost" })
+        pats.push_back(s);
+
+    // 1. 生成日志
+    {
+        std::mt19937 rng(2019);
+        const char *normal[] = { "[info] camera 01 grab ok, exposure=1200us gain=3.5",
+                                 "[debug] serial rx 64 bytes, queue=12",
+                                 "[info] save D:/data/camera_01/image_000123.bmp",
+                                 "[warn] fps drop 29.7 -> 24.1" };
+        FILE *fp = fopen(file, "wb");
+        if (fp == nullptr)
+        {
+            printf("open %s failed\n", file);
+            return 1;
+        }
+        std::string line;
+        for (size_t bytes = 0, n = 0; bytes < (mb << 20); n++)
+        {
+            char head[64];
+            snprintf(head, sizeof(head), "[2019-12-25 10:%02d:%02d.%03d] ", static_cast<int>(n / 60000 % 60),
+                     static_cast<int>(n / 1000 % 60), static_cast<int>(n % 1000));
+            line = head;
+            if (rng() % 500 == 0)
+                line += "[error] Exception occur:\t Code:" + std::to_string(codes[rng() % 12]) + "\tMess:frame lost";
+            else
+                line += normal[rng() % 4];
+            line += '\n';
+            fwrite(line.data(), 1, line.size(), fp);
+            bytes += line.size();
+        }
+        fclose(fp);
+    }
+
+    Utils_MappedFile mf;
+    if (!mf.Open(file))
+        return 1;
+    std::string_view text = mf.view();
+    double size_mb = text.size() / double(1 << 20);
+
+    Utils_MultiSearch ms;
+    for (const auto &p : pats)
+        ms.Add(p);
+    auto t0 = std::chrono::steady_clock::now();
+    ms.Build();
+    double t_build = Seconds(t0);
+
+    // 2. 单线程  先跑一遍预热页缓存
+    ms.Scan(text, [](const Utils_SearchMatch &) {});
+    size_t n1 = 0;
+    t0 = std::chrono::steady_clock::now();
+    ms.Scan(text, [&](const Utils_SearchMatch &) { n1++; });
+    double t_serial = Seconds(t0);
+
+    // 3. 多线程
+    std::vector<size_t> part(static_cast<size_t>(threads > 0 ? threads : 1) * 16, 0);
+    t0 = std::chrono::steady_clock::now();
+    ms.ScanParallel(text, threads, [&](const Utils_SearchMatch &, int worker) { part[static_cast<size_t>(worker) * 16]++; });
+    double t_parallel = Seconds(t0);
+    size_t n2 = 0;
+    for (size_t c : part)
+        n2 += c;
+
+    // 4. 逐个模式查找
+    size_t n3 = 0;
+    t0 = std::chrono::steady_clock::now();
+    for (const auto &p : pats)
+    {
+        for (size_t pos = text.find(p); pos != std::string_view::npos; pos = text.find(p, pos + 1))
+            n3++;
+    }
+    double t_naive = Seconds(t0);
+
+    printf("file     : %.1f MB  patterns %zu  states %zu  build %.3f ms\n", size_mb, pats.size(), ms.StateCount(),
+           t_build * 1e3);
+    printf("serial   : %8.1f MB/s  matches %zu\n", size_mb / t_serial, n1);
+    printf("parallel : %8.1f MB/s  matches %zu  threads %d\n", size_mb / t_parallel, n2, threads);
+    printf("find x%zu : %8.1f MB/s  matches %zu\n", pats.size(), size_mb / t_naive, n3);
+    remove(file);
+    return 0;
+}
@@ -0,0 +1,290 @@
+/**
+ * @file    Code\utils\bench_utils_string.cc.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   Utils_String 转换函数 吞吐量测试
+ *          * 有负载的转换 (拷贝 hex Base64 分割 引号) 按 16 B 256 B 4 KB 64 KB 1 MB 测量, 输出按输入字节计算的 MB/s
+ *          * 数字转换 每次调用的 ns
+ *          * --json out.json       输出 JSON 基线, 每个结果一行
+ *          * --compare base.json   与基线对比, 任何一项 MB/s 下降超过 --tolerance (默认 10%) 时返回 1
+ *          * --min-ms N            每一项至少运行 N ms (默认 50)
+ *          * 分别以 -mavx2 (/arch:AVX2) 和默认选项编译, 对比 AVX2 与标量路径
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#include "./utils_string.h"
+
+#include <chrono>
+#include <random>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+struct BenchResult
+{
+    std::string name;
+    size_t size;        ///< 输入字节数, 数字转换为 0
+    double mbps;
+    double ns;          ///< 每次调用
+};
+
+static size_t g_sink = 0;
+static double g_min_sec = 0.05;
+
+/**
+ * @fn  template<typename Fn> static BenchResult Measure(const char *name, size_t size, Fn &&fn)
+ *
+ * @brief   轮数从 1 开始加倍, 直到运行时间超过 g_min_sec
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+template<typename Fn>
+static BenchResult Measure(const char *name, size_t size, Fn &&fn)
+{
+    for (size_t rounds = 1;; rounds *= 2)
+    {
+        auto t0 = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < rounds; i++)
+            fn();
+        double sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+        if (sec >= g_min_sec)
+        {
+            double ns = sec * 1e9 / static_cast<double>(rounds);
+            double mbps = size == 0 ? 0 : static_cast<double>(size) * static_cast<double>(rounds) / sec / (1 << 20);
+            return { name, size, mbps, ns };
+        }
+    }
+}
+
+static void BenchPayload(std::vector<BenchResult> &out, size_t size, std::mt19937 &rng)
+{
+    std::string bin(size, '\0');
+    for (char &c : bin)
+        c = static_cast<char>(rng());
+    uchar *raw = reinterpret_cast<uchar *>(&bin[0]);
+
+    // 不含 \0 的文本 和 逗号分割的文本
+    std::string text(size, 'a');
+    for (char &c : text)
+        c = static_cast<char>('a' + rng() % 26);
+    std::string csv = text;
+    for (size_t i = 7; i < csv.size(); i += 8)
+        csv[i] = ',';
+    std::string quoted = text;
+    for (size_t i = 31; i < quoted.size(); i += 32)
+        quoted[i] = '"';
+
+    std::string hex_sp = Utils_String::CharArr2Hex(raw, static_cast<int>(size), 1);
+    std::string hex = Utils_String::CharArr2Hex(raw, static_cast<int>(size), 0);
+    std::string b64 = Utils_String::Base64Encode(bin);
+    std::string b64url = Utils_String::Base64Encode(bin, true);
+    std::string tmp;
+
+    out.push_back(Measure("String2Char", size, [&] {
+        char *p = Utils_String::String2Char(text);
+        g_sink += static_cast<uchar>(p[0]);
+        delete[] p;
+    }));
+    out.push_back(Measure("ConstChar2Char", size, [&] {
+        char *p = Utils_String::ConstChar2Char(text.c_str());
+        g_sink += static_cast<uchar>(p[0]);
+        delete[] p;
+    }));
+    out.push_back(Measure("ConstChar2String", size, [&] {
+        g_sink += Utils_String::ConstChar2String(text.c_str()).size();
+    }));
+    out.push_back(Measure("CharArr2String", size, [&] {
+        g_sink += Utils_String::CharArr2String(&bin[0], static_cast<int>(size)).size();
+    }));
+    out.push_back(Measure("ShowCharArr", size, [&] {
+        g_sink += Utils_String::ShowCharArr(&bin).size();
+    }));
+    out.push_back(Measure("CharArr2Hex", size, [&] {
+        g_sink += Utils_String::CharArr2Hex(raw, static_cast<int>(size), 0).size();
+    }));
+    out.push_back(Measure("CharArr2Hex space", size, [&] {
+        g_sink += Utils_String::CharArr2Hex(raw, static_cast<int>(size), 1).size();
+    }));
+    out.push_back(Measure("Hex2String", size, [&] {
+        g_sink += Utils_String::Hex2String(hex, false).size();
+    }));
+    out.push_back(Measure("Hex2String space", size, [&] {
+        g_sink += Utils_String::Hex2String(hex_sp).size();
+    }));
+    out.push_back(Measure("Hex2CharArr", size, [&] {
+        uchar *p = nullptr;
+        Utils_String::Hex2CharArr(p, hex_sp);
+        g_sink += p[0];
+        delete[] p;
+    }));
+    out.push_back(Measure("Base64Encode", size, [&] {
+        g_sink += Utils_String::Base64Encode(bin).size();
+    }));
+    out.push_back(Measure("Base64Decode", size, [&] {
+        g_sink += Utils_String::Base64Decode(b64, tmp) ? tmp.size() : 0;
+    }));
+    out.push_back(Measure("Base64Encode url", size, [&] {
+        g_sink += Utils_String::Base64Encode(bin, true).size();
+    }));
+    out.push_back(Measure("Base64Decode url", size, [&] {
+        g_sink += Utils_String::Base64Decode(b64url, tmp, true) ? tmp.size() : 0;
+    }));
+    out.push_back(Measure("Str2Vec", size, [&] {
+        g_sink += Utils_String::Str2Vec(csv, ',').size();
+    }));
+    out.push_back(Measure("Str2Vector", size, [&] {
+        g_sink += Utils_String::Str2Vector(csv, ",;").size();
+    }));
+    out.push_back(Measure("AddQuoteString", size, [&] {
+        g_sink += Utils_String::AddQuoteString(text).size();
+    }));
+    out.push_back(Measure("AppendQuoteString", size, [&] {
+        tmp.clear();
+        Utils_String::AppendQuoteString(tmp, quoted);
+        g_sink += tmp.size();
+    }));
+}
+
+static void BenchScalar(std::vector<BenchResult> &out, std::mt19937 &rng)
+{
+    std::vector<int> nums(1024);
+    std::vector<std::string> strs(nums.size()), hexs(nums.size());
+    for (size_t i = 0; i < nums.size(); i++)
+    {
+        nums[i] = static_cast<int>(rng());
+        strs[i] = std::to_string(nums[i]);
+        hexs[i] = Utils_String::Num2Hex(static_cast<uchar>(nums[i])) + " " + Utils_String::Num2Hex(static_cast<uchar>(nums[i] >> 8));
+    }
+    size_t k = 0;
+    auto next = [&]() { return k++ & (nums.size() - 1); };
+
+    out.push_back(Measure("NumToString", 0, [&] {
+        g_sink += Utils_String::NumToString(nums[next()], 3).size();
+    }));
+    out.push_back(Measure("NumToString hex", 0, [&] {
+        g_sink += Utils_String::NumToString(nums[next()], 8, 16).size();
+    }));
+    out.push_back(Measure("NumToString float", 0, [&] {
+        g_sink += Utils_String::NumToString(static_cast<float>(nums[next()]) * 1e-3f, 3).size();
+    }));
+    out.push_back(Measure("String2Num", 0, [&] {
+        g_sink += static_cast<unsigned>(Utils_String::String2Num(strs[next()]));
+    }));
+    out.push_back(Measure("Hex2Num", 0, [&] {
+        g_sink += static_cast<unsigned>(Utils_String::Hex2Num(std::string_view(hexs[next()])));
+    }));
+    out.push_back(Measure("Num2Hex", 0, [&] {
+        g_sink += Utils_String::Num2Hex(static_cast<uchar>(nums[next()])).size();
+    }));
+    out.push_back(Measure("StringVersionToInt", 0, [&] {
+        g_sink += static_cast<unsigned>(Utils_String::StringVersionToInt("1.10.3"));
+    }));
+}
+
+static bool WriteJson(const char *file, const std::vector<BenchResult> &res)
+{
+    FILE *fp = fopen(file, "w");
+    if (fp == nullptr)
+        return false;
+#if defined(__AVX2__)
+    fprintf(fp, "{\n\"bench\": \"utils_string\",\n\"avx2\": true,\n\"results\": [\n");
+#else
+    fprintf(fp, "{\n\"bench\": \"utils_string\",\n\"avx2\": false,\n\"results\": [\n");
+#endif
+    for (size_t i = 0; i < res.size(); i++)
+    {
+        fprintf(fp, "{\"name\": \"%s\", \"size\": %zu, \"mbps\": %.2f, \"ns\": %.2f}%s\n", res[i].name.c_str(),
+                res[i].size, res[i].mbps, res[i].ns, i + 1 < res.size() ? "," : "");
+    }
+    fprintf(fp, "]\n}\n");
+    fclose(fp);
+    return true;
+}
+
+/**
+ * @fn  static int Compare(const char *file, const std::vector<BenchResult> &res, double tolerance)
+ *
+ * @brief   读取 WriteJson 输出的基线 (每个结果一行), 按 name + size 对比
+ *          * 有负载的比较 MB/s, 数字转换比较 ns
+ *
+ * @return  下降超过 tolerance 的项数, -1 基线无法读取
+ */
+static int Compare(const char *file, const std::vector<BenchResult> &res, double tolerance)
+{
+    FILE *fp = fopen(file, "r");
+    if (fp == nullptr)
+        return -1;
+    int worse = 0;
+    char line[512];
+    while (fgets(line, sizeof(line), fp) != nullptr)
+    {
+        char name[128];
+        size_t size = 0;
+        double mbps = 0, ns = 0;
+        if (sscanf(line, "{\"name\": \"%127[^\"]\", \"size\": %zu, \"mbps\": %lf, \"ns\": %lf", name, &size, &mbps,
+                   &ns) != 4)
+            continue;
+        for (const BenchResult &r : res)
+        {
+            if (r.name != name || r.size != size)
+                continue;
+            double ratio = size == 0 ? ns / r.ns : r.mbps / mbps;
+            bool bad = ratio < 1.0 - tolerance;
+            worse += bad ? 1 : 0;
+            printf("%-20s %8zu  %6.2fx%s\n", name, size, ratio, bad ? "  REGRESSION" : "");
+        }
+    }
+    fclose(fp);
+    return worse;
+}
+
+int main(int argc, char **argv)
+{
+    const char *json = nullptr;
+    const char *base = nullptr;
+    double tolerance = 0.1;
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        if (strcmp(argv[i], "--json") == 0)
+            json = argv[i + 1];
+        else if (strcmp(argv[i], "--compare") == 0)
+            base = argv[i + 1];
+        else if (strcmp(argv[i], "--tolerance") == 0)
+            tolerance = atof(argv[i + 1]);
+        else if (strcmp(argv[i], "--min-ms") == 0)
+            g_min_sec = atof(argv[i + 1]) / 1000;
+    }
+#if defined(__AVX2__)
+    printf("base64 path: AVX2\n");
+#else
+    printf("base64 path: scalar\n");
+#endif
+
+    std::mt19937 rng(2019);
+    std::vector<BenchResult> res;
+    for (size_t size : { size_t(16), size_t(256), size_t(4) << 10, size_t(64) << 10, size_t(1) << 20 })
+        BenchPayload(res, size, rng);
+    BenchScalar(res, rng);
+
+    printf("%-20s %8s %10s %12s\n", "name", "size", "MB/s", "ns/op");
+    for (const BenchResult &r : res)
+        printf("%-20s %8zu %10.1f %12.1f\n", r.name.c_str(), r.size, r.mbps, r.ns);
+    printf("sink %zu\n", g_sink);
+
+    if (json != nullptr && !WriteJson(json, res))
+    {
+        printf("write %s failed\n", json);
+        return 1;
+    }
+    if (base != nullptr)
+    {
+        int worse = Compare(base, res, tolerance);
+        if (worse < 0)
+            printf("read %s failed\n", base);
+        return worse != 0 ? 1 : 0;
+    }
+    return 0;
+}
@@ -0,0 +1,217 @@
+/**
+ * @file    Code\utils\fuzz_utils_string.cc.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   Utils_String 转换函数的差分模糊测试  与逐字节的参考实现对比, 不一致时 abort
+ *          * libFuzzer: clang++ -std=c++17 -g -fsanitize=fuzzer,address,undefined fuzz_utils_string.cc utils_string.cc utils_format.cc
+ *          * 没有 libFuzzer 时加 -DUTILS_FUZZ_STANDALONE, 参数为语料文件 或 随机轮数
+ *          * 第一个字节选择被测函数, 其余为输入
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#include "./utils_string.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#define FUZZ_CHECK(x)                                                       \
+    do                                                                      \
+    {                                                                       \
+        if (!(x))                                                           \
+        {                                                                   \
+            fprintf(stderr, "%s:%d fuzz check failed: %s\n", __FILE__, __LINE__, #x); \
+            abort();                                                        \
+        }                                                                   \
+    } while (0)
+
+// 参考实现  逐个字符, 与修改之前的实现结果一致 (去掉了崩溃)
+static std::string RefHex2String(const std::string &str, bool flg_space)
+{
+    if (str.size() > 2 && str[2] == ' ')
+        flg_space = true;
+    size_t step = flg_space ? 3 : 2;
+    size_t n = (flg_space ? str.size() + 1 : str.size()) / step;
+    std::string res;
+    for (size_t i = 0; i < n; i++)
+        res.push_back(static_cast<char>(Utils_String::Hex2Uchar(std::string_view(str).substr(i * step, 2))));
+    return res;
+}
+
+static std::string RefCharArr2Hex(const uchar *buf, size_t len, bool flg_space)
+{
+    std::string res;
+    for (size_t i = 0; i < len; i++)
+    {
+        res += Utils_String::Num2Hex(buf[i]);
+        if (flg_space && i + 1 != len)
+            res += ' ';
+    }
+    return res;
+}
+
+static std::vector<std::string> RefSplit(const std::string &str, char sep, bool skip_empty)
+{
+    std::vector<std::string> res;
+    std::istringstream iss(str);
+    for (std::string item; getline(iss, item, sep);)
+    {
+        if (!skip_empty || !item.empty())
+            res.push_back(item);
+    }
+    return res;
+}
+
+static std::string RefBase64(const uchar *src, size_t len, bool url)
+{
+    const char *abc = url ? "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_"
+                          : "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string res;
+    for (size_t i = 0; i < len; i += 3)
+    {
+        uint32_t v = static_cast<uint32_t>(src[i]) << 16;
+        if (i + 1 < len)
+            v |= static_cast<uint32_t>(src[i + 1]) << 8;
+        if (i + 2 < len)
+            v |= src[i + 2];
+        size_t chars = len - i >= 3 ? 4 : len - i + 1;
+        for (size_t k = 0; k < chars; k++)
+            res.push_back(abc[(v >> (18 - 6 * k)) & 63]);
+        if (!url)
+            res.append(4 - chars, '=');
+    }
+    return res;
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    if (size == 0)
+        return 0;
+    const uint8_t op = data[0];
+    const std::string in(reinterpret_cast<const char *>(data + 1), size - 1);
+    const uchar *raw = reinterpret_cast<const uchar *>(in.data());
+    const bool flag = (op & 0x80) != 0;
+
+    switch (op % 8)
+    {
+        case 0:     // hex 解析 任意输入
+        {
+            FUZZ_CHECK(Utils_String::Hex2String(in, flag) == RefHex2String(in, flag));
+            if (in.size() >= 3)
+            {
+                uchar *buf = nullptr;
+                Utils_String::Hex2CharArr(buf, in, flag);
+                std::string ref = RefHex2String(in, flag);
+                FUZZ_CHECK(memcmp(buf, ref.data(), ref.size()) == 0);
+                delete[] buf;
+            }
+            break;
+        }
+        case 1:     // hex 输出 与往返
+        {
+            std::string hex = Utils_String::CharArr2Hex(const_cast<uchar *>(raw), static_cast<int>(in.size()), flag);
+            FUZZ_CHECK(hex == RefCharArr2Hex(raw, in.size(), flag));
+            if (flag || in.size() > 1)
+                FUZZ_CHECK(Utils_String::Hex2String(hex, flag) == in);
+            std::string show = Utils_String::ShowCharArr(&in);
+            FUZZ_CHECK(show == RefCharArr2Hex(raw, in.size(), true) + (in.empty() ? "" : " "));
+            break;
+        }
+        case 2:     // Base64 与参考编码一致, 往返
+        {
+            std::string enc = Utils_String::Base64Encode(in, flag);
+            FUZZ_CHECK(enc == RefBase64(raw, in.size(), flag));
+            std::string dec;
+            FUZZ_CHECK(Utils_String::Base64Decode(enc, dec, flag));
+            FUZZ_CHECK(dec == in);
+            break;
+        }
+        case 3:     // Base64 解码 任意输入 不崩溃, 成功时重新编码得到相同的文本
+        {
+            std::string dec;
+            if (Utils_String::Base64Decode(in, dec, flag))
+            {
+                std::string enc = Utils_String::Base64Encode(dec, flag);
+                FUZZ_CHECK(enc == in || (flag && enc == in.substr(0, enc.size())));
+            }
+            break;
+        }
+        case 4:     // 分割
+        {
+            char sep = in.empty() ? ',' : in[0];
+            FUZZ_CHECK(Utils_String::Str2Vec(in, sep, flag) == RefSplit(in, sep, flag));
+            break;
+        }
+        case 5:     // 拷贝
+        {
+            char *copy = Utils_String::String2Char(in);
+            FUZZ_CHECK(memcmp(copy, in.c_str(), in.size() + 1) == 0);
+            FUZZ_CHECK(Utils_String::CharArr2String(copy, static_cast<int>(in.size())) == in);
+            FUZZ_CHECK(Utils_String::CharArr2String(copy, -1) == std::string(in.c_str()));
+            char *copy2 = Utils_String::ConstChar2Char(copy);
+            FUZZ_CHECK(strcmp(copy2, in.c_str()) == 0);
+            delete[] copy2;
+            delete[] copy;
+            break;
+        }
+        case 6:     // 整数 输出 与解析往返
+        {
+            int num = 0;
+            memcpy(&num, in.data(), in.size() < sizeof(num) ? in.size() : sizeof(num));
+            int base = 2 + (op >> 3) % 35;
+            std::string s = Utils_String::NumToString(num, 1, base);
+            FUZZ_CHECK(Utils_String::String2Num(s, base) == num);
+            FUZZ_CHECK(Utils_String::NumToString(num, 0) == std::to_string(num));
+            break;
+        }
+        default:    // 解析任意文本 不崩溃
+        {
+            volatile unsigned sink = static_cast<unsigned>(Utils_String::String2Num(in, 2 + (op >> 3) % 35));
+            sink += static_cast<unsigned>(Utils_String::Hex2Num(std::string_view(in)));
+            sink += static_cast<unsigned>(Utils_String::StringVersionToInt(in));
+            (void)sink;
+            break;
+        }
+    }
+    return 0;
+}
+
+#ifdef UTILS_FUZZ_STANDALONE
+#include <fstream>
+#include <iterator>
+#include <random>
+
+int main(int argc, char **argv)
+{
+    // 参数为文件时 逐个回放, 否则按参数给出的轮数随机生成
+    if (argc > 1 && atoi(argv[1]) == 0)
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            std::ifstream ifs(argv[i], std::ios::binary);
+            std::vector<uint8_t> buf((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+            LLVMFuzzerTestOneInput(buf.data(), buf.size());
+        }
+        return 0;
+    }
+    long rounds = argc > 1 ? atol(argv[1]) : 100000;
+    std::mt19937 rng(2019);
+    std::vector<uint8_t> buf;
+    const char alphabet[] = "0123456789ABCDEFabcdef +/=-_,\n";
+    for (long r = 0; r < rounds; r++)
+    {
+        buf.resize(1 + rng() % 200);
+        bool text = (rng() & 1) != 0;
+        for (uint8_t &c : buf)
+            c = text ? static_cast<uint8_t>(alphabet[rng() % (sizeof(alphabet) - 1)]) : static_cast<uint8_t>(rng());
+        buf[0] = static_cast<uint8_t>(rng());
+        LLVMFuzzerTestOneInput(buf.data(), buf.size());
+    }
+    printf("fuzz %ld rounds ok\n", rounds);
+    return 0;
+}
+#endif
@@ -0,0 +1,166 @@
+// 单元测试
+#include "./utils_async.h"
+#include "./utils_concurrent.h"
+
+#include <stdio.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+static std::vector<std::string> ReadLines(const char *file)
+{
+    std::vector<std::string> lines;
+    std::ifstream in(file, std::ios::binary);
+    for (std::string line; std::getline(in, line);)
+        lines.push_back(line);
+    return lines;
+}
+
+TEST_CASE("MpmcQueue")
+{
+    Utils_MpmcQueue<int> q(3);
+    CHECK(q.capacity() == 4);
+    int v = 0;
+    CHECK_FALSE(q.TryPop(v));
+    for (int i = 1; i <= 4; i++)
+        CHECK(q.TryPush(i));
+    v = 5;
+    CHECK_FALSE(q.TryPush(v));
+    CHECK(v == 5);
+    CHECK(q.TryPop(v));
+    CHECK(v == 1);
+    CHECK(q.Pushed() == 4);
+    CHECK(q.Popped() == 1);
+
+    // 多生产者 多消费者  每个值恰好取出一次
+    Utils_MpmcQueue<int> mp(64);
+    const int per = 20000;
+    std::atomic<long long> sum(0);
+    std::atomic<int> count(0);
+    std::vector<std::thread> threads;
+    for (int p = 0; p < 3; p++)
+    {
+        threads.emplace_back([&, p]() {
+            for (int i = 1; i <= per; i++)
+            {
+                int x = p * per + i;
+                while (!mp.TryPush(x))
+                    std::this_thread::yield();
+            }
+        });
+    }
+    for (int c = 0; c < 2; c++)
+    {
+        threads.emplace_back([&]() {
+            int x;
+            while (count.load() < 3 * per)
+            {
+                if (mp.TryPop(x))
+                {
+                    sum += x;
+                    count++;
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto &t : threads)
+        t.join();
+    const long long n = 3LL * per;
+    CHECK(sum == n * (n + 1) / 2);
+}
+
+TEST_CASE("AsyncWriter group commit")
+{
+    const char *file = "test_utils_async.tmp";
+    remove(file);
+
+    Utils_AsyncWriter::Options opt;
+    opt.append = false;
+    opt.commit_ms = 10000;      // 只按大小和屏障提交
+    opt.batch_bytes = 4096;
+    opt.queue_capacity = 256;
+    Utils_AsyncWriter writer;
+    REQUIRE(writer.Open(file, opt));
+
+    // 多个线程同时写入  每个线程内的顺序保持
+    const int threads = 4, per = 5000;
+    std::vector<std::thread> producers;
+    for (int t = 0; t < threads; t++)
+    {
+        producers.emplace_back([&writer, t]() {
+            for (int i = 0; i < per; i++)
+                writer.Write("t" + std::to_string(t) + " " + std::to_string(i));
+        });
+    }
+    for (auto &p : producers)
+        p.join();
+    CHECK(writer.Sync());
+    CHECK(writer.Lines() == static_cast<uint64_t>(threads * per));
+    CHECK(writer.Commits() < static_cast<uint64_t>(threads * per) / 50);
+
+    std::vector<std::string> lines = ReadLines(file);
+    REQUIRE(lines.size() == static_cast<size_t>(threads * per));
+    std::vector<int> next(threads, 0);
+    bool ordered = true;
+    for (const std::string &line : lines)
+    {
+        int t = 0, i = 0;
+        std::istringstream(line.substr(1)) >> t >> i;
+        ordered = ordered && t >= 0 && t < threads && next[t] == i;
+        next[t] = i + 1;
+    }
+    CHECK(ordered);
+
+    // Flush 之后其他进程可见
+    CHECK(writer.Write("after"));
+    CHECK(writer.Flush());
+    CHECK(ReadLines(file).back() == "after");
+    std::string line = "try";
+    CHECK(writer.TryWrite(line));
+    CHECK(writer.Close());
+    CHECK(ReadLines(file).back() == "try");
+    CHECK_FALSE(writer.Write("closed"));
+    CHECK_FALSE(writer.Sync());
+    remove(file);
+}
+
+TEST_CASE("AsyncWriter commit interval")
+{
+    const char *file = "test_utils_async_time.tmp";
+    Utils_AsyncWriter::Options opt;
+    opt.append = false;
+    opt.commit_ms = 20;
+    opt.newline = false;
+    Utils_AsyncWriter writer;
+    REQUIRE(writer.Open(file, opt));
+    CHECK(writer.Write("a"));
+    CHECK(writer.Write("b"));
+
+    // 不调用 Flush, 超过提交时间后写入
+    auto t0 = std::chrono::steady_clock::now();
+    while (writer.Lines() < 2 && std::chrono::steady_clock::now() - t0 < std::chrono::seconds(5))
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    CHECK(writer.Lines() == 2);
+    CHECK(ReadLines(file) == std::vector<std::string>({ "ab" }));
+
+    // 追加打开
+    CHECK(writer.Close());
+    opt.append = true;
+    REQUIRE(writer.Open(file, opt));
+    CHECK(writer.Write("c"));
+    CHECK(writer.Close());
+    CHECK(ReadLines(file) == std::vector<std::string>({ "abc" }));
+    remove(file);
+
+    CHECK_FALSE(writer.Open("not_exist_dir/x/y.txt"));
+    CHECK_FALSE(writer.Flush());
+}
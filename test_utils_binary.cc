@@ -0,0 +1,126 @@
+// 单元测试
+#include "./utils_binary.h"
+#include "./utils_mmap.h"
+
+#include <stdio.h>
+#include <sstream>
+#include <string>
+#include <vector>
+
+TEST_CASE("ByteOrder")
+{
+    CHECK(Utils_ByteOrder::Swap<uint16_t>(0x1234) == 0x3412);
+    CHECK(Utils_ByteOrder::Swap<uint32_t>(0x12345678u) == 0x78563412u);
+    CHECK(Utils_ByteOrder::Swap<int64_t>(0x0102030405060708LL) == 0x0807060504030201LL);
+    CHECK(Utils_ByteOrder::Swap(Utils_ByteOrder::Swap(1.25)) == 1.25);
+    CHECK(Utils_ByteOrder::Swap<uint8_t>(7) == 7);
+    CHECK_FALSE(Utils_ByteOrder::NeedSwap(Utils_Endian::kNative));
+    CHECK(Utils_ByteOrder::NeedSwap(Utils_Endian::kLittle) != Utils_ByteOrder::NeedSwap(Utils_Endian::kBig));
+}
+
+TEST_CASE("BinaryWriter endian and strings")
+{
+    std::ostringstream le, be;
+    Utils_BinaryWriter::Options opt;
+    Utils_BinaryWriter w;
+    REQUIRE(w.Attach(le, opt));
+    CHECK(w.Put<uint32_t>(0x01020304));
+    CHECK(w.Put<int16_t>(-2));
+    CHECK(w.PutString("abc", 5));
+    CHECK(w.PutString("truncated", 4));
+    CHECK(w.PutCString("z"));
+    CHECK(w.Tell() == 4 + 2 + 5 + 4 + 2);
+    CHECK(le.str().empty());    // 还在缓冲区中
+    CHECK(w.Close());
+    CHECK(le.str() == std::string("\x04\x03\x02\x01\xfe\xff" "abc\0\0" "trun" "z\0", 17));
+
+    opt.endian = Utils_Endian::kBig;
+    REQUIRE(w.Attach(be, opt));
+    CHECK(w.Put<uint32_t>(0x01020304));
+    CHECK(w.Put<float>(1.0f));
+    CHECK(w.PutString("ab", 4, ' '));
+    CHECK(w.Close());
+    CHECK(be.str() == std::string("\x01\x02\x03\x04\x3f\x80\x00\x00" "ab  ", 12));
+    CHECK_FALSE(w.Put<int>(1));
+}
+
+TEST_CASE("BinaryWriter buffering and flush policy")
+{
+    // 小缓冲区 数组跨越缓冲区边界, 大块数据直接写入
+    const char *file = "test_utils_binary.tmp";
+    std::vector<uint32_t> values(1000);
+    for (size_t i = 0; i < values.size(); i++)
+        values[i] = static_cast<uint32_t>(i * 2654435761u);
+    std::string big(300, 'x');
+
+    Utils_BinaryWriter::Options opt;
+    opt.buffer_size = 64;
+    opt.endian = Utils_Endian::kBig;
+    {
+        Utils_BinaryWriter w;
+        REQUIRE(w.Open(file, opt));
+        CHECK(w.Put<uint8_t>(9));
+        CHECK(w.PutArray(values));
+        CHECK(w.PutBytes(big.data(), big.size()));
+        CHECK(w.Put<uint64_t>(42));
+        CHECK(w.good());
+    }
+
+    Utils_MappedReader reader;
+    REQUIRE(reader.Open(file));
+    CHECK(reader.size() == 1 + values.size() * 4 + big.size() + 8);
+    uint8_t tag = 0;
+    CHECK(reader.Read(tag));
+    CHECK(tag == 9);
+    bool same = true;
+    for (uint32_t v : values)
+    {
+        uint32_t x = 0;
+        same = same && reader.Read(x) && Utils_ByteOrder::Swap(x) == v;
+    }
+    CHECK(same);
+    std::string_view view;
+    CHECK(reader.ReadView(big.size(), view));
+    CHECK(view == big);
+    uint64_t last = 0;
+    CHECK(reader.Read(last));
+    CHECK(Utils_ByteOrder::NeedSwap(Utils_Endian::kBig) ? Utils_ByteOrder::Swap(last) == 42 : last == 42);
+    reader.Close();
+
+    // 追加
+    Utils_BinaryWriter app;
+    REQUIRE(app.Open(file, Utils_BinaryWriter::Options(), true));
+    CHECK(app.Put<uint16_t>(1));
+    CHECK(app.Sync());
+    CHECK(app.Close());
+    REQUIRE(reader.Open(file));
+    CHECK(reader.size() == 1 + values.size() * 4 + big.size() + 8 + 2);
+    reader.Close();
+    remove(file);
+
+    // 达到阈值时写入
+    std::ostringstream os;
+    Utils_BinaryWriter::Options th;
+    th.policy = Utils_BinaryWriter::kThreshold;
+    th.flush_threshold = 16;
+    Utils_BinaryWriter w;
+    REQUIRE(w.Attach(os, th));
+    for (int i = 0; i < 3; i++)
+        w.Put<uint32_t>(i);
+    CHECK(os.str().empty());
+    CHECK(w.Put<uint32_t>(3));
+    CHECK(os.str().size() == 16);
+    CHECK(w.Buffered() == 0);
+
+    // 每次写入
+    std::ostringstream always;
+    Utils_BinaryWriter::Options al;
+    al.policy = Utils_BinaryWriter::kAlways;
+    REQUIRE(w.Attach(always, al));
+    CHECK(os.str().size() == 16);
+    w.Put<uint8_t>(1);
+    CHECK(always.str().size() == 1);
+
+    CHECK_FALSE(w.Open("not_exist_dir/x/y.bin"));
+    CHECK_FALSE(w.good());
+}
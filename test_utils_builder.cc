@@ -0,0 +1,62 @@
+// 单元测试
+#include "./utils_builder.h"
+
+#include <string>
+
+TEST_CASE("StringBuilder Append")
+{
+    Utils_StringBuilder<> sb;
+    sb.Append("img_").AppendInt(7, 4).Append('_').Append(-12).Append(' ').Append(2.5).Append(' ').Append(true);
+    CHECK(sb.view() == "img_0007_-12 2.5 true");
+    CHECK(sb.size() == strlen(sb.c_str()));
+    CHECK(sb.IsInline());
+
+    std::string name = "camera";
+    std::string_view ext = ".bmp";
+    sb.Clear();
+    sb.Append(name).Append(ext).Append(42u).AppendFloat(1.0 / 3, 2);
+    CHECK(sb.str() == "camera.bmp420.33");
+
+    sb.Resize(6);
+    CHECK(std::string(sb.c_str()) == "camera");
+}
+
+TEST_CASE("StringBuilder Grow")
+{
+    // 超过内联缓冲区 从堆扩容
+    Utils_StringBuilder<16> sb;
+    std::string expect;
+    for (int i = 0; i < 100; i++)
+    {
+        sb.Append(i).Append(',');
+        expect += std::to_string(i) + ",";
+    }
+    CHECK_FALSE(sb.IsInline());
+    CHECK(sb.view() == expect);
+    CHECK(sb.c_str()[sb.size()] == '\0');
+
+    // 从 arena 扩容
+    Utils_Arena arena(256);
+    {
+        Utils_StringBuilder<8> ab(&arena);
+        ab.Append("D:\\data\\camera_01\\image_").AppendInt(123, 6).Append(".bmp");
+        CHECK(ab.view() == "D:\\data\\camera_01\\image_000123.bmp");
+        CHECK(arena.Used() > 0);
+    }
+    arena.Reset();
+    CHECK(arena.Used() == 0);
+}
+
+TEST_CASE("Arena Allocate")
+{
+    Utils_Arena arena(64);
+    char *a = static_cast<char *>(arena.Allocate(10, 1));
+    void *b = arena.Allocate(8, 8);
+    CHECK(reinterpret_cast<uintptr_t>(b) % 8 == 0);
+    CHECK(static_cast<char *>(b) >= a + 10);
+
+    // 超过块大小的请求 单独成块
+    char *big = static_cast<char *>(arena.Allocate(1000, 1));
+    memset(big, 1, 1000);
+    CHECK(arena.Used() == 1018);
+}
@@ -0,0 +1,172 @@
+// 单元测试
+#include "./utils_config.h"
+#include "./Utils_Exception.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+static const char *kYml =
+    "%YAML:1.0\n"
+    "---\n"
+    "# 运行参数\n"
+    "RunPara:\n"
+    "   Image:\n"
+    "      Polar:\n"
+    "         nImgWidth: 1280\n"
+    "         nImgHeight: 0x400     # 注释\n"
+    "      fScale: 0.5\n"
+    "   bSave: true\n"
+    "   sPath: \"D:\\\\data\\\\image\"\n"
+    "   sName: 'it''s'\n"
+    "   vRoi: [ 10, 20, 300, 400 ]\n"
+    "   vCam:\n"
+    "      - cam_01\n"
+    "      - \"cam,02\"\n"
+    "   Matrix: !!opencv-matrix\n"
+    "      rows: 3\n"
+    "Serial:\n"
+    "   nBaud: -115200\n"
+    "   nBaud: 9600\n";
+
+TEST_CASE("Config parse yaml")
+{
+    Utils_ConfigTable t(kYml, 1);
+    CHECK(t.GetOr<int>("RunPara.Image.Polar.nImgWidth", 0) == 1280);
+    CHECK(t.GetOr<int>("RunPara.Image.Polar.nImgHeight", 0) == 1024);
+    CHECK(t.GetOr<double>("RunPara.Image.fScale", 0) == 0.5);
+    CHECK(t.GetOr<double>("RunPara.Image.Polar.nImgWidth", 0) == 1280.0);
+    CHECK(t.GetOr<bool>("RunPara.bSave", false));
+    CHECK(t.GetOr<std::string>("RunPara.sPath", "") == "D:\\data\\image");
+    CHECK(t.GetOr<std::string>("RunPara.sName", "") == "it's");
+    CHECK(t.GetOr<int>("RunPara.Matrix.rows", 0) == 3);
+    CHECK(t.GetOr<int>("Serial.nBaud", 0) == 9600);
+
+    std::vector<int> roi;
+    CHECK(t.Get("RunPara.vRoi", roi));
+    CHECK(roi == std::vector<int>({ 10, 20, 300, 400 }));
+    std::vector<std::string> cams;
+    CHECK(t.Get("RunPara.vCam", cams));
+    CHECK(cams == std::vector<std::string>({ "cam_01", "cam,02" }));
+
+    // 类型不符 和 不存在的键
+    int n = -1;
+    CHECK_FALSE(t.Get("RunPara.Image.fScale", n));
+    CHECK_FALSE(t.Get("RunPara.sPath", n));
+    CHECK_FALSE(t.Get("RunPara.Image", n));
+    CHECK_FALSE(t.Get("RunPara.none", n));
+    CHECK(n == -1);
+    CHECK(t.Find("RunPara.Image.Polar") == nullptr);
+}
+
+TEST_CASE("Config parse ini")
+{
+    Utils_ConfigTable t("; 串口\n"
+                        "[Serial]\n"
+                        "port = COM3\n"
+                        "baud=115200 ; 波特率\n"
+                        "[Camera]\n"
+                        "exposure = 1.2e3\n"
+                        "enable = off\n"
+                        "name = \"cam #1\"\n", 7);
+    CHECK(t.Generation() == 7);
+    CHECK(t.size() == 5);
+    CHECK(t.GetOr<std::string>("Serial.port", "") == "COM3");
+    CHECK(t.GetOr<int>("Serial.baud", 0) == 115200);
+    CHECK(t.GetOr<double>("Camera.exposure", 0) == 1200.0);
+    CHECK(t.GetOr<bool>("Camera.enable", true) == false);
+    CHECK(t.GetOr<std::string>("Camera.name", "") == "cam #1");
+}
+
+TEST_CASE("Config typed get and key cache")
+{
+    Utils_Config cfg;
+    Utils_ConfigKey width("RunPara.Image.Polar.nImgWidth", cfg);
+    CHECK(cfg.Generation() == 0);
+    CHECK(width.GetOr(-1) == -1);
+    CHECK_THROWS(width.Get<int>());
+
+    cfg.LoadString(kYml);
+    CHECK(cfg.Generation() == 1);
+    CHECK(cfg.Get<int>("RunPara.Image.Polar.nImgWidth") == 1280);
+    CHECK(width.Get<int>() == 1280);
+    CHECK(width.Get<int>() == 1280);
+    CHECK_THROWS(cfg.Get<int>("RunPara.sPath"));
+
+    // 旧表的引用在重新加载之后仍然有效
+    const Utils_ConfigTable &old = cfg.Table();
+    cfg.LoadString("RunPara:\n  Image:\n    Polar:\n      nImgWidth: 640\n");
+    CHECK(width.Get<int>() == 640);
+    CHECK(old.GetOr<int>("RunPara.Image.Polar.nImgWidth", 0) == 1280);
+    cfg.LoadString("other: 1\n");
+    CHECK(width.GetOr(-1) == -1);
+
+    bool thrown = false;
+    try
+    {
+        cfg.Get<int>("missing");
+    }
+    catch (const Utils_Exception &e)
+    {
+        thrown = e.mi_ErrorCode_ == Error_YML_FileNode_NoExist;
+    }
+    CHECK(thrown);
+}
+
+TEST_CASE("Config load file and hot reload")
+{
+    const char *file = "test_utils_config.tmp.yml";
+    auto write = [&](const char *text)
+    {
+        FILE *fp = fopen(file, "wb");
+        fputs(text, fp);
+        fclose(fp);
+    };
+
+    Utils_Config cfg;
+    CHECK_THROWS(cfg.Load("not_exist_config.yml"));
+    CHECK_FALSE(cfg.Reload());
+    CHECK_FALSE(cfg.Watch(10));
+
+    write("a: 1\n");
+    cfg.Load(file);
+    CHECK(cfg.Get<int>("a") == 1);
+
+    int called = 0;
+    cfg.SetReloadCallback([](void *ctx, const Utils_ConfigTable &) { ++*static_cast<int *>(ctx); }, &called);
+    CHECK(cfg.Watch(10));
+    CHECK_FALSE(cfg.Watch(10));
+
+    // 读取方在另一个线程中不断读取, 改写文件的过程中可能读到空文件 (没有 a)
+    Utils_ConfigKey a("a", cfg);
+    std::atomic<bool> stop(false);
+    std::atomic<int> bad(0);
+    std::thread reader([&]()
+    {
+        while (!stop.load())
+        {
+            int v = a.GetOr(0);
+            if (v != 0 && v != 1 && v != 22)
+                bad++;
+        }
+    });
+
+    write("a: 22\n");
+    for (int i = 0; i < 500 && a.GetOr(0) != 22; i++)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    stop = true;
+    reader.join();
+    cfg.StopWatch();
+
+    CHECK(a.GetOr(0) == 22);
+    CHECK(called >= 1);
+    CHECK(bad == 0);
+
+    // 文件删除之后 Reload 失败 保留当前的表
+    remove(file);
+    CHECK_FALSE(cfg.Reload());
+    CHECK(cfg.Get<int>("a") == 22);
+}
@@ -0,0 +1,138 @@
+// 单元测试
+#include "./utils_csv.h"
+#include "./utils_mmap.h"
+
+#include <stdio.h>
+#include <mutex>
+#include <string>
+#include <vector>
+
+typedef std::vector<std::string> Fields;
+typedef std::vector<Fields> Table;
+
+static Table ParseAll(std::string_view data, const Utils_Csv::Options &opt = Utils_Csv::Options())
+{
+    Table res;
+    Utils_Csv::Parse(data, opt, [&](const Utils_CsvRow &row) {
+        std::vector<std::string> fields;
+        for (size_t i = 0; i < row.size(); i++)
+            fields.emplace_back(row[i]);
+        res.push_back(fields);
+    });
+    return res;
+}
+
+TEST_CASE("Csv Parse Plain")
+{
+    Table t = ParseAll("a,b,c\n1,,3\r\n\n4,5,6");
+    REQUIRE(t.size() == 3);
+    CHECK((t[0] == Fields{ "a", "b", "c" }));
+    CHECK((t[1] == Fields{ "1", "", "3" }));
+    CHECK((t[2] == Fields{ "4", "5", "6" }));
+
+    Utils_Csv::Options tsv;
+    tsv.sep = '\t';
+    t = ParseAll("x\ty\n1\t2\t\n", tsv);
+    REQUIRE(t.size() == 2);
+    CHECK((t[1] == Fields{ "1", "2", "" }));
+}
+
+TEST_CASE("Csv Parse Quoted")
+{
+    Table t = ParseAll("id,msg\n1,\"hello, world\"\n2,\"say \"\"hi\"\"\"\n3,\"two\nlines\",end\r\n");
+    REQUIRE(t.size() == 4);
+    CHECK((t[1] == Fields{ "1", "hello, world" }));
+    CHECK((t[2] == Fields{ "2", "say \"hi\"" }));
+    CHECK((t[3] == Fields{ "3", "two\nlines", "end" }));
+
+    // 未闭合的引号 读到结尾
+    t = ParseAll("1,\"open");
+    REQUIRE(t.size() == 1);
+    CHECK(t[0][1] == "open");
+}
+
+TEST_CASE("Csv Typed Get")
+{
+    size_t rows = 0;
+    Utils_Csv::Parse("42, -3.5 ,true,abc,+7\n", Utils_Csv::Options(), [&](const Utils_CsvRow &row) {
+        int i = 0;
+        double d = 0;
+        bool b = false;
+        std::string s;
+        CHECK(row.Get(0, i));
+        CHECK(i == 42);
+        CHECK(row.Get(1, d));
+        CHECK(d == -3.5);
+        CHECK(row.Get(2, b));
+        CHECK(b);
+        CHECK(row.Get(3, s));
+        CHECK(s == "abc");
+        CHECK(row.GetOr(4, 0) == 7);
+        CHECK_FALSE(row.Get(3, i));
+        CHECK(row.GetOr(3, -1) == -1);
+        CHECK(row.GetOr(9, 5) == 5);
+        rows++;
+    });
+    CHECK(rows == 1);
+}
+
+TEST_CASE("Csv Writer Reader Roundtrip")
+{
+    const char *file = "test_utils_csv.tmp.csv";
+    Utils_Csv::Options opt;
+    opt.header = true;
+    {
+        Utils_CsvWriter writer(opt, 4096);
+        REQUIRE(writer.Open(file));
+        writer.Row("time", "temp", "note");
+        for (int i = 0; i < 1000; i++)
+            writer.Row(i, i * 0.5, i % 100 == 0 ? "a,\"b\"\nc" : "ok");
+        CHECK(writer.Close());
+    }
+
+    Utils_CsvReader reader(opt);
+    REQUIRE(reader.Open(file));
+    REQUIRE(reader.Header().size() == 3);
+    int col = reader.Column("temp");
+    CHECK(col == 1);
+    CHECK(reader.Column("none") == -1);
+    size_t bad = 0;
+    size_t n = reader.ForEach([&](const Utils_CsvRow &row) {
+        int t = row.GetOr(0, -1);
+        if (t != static_cast<int>(row.Index()) || row.GetOr(col, -1.0) != t * 0.5)
+            bad++;
+        if (row[2] != (t % 100 == 0 ? "a,\"b\"\nc" : "ok"))
+            bad++;
+    });
+    CHECK(n == 1000);
+    CHECK(bad == 0);
+    remove(file);
+}
+
+TEST_CASE("Csv Parse Parallel")
+{
+    // 3MB 左右 含跨行的引号字段, 多线程结果和单线程一致
+    std::string data;
+    for (int i = 0; data.size() < (3 << 20); i++)
+    {
+        Utils_Format::AppendInt(data, i);
+        data += (i % 7 == 0) ? ",\"multi\nline \"\"q\"\"\",x\n" : ",plain,x\n";
+    }
+    Utils_Csv::Options opt;
+    Table serial = ParseAll(data, opt);
+
+    std::vector<Table> parts(4);
+    std::mutex lock;
+    size_t n = Utils_Csv::ParseParallel(data, opt, 4, [&](const Utils_CsvRow &row, int worker) {
+        std::vector<std::string> fields;
+        for (size_t i = 0; i < row.size(); i++)
+            fields.emplace_back(row[i]);
+        std::lock_guard<std::mutex> guard(lock);
+        parts[worker].push_back(fields);
+    });
+    Table merged;
+    for (Table &p : parts)
+        merged.insert(merged.end(), p.begin(), p.end());
+    CHECK(n == serial.size());
+    CHECK(merged == serial);
+}
@@ -0,0 +1,75 @@
+// 单元测试
+#include "./utils_encoding.h"
+
+#include <string>
+
+TEST_CASE("Encoding Ascii")
+{
+    std::string str(100, 'a');
+    CHECK(Utils_Encoding::IsAscii(str));
+    CHECK(Utils_Encoding::AsciiPrefix(str.data(), str.size()) == 100);
+    str[37] = '\xC3';
+    CHECK_FALSE(Utils_Encoding::IsAscii(str));
+    CHECK(Utils_Encoding::AsciiPrefix(str.data(), str.size()) == 37);
+    CHECK(Utils_Encoding::IsAscii(""));
+}
+
+TEST_CASE("Encoding Utf8 Validate")
+{
+    CHECK(Utils_Encoding::IsUtf8("plain ascii text, long enough to hit the vector path"));
+    CHECK(Utils_Encoding::IsUtf8("D:/数据/相机_01/图像_0001.bmp"));
+    CHECK(Utils_Encoding::IsUtf8("\xF0\x9F\x98\x80 emoji"));
+    CHECK(Utils_Encoding::IsUtf8("\xF4\x8F\xBF\xBF"));           // U+10FFFF
+
+    CHECK_FALSE(Utils_Encoding::IsUtf8("\xC0\x80"));             // 过长编码
+    CHECK_FALSE(Utils_Encoding::IsUtf8("\xE0\x80\xAF"));         // 过长编码
+    CHECK_FALSE(Utils_Encoding::IsUtf8("\xED\xA0\x80"));         // 代理区
+    CHECK_FALSE(Utils_Encoding::IsUtf8("\xF4\x90\x80\x80"));     // 超过 U+10FFFF
+    CHECK_FALSE(Utils_Encoding::IsUtf8("\xE4\xB8"));             // 截断
+    CHECK_FALSE(Utils_Encoding::IsUtf8("\x80"));
+
+    // GBK 的 "中文" 不是合法的 UTF-8
+    CHECK(Utils_Encoding::Utf8ValidPrefix("abc\xD6\xD0\xCE\xC4") == 3);
+}
+
+TEST_CASE("Encoding Utf8 Utf16")
+{
+    std::string src = "log: 相机 01 打开成功 \xF0\x9F\x98\x80, 0123456789abcdefghij";
+    std::u16string wide;
+    CHECK(Utils_Encoding::Utf8ToUtf16(src, wide));
+    CHECK(wide.substr(0, 5) == u"log: ");
+    CHECK(wide.substr(5, 2) == u"相机");
+    CHECK(wide.find(u"\U0001F600") != std::u16string::npos);
+
+    std::string back;
+    CHECK(Utils_Encoding::Utf16ToUtf8(wide, back));
+    CHECK(back == src);
+
+    // 非法输入替换为 U+FFFD
+    CHECK_FALSE(Utils_Encoding::Utf8ToUtf16("a\xFF" "b", wide));
+    CHECK(wide == u"a\uFFFDb");
+    std::u16string lone = u"x";
+    lone.push_back(static_cast<char16_t>(0xD800));
+    CHECK_FALSE(Utils_Encoding::Utf16ToUtf8(lone, back));
+    CHECK(back == "x\xEF\xBF\xBD");
+}
+
+TEST_CASE("Encoding Gbk Utf8")
+{
+    // "中文" GBK: D6 D0 CE C4
+    std::string utf8;
+    CHECK(Utils_Encoding::GbkToUtf8("path/\xD6\xD0\xCE\xC4.txt", utf8));
+    CHECK(utf8 == "path/中文.txt");
+
+    std::string gbk;
+    CHECK(Utils_Encoding::Utf8ToGbk(utf8, gbk));
+    CHECK(gbk == "path/\xD6\xD0\xCE\xC4.txt");
+
+    // 第二个字节在 ASCII 范围: "丂" GBK 81 40
+    CHECK(Utils_Encoding::GbkToUtf8("\x81\x40" "a", utf8));
+    CHECK(utf8 == "丂a");
+
+    // GBK 无法表示的字符
+    CHECK_FALSE(Utils_Encoding::Utf8ToGbk("a\xF0\x9F\x98\x80" "b", gbk));
+    CHECK(gbk == "a?b");
+}
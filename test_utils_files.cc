@@ -1,6 +1,10 @@
 #include "./utils_files.h"
 #include "./utils_string.h"
 
+#include <stdio.h>
+#include <fstream>
+#include <string>
+
 TEST_CASE("ListAllFiles")
 {
 #if 0
@@ -31,4 +35,81 @@ TEST_CASE("ListAllFiles")
     CHECK(res[1] == "test_utils_files");
     CHECK(res[2] == "test_utils_files");
 #endif
-}
\ No newline at end of file
+}
+TEST_CASE("ReadStringBinary")
+{
+    // 定长字段 没有 '\0' 时只读 len 个字节
+    const char *file = "test_utils_files_binary.tmp";
+    {
+        std::ofstream out(file, std::ios::binary);
+        out.write("abcd", 4);
+        out.write("ef\0\0", 4);
+    }
+    std::fstream in(file, std::ios::in | std::ios::binary);
+    std::string str;
+    CHECK(Utils_Files::ReadStringBinary(&in, str, 4));
+    CHECK(str == "abcd");
+    CHECK(Utils_Files::ReadStringBinary(&in, str, 4));
+    CHECK(str == "ef");
+    CHECK_FALSE(Utils_Files::ReadStringBinary(&in, str, 4));
+    CHECK(str.empty());
+    CHECK_FALSE(Utils_Files::ReadStringBinary(nullptr, str, 4));
+    in.close();
+    remove(file);
+}
+
+TEST_CASE("WriteStringBinary")
+{
+    // 不足补 '\0', 超长截断
+    const char *file = "test_utils_files_write.tmp";
+    {
+        std::fstream out(file, std::ios::out | std::ios::binary);
+        CHECK(Utils_Files::WriteStringBinary(&out, "ab", 4));
+        CHECK(Utils_Files::WriteStringBinary(&out, "abcdef", 3));
+        CHECK_FALSE(Utils_Files::WriteStringBinary(nullptr, "ab", 4));
+    }
+    std::ifstream in(file, std::ios::binary);
+    std::string all((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    CHECK(all == std::string("ab\0\0abc", 7));
+    in.close();
+    remove(file);
+}
+
+TEST_CASE("WriteStringTxt")
+{
+    const char *file = "test_utils_files_txt.tmp";
+    CHECK_FALSE(Utils_Files::WriteStringTxt(nullptr, "line"));
+    std::fstream closed;
+    CHECK_FALSE(Utils_Files::WriteStringTxt(&closed, "line"));
+    {
+        std::fstream out(file, std::ios::out | std::ios::trunc);
+        CHECK(Utils_Files::WriteStringTxt(&out, "a"));
+        CHECK(Utils_Files::WriteStringTxt(&out, "b"));
+    }
+    std::ifstream in(file, std::ios::binary);
+    std::string all((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    CHECK(all == "a\nb\n");
+    in.close();
+    remove(file);
+}
+
+TEST_CASE("GetFileName SplitFileName")
+{
+    CHECK(Utils_Files::GetFileName("D:\\Code\\utils\\test_utils_files.cc") == "test_utils_files");
+    CHECK(Utils_Files::GetFileName("D:/v1.2/test_utils_files") == "test_utils_files");
+    CHECK(Utils_Files::GetFileName("test_utils_files") == "test_utils_files");
+
+    std::string name, path;
+    CHECK(Utils_Files::SplitFileName(name, path, "data/cam.0/img.png"));
+    CHECK(path == "data/cam.0/");
+    CHECK(name == "img");
+    CHECK(Utils_Files::SplitFileName(name, path, "D:\\data\\img"));
+    CHECK(path == "D:\\data\\");
+    CHECK(name == "img");
+    CHECK(Utils_Files::SplitFileName(name, path, "img.png"));
+    CHECK(path == "./");
+    CHECK(name == "img");
+    CHECK(Utils_Files::SplitFileName(name, path, "a/b"));
+    CHECK(path == "a/");
+    CHECK(name == "b");
+}
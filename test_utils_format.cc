@@ -0,0 +1,163 @@
+// 单元测试
+#include "./utils_format.h"
+#include "./utils_string.h"
+
+#include <climits>
+
+TEST_CASE("Format Int")
+{
+    char buf[Utils_Format::kIntBufSize];
+    size_t n = Utils_Format::FormatInt(buf, sizeof(buf), 0);
+    CHECK(std::string(buf, n) == "0");
+    n = Utils_Format::FormatInt(buf, sizeof(buf), 314, 6, 16);
+    CHECK(std::string(buf, n) == "00013A");
+    n = Utils_Format::FormatInt(buf, sizeof(buf), -42, 5);
+    CHECK(std::string(buf, n) == "-0042");
+    n = Utils_Format::FormatInt(buf, sizeof(buf), LLONG_MIN);
+    CHECK(std::string(buf, n) == "-9223372036854775808");
+    n = Utils_Format::FormatUInt(buf, sizeof(buf), 35, 0, 36, false);
+    CHECK(std::string(buf, n) == "z");
+
+    // 非法进制 或 缓冲区不足
+    CHECK(Utils_Format::FormatInt(buf, sizeof(buf), 1, 0, 1) == 0);
+    CHECK(Utils_Format::FormatInt(buf, 2, 123) == 0);
+}
+
+TEST_CASE("Format Append")
+{
+    std::string str = "id:";
+    Utils_Format::AppendInt(str, 7, 3);
+    str += ' ';
+    Utils_Format::AppendUInt(str, 0xBEEF, 0, 16, false);
+    str += ' ';
+    Utils_Format::AppendFloat(str, 3.1415926, 3);
+    CHECK(str == "id:007 beef 3.142");
+
+    std::string wide;
+    Utils_Format::AppendInt(wide, -5, 100);
+    CHECK(wide.size() == 100);
+    CHECK(wide.front() == '-');
+    CHECK(wide.back() == '5');
+
+    std::string big;
+    Utils_Format::AppendFloat(big, 1e300, 1);
+    CHECK(big.size() == 303);
+}
+
+TEST_CASE("NumToString use Utils_Format")
+{
+    CHECK(Utils_String::NumToString(0, 3) == "000");
+    CHECK(Utils_String::NumToString(0, 0) == "0");
+    CHECK(Utils_String::NumToString(-7, 3) == "-07");
+    CHECK(Utils_String::NumToString(255, 2, 16) == "FF");
+    CHECK(Utils_String::Num2Hex((uchar)171, false) == "ab");
+    CHECK(Utils_String::NumToString(2.5f, 0) == "2");
+}
+
+TEST_CASE("HexDump")
+{
+    const char *text = "Hello, World!\n\x00\x01\x7f\xff";
+    std::string dump;
+    Utils_Format::HexDump(dump, text, 18);
+    CHECK(dump ==
+          "00000000  48 65 6c 6c 6f 2c 20 57  6f 72 6c 64 21 0a 00 01  |Hello, World!...|\n"
+          "00000010  7f ff                                             |..|\n"
+          "00000012\n");
+
+    // sink 分块输出 与 字符串输出一致
+    std::vector<uchar> data(5000);
+    for (size_t i = 0; i < data.size(); i++)
+        data[i] = static_cast<uchar>(i * 7);
+    std::string a, b;
+    Utils_Format::HexDump(a, data.data(), data.size(), 0x100);
+    Utils_Format::HexDump(Utils_Format::StringSink(&b), data.data(), data.size(), 0x100);
+    CHECK(a == b);
+    CHECK(a.compare(0, 10, "00000100  ") == 0);
+}
+
+TEST_CASE("ShowCharArr")
+{
+    uchar buffer[] = { 0x68, 0x13, 0x00, 0xFF };
+    CHECK(Utils_String::ShowCharArr(buffer, 4) == "68 13 00 FF ");
+    CHECK(Utils_String::ShowCharArr(buffer) == "68 13 ");
+    std::string str("\x0a\xab", 2);
+    CHECK(Utils_String::ShowCharArr(&str) == "0A AB ");
+}
+
+TEST_CASE("Format Print Range")
+{
+    std::string out;
+    std::vector<int> vec = { 3, -1, 42 };
+    Utils_Format::Print(Utils_Format::StringSink(&out), vec);
+    CHECK(out == "3 -1 42\n");
+
+    out.clear();
+    Utils_Format::PrintOptions opt;
+    opt.index = true;
+    opt.sep = ", ";
+    opt.end = "";
+    std::vector<double> dv = { 0.5, 1.25 };
+    Utils_Format::Print(Utils_Format::StringSink(&out), dv, opt);
+    CHECK(out == "[0] 0.5, [1] 1.25");
+
+    // 头尾截断 下标保持原始位置
+    out.clear();
+    std::vector<int> big(10);
+    for (int i = 0; i < 10; i++)
+        big[i] = i * 10;
+    opt.head = 2;
+    opt.tail = 1;
+    Utils_Format::Print(Utils_Format::StringSink(&out), big, opt);
+    CHECK(out == "[0] 0, [1] 10, ... (7 omitted), [9] 90");
+
+    out.clear();
+    opt.tail = 0;
+    opt.index = false;
+    Utils_Format::Print(Utils_Format::StringSink(&out), big, opt);
+    CHECK(out == "0, 10, ... (8 omitted)");
+
+    out.clear();
+    std::vector<std::string> sv = { "a", "bc" };
+    Utils_Format::Print(Utils_Format::StringSink(&out), sv);
+    CHECK(out == "a bc\n");
+
+    out.clear();
+    Utils_Format::Print(Utils_Format::StringSink(&out), std::vector<int>());
+    CHECK(out == "Vector is Null\n");
+
+    // 超过 Writer 缓冲区 分块写出
+    out.clear();
+    std::vector<unsigned> many(5000, 12345);
+    size_t n = Utils_Format::Print(Utils_Format::StringSink(&out), many);
+    CHECK(n == 5000 * 6);
+    CHECK(out.size() == n);
+    CHECK(out.compare(out.size() - 7, 7, " 12345\n") == 0);
+}
+
+TEST_CASE("Format Writer wide int")
+{
+    // 宽度超过 kIntBufSize 时 原来整个数字被丢掉
+    std::string out;
+    {
+        Utils_Format::Writer w(Utils_Format::StringSink(&out));
+        w.PutInt(-42, 66);
+        w.Put(' ');
+        w.PutInt(-42, 100);
+        w.Put(' ');
+        w.PutUInt(7, 5000);
+        w.Put(' ');
+        w.PutInt(12345, 3);
+    }
+    CHECK(out == "-" + std::string(63, '0') + "42 -" + std::string(97, '0') + "42 " + std::string(4999, '0') + "7 12345");
+}
+
+TEST_CASE("String CoutVector")
+{
+    std::string out;
+    std::vector<int> vec = { 1, 2 };
+    Utils_String::CoutVectorIdx(vec, true, Utils_Format::StringSink(&out));
+    CHECK(out == "\tidx:0\t:1\n\tidx:1\t:2\n");
+    out.clear();
+    Utils_String::CoutVector(vec, false, Utils_Format::StringSink(&out));
+    CHECK(out == "1 2\n");
+}
@@ -0,0 +1,109 @@
+// 单元测试
+#include "./utils_glob.h"
+
+#include <random>
+#include <string>
+#include <vector>
+
+// 递归的参考实现  只支持 * ? 和普通字符, 用于随机对比
+static bool NaiveGlob(const char *p, const char *s)
+{
+    if (*p == '\0')
+        return *s == '\0';
+    if (*p == '*')
+        return NaiveGlob(p + 1, s) || (*s != '\0' && NaiveGlob(p, s + 1));
+    if (*s == '\0')
+        return false;
+    return (*p == '?' || *p == *s) && NaiveGlob(p + 1, s + 1);
+}
+
+TEST_CASE("Glob basic")
+{
+    CHECK(Utils_Glob("*.jpg").Match("IMG_0001.jpg"));
+    CHECK_FALSE(Utils_Glob("*.jpg").Match("IMG_0001.JPG"));
+    CHECK(Utils_Glob("*.jpg", true).Match("IMG_0001.JPG"));
+    CHECK_FALSE(Utils_Glob("*.jpg").Match("IMG_0001.jpg.bak"));
+    CHECK(Utils_Glob("IMG_????.bmp").Match("IMG_0001.bmp"));
+    CHECK_FALSE(Utils_Glob("IMG_????.bmp").Match("IMG_001.bmp"));
+    CHECK(Utils_Glob("*").Match(""));
+    CHECK(Utils_Glob("").Match(""));
+    CHECK_FALSE(Utils_Glob("").Match("a"));
+    CHECK(Utils_Glob("a*b*c").Match("abc"));
+    CHECK(Utils_Glob("a*b*c").Match("axxbyybzzc"));
+    CHECK_FALSE(Utils_Glob("a*b*c").Match("axxbyybzzcd"));
+    CHECK(Utils_Glob("*ab*ab*").Match("xabyab"));
+    CHECK_FALSE(Utils_Glob("*ab*ab*").Match("xaby"));
+    CHECK(Utils_Glob("**a***").Match("a"));
+    CHECK(Utils_Glob("*aab").Match("aaab"));
+}
+
+TEST_CASE("Glob sets and braces")
+{
+    Utils_Glob img("*.{jpg,png,bmp}", true);
+    CHECK(img.Match("a.jpg"));
+    CHECK(img.Match("a.PNG"));
+    CHECK(img.Match("a.Bmp"));
+    CHECK_FALSE(img.Match("a.tif"));
+
+    CHECK(Utils_Glob("frame_[0-9][0-9].bin").Match("frame_07.bin"));
+    CHECK_FALSE(Utils_Glob("frame_[0-9][0-9].bin").Match("frame_7a.bin"));
+    CHECK(Utils_Glob("[!.]*").Match("data.csv"));
+    CHECK_FALSE(Utils_Glob("[!.]*").Match(".hidden"));
+    CHECK(Utils_Glob("[^a-c]").Match("d"));
+    CHECK(Utils_Glob("[]]").Match("]"));
+    CHECK(Utils_Glob("[*]").Match("*"));
+    CHECK_FALSE(Utils_Glob("[*]").Match("a"));
+    CHECK(Utils_Glob("[a-z]", true).Match("Q"));
+    CHECK_FALSE(Utils_Glob("[!a-z]", true).Match("Q"));
+
+    // 嵌套 和 不配对的括号
+    Utils_Glob nested("log_{a,b{1,2}}.txt");
+    CHECK(nested.Match("log_a.txt"));
+    CHECK(nested.Match("log_b1.txt"));
+    CHECK(nested.Match("log_b2.txt"));
+    CHECK_FALSE(nested.Match("log_b.txt"));
+    CHECK(Utils_Glob("a{b").Match("a{b"));
+    CHECK(Utils_Glob("a[b").Match("a[b"));
+    CHECK(Utils_Glob("{,x}y").Match("y"));
+    CHECK(Utils_Glob("{,x}y").Match("xy"));
+    CHECK(Utils_Glob("{[,]}").Match(","));
+
+    // 展开个数上限
+    Utils_Glob huge;
+    CHECK_FALSE(huge.Compile("{a,b}{a,b}{a,b}{a,b}{a,b}{a,b}{a,b}{a,b}{a,b}"));
+    CHECK_FALSE(huge.IsValid());
+    CHECK_FALSE(huge.Match("aaaaaaaaa"));
+}
+
+TEST_CASE("Glob file names")
+{
+    Utils_Glob glob("*.csv");
+    CHECK(glob.MatchFileName("D:\\data\\log.csv"));
+    CHECK(glob("/home/iris/data/log.csv"));
+    CHECK_FALSE(glob.MatchFileName("D:\\data.csv\\log.txt"));
+
+    std::vector<std::string> files = { "a\\1.csv", "a\\2.txt", "b/3.csv", "4.CSV" };
+    CHECK(glob.Filter(files) == 2);
+    CHECK(files[0] == "a\\1.csv");
+    CHECK(files[1] == "b/3.csv");
+}
+
+TEST_CASE("Glob random compare with naive")
+{
+    std::mt19937 rng(2019);
+    const char pat_chars[] = "ab*?";
+    for (int round = 0; round < 5000; round++)
+    {
+        std::string p, s;
+        size_t plen = rng() % 8, slen = rng() % 10;
+        for (size_t i = 0; i < plen; i++)
+            p.push_back(pat_chars[rng() % 4]);
+        for (size_t i = 0; i < slen; i++)
+            s.push_back("ab"[rng() % 2]);
+        CHECK(Utils_Glob(p).Match(s) == NaiveGlob(p.c_str(), s.c_str()));
+    }
+
+    // 病态模式 不回溯
+    std::string s(10000, 'a');
+    CHECK_FALSE(Utils_Glob("*a*a*a*a*a*a*a*a*b").Match(s));
+}
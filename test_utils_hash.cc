@@ -0,0 +1,167 @@
+// 单元测试
+#include "./utils_hash.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+static std::vector<uint8_t> MakeData(size_t n, uint32_t seed)
+{
+    std::vector<uint8_t> data(n);
+    for (size_t i = 0; i < n; i++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        data[i] = static_cast<uint8_t>(seed >> 24);
+    }
+    return data;
+}
+
+TEST_CASE("Hash one-shot")
+{
+    const std::vector<uint8_t> data = MakeData(5000, 1);
+
+    // 每个长度 (覆盖所有短路径和长路径的边界) 结果不同且可重复
+    std::set<uint64_t> seen64;
+    std::set<Utils_Hash128> seen128;
+    for (size_t n = 0; n <= 2100; n++)
+    {
+        const uint64_t h = Utils_Hash::Hash64(data.data(), n);
+        CHECK(h == Utils_Hash::Hash64(data.data(), n));
+        seen64.insert(h);
+        seen128.insert(Utils_Hash::Hash128(data.data(), n));
+    }
+    CHECK(seen64.size() == 2101);
+    CHECK(seen128.size() == 2101);
+
+    CHECK(Utils_Hash::Hash64(std::string_view("hello")) == Utils_Hash::Hash64("hello", 5));
+    CHECK(Utils_Hash::Hash64("hello", 5, 1) != Utils_Hash::Hash64("hello", 5));
+    CHECK(Utils_Hash::Hash128("", 0, 1) != Utils_Hash::Hash128("", 0));
+
+    // 结果与平台和指令集无关
+    CHECK(Utils_Hash::Hash64("", 0) == 0xA7D945E0B48FD464ULL);
+    CHECK(Utils_Hash::Hash64(data.data(), 100) == 0xB83A0772F2C9225EULL);
+    CHECK(Utils_Hash::Hash64(data.data(), 5000) == 0x27CEE70B99748EF0ULL);
+    CHECK(Utils_Hash::Hash128(data.data(), 5000).high == 0x121A0A172498177BULL);
+}
+
+TEST_CASE("Hash bit flip")
+{
+    for (size_t n : { 3, 8, 16, 100, 200, 240, 241, 1000, 4096 })
+    {
+        std::vector<uint8_t> data = MakeData(n, static_cast<uint32_t>(n));
+        const Utils_Hash128 base = Utils_Hash::Hash128(data.data(), n);
+        std::set<uint64_t> seen = { base.low };
+        for (size_t i = 0; i < n * 8; i += 7)
+        {
+            data[i / 8] ^= static_cast<uint8_t>(1u << (i % 8));
+            const Utils_Hash128 h = Utils_Hash::Hash128(data.data(), n);
+            CHECK(h.low != base.low);
+            CHECK(h.high != base.high);
+            seen.insert(h.low);
+            data[i / 8] ^= static_cast<uint8_t>(1u << (i % 8));
+        }
+        CHECK(seen.size() == 1 + (n * 8 + 6) / 7);
+    }
+}
+
+TEST_CASE("Hasher streaming")
+{
+    const std::vector<uint8_t> data = MakeData(20000, 2);
+    for (size_t n : { 0, 1, 17, 240, 241, 256, 257, 320, 1024, 1087, 1088, 1089, 5000, 20000 })
+    {
+        const uint64_t h64 = Utils_Hash::Hash64(data.data(), n, 7);
+        const Utils_Hash128 h128 = Utils_Hash::Hash128(data.data(), n, 7);
+        for (size_t chunk : { 1, 7, 64, 255, 256, 1000, 30000 })
+        {
+            Utils_Hasher hasher(7);
+            for (size_t off = 0; off < n; off += chunk)
+                hasher.Update(data.data() + off, std::min(chunk, n - off));
+            CHECK(hasher.size() == n);
+            CHECK(hasher.Digest64() == h64);
+            CHECK(hasher.Digest128() == h128);
+        }
+    }
+
+    // Digest 后可以继续 Update
+    Utils_Hasher hasher;
+    hasher.Update(data.data(), 300);
+    CHECK(hasher.Digest64() == Utils_Hash::Hash64(data.data(), 300));
+    hasher.Update(data.data() + 300, 700);
+    CHECK(hasher.Digest64() == Utils_Hash::Hash64(data.data(), 1000));
+    hasher.Reset(3);
+    hasher.Update(std::string_view("abc"));
+    CHECK(hasher.Digest64() == Utils_Hash::Hash64("abc", 3, 3));
+}
+
+static void WriteBytes(const fs::path &path, const std::vector<uint8_t> &data)
+{
+    std::ofstream(path, std::ios::binary).write(reinterpret_cast<const char *>(data.data()),
+                                                static_cast<std::streamsize>(data.size()));
+}
+
+TEST_CASE("Dedup find")
+{
+    const fs::path root = fs::temp_directory_path() / "test_utils_hash";
+    fs::remove_all(root);
+    fs::create_directories(root / "x" / "y");
+
+    const std::vector<uint8_t> small = MakeData(100, 3);
+    std::vector<uint8_t> other = small;
+    other[50] ^= 1;
+    const std::vector<uint8_t> big = MakeData(50000, 4);
+    std::vector<uint8_t> middle = big;
+    middle[25000] ^= 1;
+
+    WriteBytes(root / "a.bin", small);
+    WriteBytes(root / "x" / "b.bin", small);
+    WriteBytes(root / "c.bin", other);                   // 大小相同 内容不同
+    WriteBytes(root / "d.bin", big);
+    WriteBytes(root / "x" / "y" / "e.bin", big);
+    WriteBytes(root / "f.bin", middle);                  // 开头结尾相同 中间不同
+    WriteBytes(root / "g.bin", MakeData(777, 5));        // 大小唯一
+    WriteBytes(root / "empty1", {});
+    WriteBytes(root / "empty2", {});
+
+    Utils_Dedup::Options opt;
+    opt.threads = 4;
+    Utils_Dedup::Stats stats;
+    const std::vector<Utils_DuplicateGroup> groups = Utils_Dedup::Find({ root.string() }, opt, &stats);
+    REQUIRE(groups.size() == 2);
+    CHECK(groups[0].size == big.size());
+    CHECK(groups[0].hash == Utils_Hash::Hash128(big.data(), big.size()));
+    REQUIRE(groups[0].files.size() == 2);
+    CHECK(fs::path(groups[0].files[0]).filename() == "d.bin");
+    CHECK(fs::path(groups[0].files[1]).filename() == "e.bin");
+    CHECK(groups[1].size == small.size());
+    REQUIRE(groups[1].files.size() == 2);
+    CHECK(fs::path(groups[1].files[0]).filename() == "a.bin");
+    CHECK(fs::path(groups[1].files[1]).filename() == "b.bin");
+
+    CHECK(stats.files == 7);
+    CHECK(stats.edge_hashed == 6);
+    CHECK(stats.full_hashed == 3);                       // 只有 d e f 需要整个哈希
+    CHECK(stats.errors == 0);
+
+    Utils_Hash128 h;
+    CHECK(Utils_Hash::HashFile((root / "f.bin").string(), h));
+    CHECK(h == Utils_Hash::Hash128(middle.data(), middle.size()));
+    CHECK_FALSE(Utils_Hash::HashFile((root / "missing").string(), h));
+
+    // 空文件  重复的路径只算一次  不存在的文件计入 errors
+    opt.min_size = 0;
+    const std::vector<Utils_DuplicateGroup> listed = Utils_Dedup::FindInFiles(
+        { (root / "empty1").string(), (root / "empty2").string(), (root / "a.bin").string(),
+          (root / "a.bin").string(), (root / "missing").string() }, opt, &stats);
+    REQUIRE(listed.size() == 1);
+    CHECK(listed[0].size == 0);
+    CHECK(listed[0].files.size() == 2);
+    CHECK(stats.files == 3);
+    CHECK(stats.errors == 1);
+
+    fs::remove_all(root);
+}
@@ -0,0 +1,205 @@
+// 单元测试
+#include "./utils_index.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+// 生成测试目录  root/cam{0..2}/f{0..3}.jpg 以及 root/note.txt
+static std::string MakeIndexTree(const char *name)
+{
+    fs::path root = fs::temp_directory_path() / name;
+    fs::remove_all(root);
+    for (int c = 0; c < 3; c++)
+    {
+        fs::create_directories(root / ("cam" + std::to_string(c)));
+        for (int f = 0; f < 4; f++)
+            std::ofstream(root / ("cam" + std::to_string(c)) / ("f" + std::to_string(f) + ".jpg")) << f;
+    }
+    std::ofstream(root / "note.txt") << "note";
+    return root.string();
+}
+
+static std::string Rel(const char *a, const char *b)
+{
+    return (fs::path(a) / b).string();
+}
+
+static int Count(const std::vector<Utils_FileIndex::Change> &changes, Utils_FileIndex::ChangeKind kind)
+{
+    return static_cast<int>(std::count_if(changes.begin(), changes.end(),
+                                          [kind](const Utils_FileIndex::Change &c) { return c.kind == kind; }));
+}
+
+TEST_CASE("FileIndex rescan and changes")
+{
+    const std::string root = MakeIndexTree("test_utils_index");
+    Utils_FileIndex index(root);
+    CHECK(index.Generation() == 0);
+    CHECK(index.Rescan() == 13);
+    CHECK(index.Generation() == 1);
+    CHECK(index.size() == 13);
+    CHECK(index.Rescan() == 0);
+    CHECK(index.Generation() == 1);
+
+    Utils_FileIndex::Entry e;
+    CHECK(index.Find(Rel("cam1", "f2.jpg"), e));
+    CHECK(e.size == 1);
+    CHECK(e.gen == 1);
+    CHECK_FALSE(index.Find("cam1", e));
+    CHECK(index.FullPath(Rel("cam1", "f2.jpg")) == (fs::path(root) / "cam1" / "f2.jpg").string());
+
+    std::vector<Utils_FileIndex::Change> changes;
+    CHECK(index.ChangesSince(0, changes));
+    CHECK(Count(changes, Utils_FileIndex::kAdded) == 13);
+    CHECK(std::is_sorted(changes.begin(), changes.end(),
+                         [](const Utils_FileIndex::Change &a, const Utils_FileIndex::Change &b) { return a.path < b.path; }));
+
+    // 修改 新增 删除
+    std::ofstream(fs::path(root) / "cam0" / "f0.jpg") << "longer";
+    std::ofstream(fs::path(root) / "cam2" / "new.jpg") << 1;
+    fs::remove(fs::path(root) / "cam1" / "f3.jpg");
+    CHECK(index.Rescan() == 3);
+    CHECK(index.ChangesSince(1, changes));
+    REQUIRE(changes.size() == 3);
+    CHECK(changes[0].path == Rel("cam0", "f0.jpg"));
+    CHECK(changes[0].kind == Utils_FileIndex::kModified);
+    CHECK(changes[1].path == Rel("cam1", "f3.jpg"));
+    CHECK(changes[1].kind == Utils_FileIndex::kRemoved);
+    CHECK(changes[2].path == Rel("cam2", "new.jpg"));
+    CHECK(changes[2].kind == Utils_FileIndex::kAdded);
+    CHECK(changes[2].gen == 2);
+    CHECK(index.ChangesSince(2, changes));
+    CHECK(changes.empty());
+
+    // 合并  新增后删除不报告, 删除后新增为修改
+    std::ofstream(fs::path(root) / "tmp.jpg") << 1;
+    CHECK(index.Rescan() == 1);
+    fs::remove(fs::path(root) / "tmp.jpg");
+    fs::remove(fs::path(root) / "note.txt");
+    CHECK(index.Rescan() == 2);
+    std::ofstream(fs::path(root) / "note.txt") << "again";
+    CHECK(index.Rescan() == 1);
+    CHECK(index.ChangesSince(2, changes));
+    REQUIRE(changes.size() == 1);
+    CHECK(changes[0].path == "note.txt");
+    CHECK(changes[0].kind == Utils_FileIndex::kModified);
+
+    // 日志超过上限  更早的版本无法回答
+    index.SetLogLimit(2);
+    std::ofstream(fs::path(root) / "a.jpg") << 1;
+    std::ofstream(fs::path(root) / "b.jpg") << 1;
+    std::ofstream(fs::path(root) / "c.jpg") << 1;
+    CHECK(index.Rescan() == 3);
+    CHECK_FALSE(index.ChangesSince(4, changes));
+    CHECK(index.ChangesSince(index.Generation(), changes));
+    CHECK(changes.empty());
+
+    // 过滤条件
+    Utils_Walker::Options opt;
+    opt.extensions = { "txt" };
+    Utils_FileIndex txt(root, opt);
+    CHECK(txt.Rescan() == 1);
+    opt.extensions.clear();
+    opt.max_depth = 0;
+    Utils_FileIndex top(root + "/", opt);
+    CHECK(top.Rescan() == 4);
+    fs::remove_all(root);
+}
+
+TEST_CASE("FileIndex snapshot")
+{
+    const std::string root = MakeIndexTree("test_utils_index_snap");
+    const std::string snap = (fs::temp_directory_path() / "test_utils_index.idx").string();
+    {
+        Utils_FileIndex index(root);
+        CHECK_FALSE(index.Load(snap + ".none"));
+        index.Rescan();
+        std::ofstream(fs::path(root) / "cam0" / "x.jpg") << 1;
+        index.Rescan();
+        CHECK(index.Save(snap));
+    }
+
+    // 离线期间的变化 加载后 Rescan 得到
+    fs::remove(fs::path(root) / "note.txt");
+    Utils_FileIndex index(root);
+    CHECK(index.Load(snap));
+    CHECK(index.size() == 14);
+    CHECK(index.Generation() == 2);
+    std::vector<Utils_FileIndex::Change> changes;
+    CHECK(index.ChangesSince(1, changes));
+    REQUIRE(changes.size() == 1);
+    CHECK(changes[0].path == Rel("cam0", "x.jpg"));
+    CHECK(index.Rescan() == 1);
+    CHECK(index.ChangesSince(2, changes));
+    REQUIRE(changes.size() == 1);
+    CHECK(changes[0].kind == Utils_FileIndex::kRemoved);
+
+    // 根目录不同 或 文件损坏
+    Utils_FileIndex other(root + "_other");
+    CHECK_FALSE(other.Load(snap));
+    {
+        std::fstream f(snap, std::ios::in | std::ios::out | std::ios::binary);
+        f.seekp(40);
+        f.put('\x7f');
+    }
+    Utils_FileIndex broken(root);
+    CHECK_FALSE(broken.Load(snap));
+    CHECK(broken.size() == 0);
+    fs::remove(snap);
+    fs::remove_all(root);
+}
+
+#ifdef __linux__
+TEST_CASE("FileIndex inotify")
+{
+    const std::string root = MakeIndexTree("test_utils_index_watch");
+    Utils_Walker::Options opt;
+    opt.extensions = { ".jpg" };
+    Utils_FileIndex index(root, opt);
+    REQUIRE(index.StartWatch());
+    CHECK(index.IsWatching());
+    CHECK(index.Rescan() == 12);
+    CHECK(index.Poll() == 0);
+
+    const fs::path r(root);
+    std::ofstream(r / "cam0" / "new.jpg") << 1;
+    std::ofstream(r / "cam0" / "skip.txt") << 1;
+    std::ofstream(r / "cam1" / "f0.jpg") << "rewrite";
+    fs::remove(r / "cam2" / "f1.jpg");
+    fs::create_directories(r / "cam3" / "sub");
+    std::ofstream(r / "cam3" / "sub" / "a.jpg") << 1;
+    CHECK(index.Poll() == 4);
+    std::vector<Utils_FileIndex::Change> changes;
+    CHECK(index.ChangesSince(1, changes));
+    CHECK(Count(changes, Utils_FileIndex::kAdded) == 2);
+    CHECK(Count(changes, Utils_FileIndex::kModified) == 1);
+    CHECK(Count(changes, Utils_FileIndex::kRemoved) == 1);
+    CHECK(index.size() == 13);
+
+    // 新目录已经监视
+    std::ofstream(r / "cam3" / "sub" / "b.jpg") << 1;
+    CHECK(index.Poll() == 1);
+
+    // 目录移动  旧路径删除, 新路径新增
+    fs::rename(r / "cam3", r / "cam4");
+    CHECK(index.Poll() == 4);
+    Utils_FileIndex::Entry e;
+    CHECK(index.Find(Rel("cam4", "sub/b.jpg"), e));
+    CHECK_FALSE(index.Find(Rel("cam3", "sub/b.jpg"), e));
+    std::ofstream(r / "cam4" / "sub" / "c.jpg") << 1;
+    CHECK(index.Poll() == 1);
+    fs::remove_all(r / "cam4");
+    CHECK(index.Poll() == 3);
+
+    // 与完整扫描一致
+    CHECK(index.Rescan() == 0);
+    index.StopWatch();
+    CHECK_FALSE(index.IsWatching());
+    fs::remove_all(root);
+}
+#endif
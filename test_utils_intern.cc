@@ -0,0 +1,88 @@
+// 单元测试
+#include "./utils_intern.h"
+
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+TEST_CASE("Intern Basic")
+{
+    Utils_InternPool pool(4);
+    CHECK(pool.Size() == 1);
+    CHECK(pool.View(0).empty());
+    CHECK(pool.Intern("") == 0);
+
+    uint32_t a = pool.Intern("camera_01");
+    uint32_t b = pool.Intern(std::string("camera_") + "01");
+    uint32_t c = pool.Intern("camera_02");
+    CHECK(a == b);
+    CHECK(a != c);
+    CHECK(pool.View(a) == "camera_01");
+    CHECK(pool.View(a).data()[9] == '\0');
+
+    uint32_t id = 0;
+    CHECK(pool.Find("camera_02", id));
+    CHECK(id == c);
+    CHECK_FALSE(pool.Find("camera_03", id));
+    CHECK(pool.View(12345).empty());
+
+    // 扩容之后 句柄和 view 保持不变
+    std::string_view va = pool.View(a);
+    for (int i = 0; i < 10000; i++)
+        pool.Intern("img_" + std::to_string(i));
+    CHECK(pool.Size() == 10003);
+    CHECK(pool.Intern("camera_01") == a);
+    CHECK(pool.View(a).data() == va.data());
+    CHECK(pool.View(pool.Intern("img_9999")) == "img_9999");
+}
+
+TEST_CASE("Intern Concurrent")
+{
+    Utils_InternPool pool;
+    const int kThreads = 4;
+    const int kCount = 5000;
+    std::vector<std::vector<uint32_t>> ids(kThreads, std::vector<uint32_t>(kCount));
+    std::vector<std::thread> workers;
+    for (int t = 0; t < kThreads; t++)
+    {
+        workers.emplace_back([&pool, &ids, t, kCount] {
+            // 每个线程以不同顺序插入同一批字符串
+            for (int i = 0; i < kCount; i++)
+            {
+                int k = (i * 7 + t * 1013) % kCount;
+                ids[t][k] = pool.Intern("sensor_" + std::to_string(k));
+            }
+        });
+    }
+    for (std::thread &w : workers)
+        w.join();
+
+    CHECK(pool.Size() == kCount + 1);
+    bool same = true;
+    for (int t = 1; t < kThreads; t++)
+        same = same && ids[t] == ids[0];
+    CHECK(same);
+    CHECK(pool.View(ids[0][42]) == "sensor_42");
+}
+
+TEST_CASE("Interned Handle")
+{
+    Utils_Interned a("Error_YML_FileNotExist");
+    Utils_Interned b(std::string("Error_YML_") + "FileNotExist");
+    CHECK(a == b);
+    CHECK(a.view() == "Error_YML_FileNotExist");
+    CHECK(Utils_Interned().empty());
+
+    std::unordered_map<Utils_Interned, int, Utils_Interned::Hash> cnt;
+    cnt[a]++;
+    cnt[b]++;
+    CHECK(cnt.size() == 1);
+    CHECK(cnt[a] == 2);
+
+    // 池满时的无效句柄
+    Utils_Interned invalid;
+    invalid.id = Utils_InternPool::kInvalid;
+    CHECK(invalid.view().empty());
+    REQUIRE(invalid.c_str() != nullptr);
+    CHECK(std::string(invalid.c_str()).empty());
+}
@@ -0,0 +1,138 @@
+// 单元测试
+#include "./utils_lines.h"
+
+#include <stdio.h>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// std::getline 的划分  去掉行尾 "\r"
+static std::vector<std::string> RefLines(const std::string &data)
+{
+    std::vector<std::string> lines;
+    std::istringstream in(data);
+    for (std::string line; std::getline(in, line);)
+    {
+        if (!line.empty() && line.back() == '\r')
+            line.pop_back();
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+static std::string RandomText(size_t size, unsigned seed)
+{
+    std::mt19937 rng(seed);
+    std::string s;
+    s.reserve(size);
+    while (s.size() < size)
+    {
+        const unsigned r = rng() % 100;
+        if (r < 5)
+            s += '\n';              // 空行
+        else if (r < 8)
+            s += "\r\n";
+        else
+            s.append(rng() % 120, static_cast<char>('a' + rng() % 26)), s += '\n';
+    }
+    return s;
+}
+
+TEST_CASE("LineReader")
+{
+    for (const char *text : { "", "\n", "a", "a\n", "a\nb", "a\r\nb\r\n", "\n\n\n", "\r", "x\r\ry" })
+    {
+        std::vector<std::string> got;
+        Utils_LineReader reader{ std::string_view(text) };
+        for (std::string_view line; reader.Next(line);)
+            got.emplace_back(line);
+        CHECK(got == RefLines(text));
+        CHECK(reader.LineNumber() == got.size());
+        CHECK(Utils_Lines::Count(text) == got.size());
+    }
+
+    // 长短不一的行 跨越 32 字节块
+    for (unsigned seed = 1; seed <= 20; seed++)
+    {
+        std::string data = RandomText(seed * 997, seed);
+        if (seed % 2)
+            data += "no newline at end";
+        std::vector<std::string> ref = RefLines(data);
+        std::vector<std::string> got;
+        Utils_LineReader reader{ std::string_view(data) };
+        for (std::string_view line; reader.Next(line);)
+            got.emplace_back(line);
+        CHECK(got == ref);
+        CHECK(Utils_Lines::Count(data) == ref.size());
+
+        const char *nl = Utils_Lines::FindNewline(data.data(), data.data() + data.size());
+        CHECK(static_cast<size_t>(nl - data.data()) == data.find('\n'));
+    }
+    const char none[] = "no newline in this text which is longer than one block";
+    CHECK(Utils_Lines::FindNewline(none, none + sizeof(none) - 1) == none + sizeof(none) - 1);
+}
+
+TEST_CASE("Lines parallel")
+{
+    std::string data = RandomText(6 << 20, 7);
+    data += "tail";
+    const std::vector<std::string> ref = RefLines(data);
+
+    for (int threads : { 1, 2, 3, 8 })
+    {
+        CHECK(Utils_Lines::Count(data, threads) == ref.size());
+
+        // 每个线程的行连续, 按 worker 顺序拼接后与单线程一致
+        std::vector<std::vector<std::string>> parts(8);
+        size_t n = Utils_Lines::ForEach(data, [&](std::string_view line, int worker) {
+            parts[static_cast<size_t>(worker)].emplace_back(line);
+        }, threads);
+        CHECK(n == ref.size());
+        std::vector<std::string> all;
+        for (auto &p : parts)
+            all.insert(all.end(), p.begin(), p.end());
+        CHECK(all == ref);
+    }
+
+    // 提前停止
+    std::atomic<size_t> seen(0);
+    size_t n = Utils_Lines::ForEach(data, [&](std::string_view) { return ++seen < 10; }, 4);
+    CHECK(n >= 10);
+    CHECK(n < ref.size());
+
+    // 文件
+    const char *file = "test_utils_lines.tmp";
+    FILE *fp = fopen(file, "wb");
+    REQUIRE(fp != nullptr);
+    fwrite(data.data(), 1, data.size(), fp);
+    fclose(fp);
+    size_t lines = 0;
+    CHECK(Utils_Lines::CountLines(file, lines));
+    CHECK(lines == ref.size());
+    std::mutex mutex;
+    size_t bytes = 0;
+    CHECK(Utils_Lines::ForEachLine(file, [&](std::string_view line) {
+        std::lock_guard<std::mutex> lock(mutex);
+        bytes += line.size();
+    }));
+    size_t ref_bytes = 0;
+    for (const auto &l : ref)
+        ref_bytes += l.size();
+    CHECK(bytes == ref_bytes);
+
+    Utils_LineReader reader;
+    REQUIRE(reader.Open(file));
+    size_t count = 0;
+    for (std::string_view line; reader.Next(line);)
+        count++;
+    CHECK(count == ref.size());
+    reader.Close();
+    remove(file);
+
+    CHECK_FALSE(Utils_Lines::CountLines("not_exist_file.tmp", lines));
+    CHECK_FALSE(Utils_Lines::ForEachLine("not_exist_file.tmp", [](std::string_view) {}));
+}
@@ -0,0 +1,119 @@
+// 单元测试
+#include "./utils_loader.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+// 灰度 png  尺寸交替, 像素值为序号
+static std::string MakeDataset(size_t n)
+{
+    const std::string dir = (fs::temp_directory_path() / "test_utils_loader").string();
+    fs::remove_all(dir);
+    fs::create_directories(dir + "/sub");
+    for (size_t i = 0; i < n; i++)
+    {
+        const cv::Mat img(i % 2 ? 48 : 32, 64, CV_8UC1, cv::Scalar(static_cast<double>(i)));
+        char name[32];
+        snprintf(name, sizeof(name), "/%s%03zu.png", i % 3 ? "" : "sub/", i);
+        cv::imwrite(dir + name, img);
+    }
+    std::ofstream(dir + "/sub/zz_bad.png") << "not an image";
+    std::ofstream(dir + "/notes.txt") << "skip";
+    std::ofstream(dir + "/.txt") << "hidden";
+    return dir;
+}
+
+TEST_CASE("ImageLoader ordered")
+{
+    const size_t n = 40;
+    const std::string dir = MakeDataset(n);
+    const std::vector<std::string> files = Utils_ImageLoader::ListImages(dir, {});
+    REQUIRE(files.size() == n + 1);
+    CHECK(std::is_sorted(files.begin(), files.end()));
+    CHECK(Utils_ImageLoader::ListImages(dir, { ".PNG" }) == files);
+    CHECK(Utils_ImageLoader::ListImages(dir, { "png" }) == files);
+    CHECK(Utils_ImageLoader::ListImages(dir, { ".txt" }).size() == 2);   // 包括 ".txt"
+
+    Utils_ImageLoader::Options opt;
+    opt.threads = 4;
+    opt.read_ahead = 3;
+    opt.prefetch = 5;
+    opt.flags = cv::IMREAD_GRAYSCALE;
+    Utils_ImageLoader loader;
+    REQUIRE(loader.StartDir(dir, {}, opt));
+    CHECK(loader.size() == n + 1);
+
+    size_t expect = 0, good = 0;
+    bool ordered = true, pixels = true;
+    cv::Mat kept;
+    for (Utils_ImageLoader::Item item; loader.Next(item);)
+    {
+        ordered = ordered && item.index == expect++;
+        if (item.ok)
+        {
+            const std::string name = fs::path(loader.Path(item.index)).stem().string();
+            const int value = std::stoi(name);
+            pixels = pixels && item.image.at<uchar>(0, 0) == value && item.image.rows == (value % 2 ? 48 : 32);
+            good++;
+            if (value == 7)
+                kept = item.image;      // 保留的图片不能被复用
+        }
+        loader.Recycle(item);
+        CHECK(item.image.empty());
+    }
+    CHECK(ordered);
+    CHECK(pixels);
+    CHECK(expect == n + 1);
+    CHECK(good == n);
+    CHECK(loader.Failed() == 1);
+    REQUIRE(!kept.empty());
+    CHECK(kept.at<uchar>(0, 0) == 7);
+
+    Utils_ImageLoader::Item item;
+    CHECK_FALSE(loader.Next(item));
+    fs::remove_all(dir);
+}
+
+TEST_CASE("ImageLoader unordered")
+{
+    const size_t n = 30;
+    const std::string dir = MakeDataset(n);
+    std::vector<std::string> files = Utils_ImageLoader::ListImages(dir, {});
+
+    Utils_ImageLoader::Options opt;
+    opt.ordered = false;
+    opt.threads = 3;
+    opt.read_ahead = 2;
+    opt.flags = cv::IMREAD_GRAYSCALE;
+    Utils_ImageLoader loader;
+    REQUIRE(loader.Start(files, opt));
+    std::vector<size_t> seen;
+    for (Utils_ImageLoader::Item item; loader.Next(item);)
+    {
+        seen.push_back(item.index);
+        loader.Recycle(item);
+    }
+    std::sort(seen.begin(), seen.end());
+    bool all = seen.size() == files.size();
+    for (size_t i = 0; all && i < seen.size(); i++)
+        all = seen[i] == i;
+    CHECK(all);
+
+    // 中途停止
+    opt.ordered = true;
+    REQUIRE(loader.Start(files, opt));
+    Utils_ImageLoader::Item item;
+    CHECK(loader.Next(item));
+    CHECK(item.index == 0);
+    loader.Stop();
+    CHECK_FALSE(loader.Next(item));
+
+    CHECK_FALSE(loader.Start({}, opt));
+    CHECK_FALSE(loader.Next(item));
+    fs::remove_all(dir);
+}
@@ -0,0 +1,56 @@
+// 单元测试
+#include "./utils_logger.h"
+#include "./utils_string.h"
+
+#include <string>
+#include <vector>
+
+static void CollectLine(void *ctx, std::string_view line)
+{
+    static_cast<std::vector<std::string> *>(ctx)->emplace_back(line);
+}
+
+TEST_CASE("LogSink lines")
+{
+    std::vector<std::string> lines;
+    std::vector<int> vec(3000);
+    for (int i = 0; i < 3000; i++)
+        vec[i] = 1000000 + i;
+
+    // 每个元素一行  不被 Writer 的 4KB 分块截断
+    Utils_String::CoutVector(vec, true, Utils_LogSink(Utils_LogSink::kMaxLine, &CollectLine, &lines));
+    REQUIRE(lines.size() == 3000);
+    bool whole = true;
+    for (int i = 0; i < 3000; i++)
+        whole = whole && lines[i] == std::to_string(1000000 + i);
+    CHECK(whole);
+
+    // 没有换行的输出  分成不超过 max_line 的多条, 在空白处断开, 元素不被截断
+    lines.clear();
+    Utils_String::CoutVector(vec, false, Utils_LogSink(1000, &CollectLine, &lines));
+    CHECK(lines.size() > 20);
+    std::vector<int> parsed;
+    bool bounded = true;
+    for (const std::string &line : lines)
+    {
+        bounded = bounded && line.size() <= 1000;
+        for (const std::string &num : Utils_String::Str2Vec(line, ' ', true))
+            parsed.push_back(std::stoi(num));
+    }
+    CHECK(bounded);
+    CHECK(parsed == vec);
+
+    // 没有空白时直接断开  CRLF 和空行
+    lines.clear();
+    {
+        Utils_LogSink sink(4, &CollectLine, &lines);
+        Utils_Format::Sink out = sink;
+        out("abcdefghij", 10);
+        CHECK(lines == std::vector<std::string>({ "abcd", "efgh" }));
+        out("\r\n\nxy", 5);
+        CHECK(lines.size() == 3);
+        CHECK(lines[2] == "ij");
+    }
+    CHECK(lines.size() == 4);
+    CHECK(lines[3] == "xy");
+}
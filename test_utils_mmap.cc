@@ -0,0 +1,122 @@
+// 单元测试
+#include "./utils_mmap.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+TEST_CASE("MappedFile Open")
+{
+    const char *file = "test_utils_mmap.tmp";
+    FILE *fp = fopen(file, "wb");
+    REQUIRE(fp != nullptr);
+    fputs("mapped content", fp);
+    fclose(fp);
+
+    Utils_MappedFile map;
+    CHECK_FALSE(map.IsOpen());
+    REQUIRE(map.Open(file));
+    CHECK(map.size() == 14);
+    CHECK(map.view() == "mapped content");
+
+    Utils_MappedFile moved(std::move(map));
+    CHECK_FALSE(map.IsOpen());
+    CHECK(moved.view() == "mapped content");
+    moved.Close();
+    CHECK(moved.data() == nullptr);
+
+    // 空文件 和 不存在的文件
+    fp = fopen(file, "wb");
+    fclose(fp);
+    CHECK(moved.Open(file));
+    CHECK(moved.size() == 0);
+    moved.Close();
+    remove(file);
+    CHECK_FALSE(moved.Open("not_exist_file.tmp"));
+}
+
+TEST_CASE("MappedReader")
+{
+    // uint32 数量 | float[3] | 8 字节定长字符串 | 4 字节无 '\0' 字段 | "hi\0" | uint16 (奇数偏移)
+    const char *file = "test_utils_mmap_reader.tmp";
+    FILE *fp = fopen(file, "wb");
+    REQUIRE(fp != nullptr);
+    const uint32_t count = 3;
+    const float pts[3] = { 1.5f, -2.0f, 3.25f };
+    const char name[8] = { 'c', 'a', 'm', '\0', 'x', 'x', 'x', 'x' };
+    const uint16_t tail = 0xBEEF;
+    fwrite(&count, sizeof(count), 1, fp);
+    fwrite(pts, sizeof(float), 3, fp);
+    fwrite(name, 1, 8, fp);
+    fwrite("abcd", 1, 4, fp);
+    fwrite("hi", 1, 3, fp);
+    fwrite(&tail, sizeof(tail), 1, fp);
+    fclose(fp);
+
+    Utils_MappedReader::Options opt;
+    opt.huge_pages = true;
+    opt.huge_pages_min = 0;
+    Utils_MappedReader reader;
+    REQUIRE(reader.Open(file, opt));
+    CHECK(reader.size() == 4 + 12 + 8 + 4 + 3 + 2);
+
+    uint32_t n = 0;
+    CHECK(reader.Read(n));
+    CHECK(n == 3);
+    Utils_MappedSpan<float> span;
+    CHECK(reader.ReadSpan(n, span));
+    REQUIRE(span.size() == 3);
+    CHECK(span[0] == 1.5f);
+    CHECK(span.at(2) == 3.25f);
+    CHECK_THROWS(span.at(3));
+    CHECK(span.subspan(1).size() == 2);
+    CHECK(span.subspan(5).empty());
+
+    std::string str;
+    CHECK(reader.ReadString(8, str));
+    CHECK(str == "cam");
+    std::string_view view;
+    CHECK(reader.ReadFixedView(4, view));
+    CHECK(view == "abcd");
+    CHECK(reader.ReadCString(view));
+    CHECK(view == "hi");
+
+    // 奇数偏移  视图要求对齐, 拷贝读取不要求
+    Utils_MappedSpan<uint16_t> u16;
+    CHECK(reader.Tell() % 2 == 1);
+    CHECK_FALSE(reader.ReadSpan(1, u16));
+    uint16_t v = 0;
+    CHECK(reader.Read(v));
+    CHECK(v == 0xBEEF);
+    CHECK(reader.eof());
+
+    // 越界时游标不动
+    CHECK_FALSE(reader.Read(v));
+    CHECK(reader.Seek(4));
+    std::vector<float> copy;
+    CHECK_FALSE(reader.ReadArray(copy, SIZE_MAX / 2));
+    CHECK(reader.Tell() == 4);
+    CHECK(reader.ReadArray(copy, 3));
+    CHECK(copy[1] == -2.0f);
+    CHECK_FALSE(reader.Seek(reader.size() + 1));
+    CHECK_FALSE(reader.Skip(reader.Remaining() + 1));
+    CHECK(reader.ReadAt(0, n));
+    CHECK(n == 3);
+    CHECK(reader.Tell() == 16);
+
+    reader.file().Advise(Utils_MappedFile::kWillNeed, 3, 100);
+    reader.file().Advise(Utils_MappedFile::kRandom);
+    reader.Close();
+    CHECK_FALSE(reader.IsOpen());
+    remove(file);
+
+    // 已有内存
+    Utils_MappedReader mem(std::string_view("\x01\x00\x00\x00tail", 8));
+    uint32_t one = 0;
+    CHECK(mem.Read(one));
+    CHECK(one == 1);
+    CHECK_FALSE(mem.ReadCString(view));
+    CHECK(mem.ReadString(4, str));
+    CHECK(str == "tail");
+}
@@ -0,0 +1,83 @@
+// 单元测试
+#include "./utils_path.h"
+
+#include <string>
+#include <vector>
+
+TEST_CASE("Path split")
+{
+    struct Case
+    {
+        const char *path, *name, *stem, *ext, *dir, *parent;
+    };
+    const Case cases[] = {
+        { "D:\\data/img.v2.png", "img.v2.png", "img.v2", ".png", "D:\\data/", "D:\\data" },
+        { "D:\\Code\\utils\\test_utils_files.cc", "test_utils_files.cc", "test_utils_files", ".cc", "D:\\Code\\utils\\", "D:\\Code\\utils" },
+        { "a/b.c/file", "file", "file", "", "a/b.c/", "a/b.c" },
+        { "file.txt", "file.txt", "file", ".txt", "", "" },
+        { "dir/", "", "", "", "dir/", "dir" },
+        { "dir//x", "x", "x", "", "dir//", "dir" },
+        { "/x.y", "x.y", "x", ".y", "/", "/" },
+        { "C:\\x", "x", "x", "", "C:\\", "C:\\" },
+        { "home/.bashrc", ".bashrc", ".bashrc", "", "home/", "home" },
+        { "a/..", "..", "..", "", "a/", "a" },
+        { "a/b.", "b.", "b", ".", "a/", "a" },
+        { "", "", "", "", "", "" },
+    };
+    for (const Case &c : cases)
+    {
+        CHECK(Utils_Path::FileName(c.path) == c.name);
+        CHECK(Utils_Path::Stem(c.path) == c.stem);
+        CHECK(Utils_Path::Extension(c.path) == c.ext);
+        CHECK(Utils_Path::Dir(c.path) == c.dir);
+        CHECK(Utils_Path::Parent(c.path) == c.parent);
+    }
+
+    CHECK(Utils_Path::Back("a/b/c/") == "a/b/");
+    CHECK(Utils_Path::Back("a/b/c") == "a/b/");
+    CHECK(Utils_Path::Back("a\\b\\c\\") == "a\\b\\");
+    CHECK(Utils_Path::Back("abc/") == "");
+    CHECK(Utils_Path::Back("") == "");
+
+    CHECK(Utils_Path::HasExtension("a/B.PNG", ".png"));
+    CHECK_FALSE(Utils_Path::HasExtension("a/b.png.bak", ".png"));
+    CHECK_FALSE(Utils_Path::HasExtension("a.png/b", ".png"));
+    CHECK(Utils_Path::HasExtension("a\\b.Png", "PNG"));
+    CHECK(Utils_Path::HasExtension("a/b.tar.GZ", ".tar.gz"));
+    CHECK(Utils_Path::HasExtension("a/.png", ".png"));
+    CHECK_FALSE(Utils_Path::HasExtension("a/png", "png"));
+    CHECK_FALSE(Utils_Path::HasExtension("a/bpng", "png"));
+    CHECK_FALSE(Utils_Path::HasExtension("a/b.png", ""));
+    CHECK(Utils_Path::HasExtension("a/b.jpg", std::vector<std::string>({ "png", ".JPG" })));
+    CHECK_FALSE(Utils_Path::HasExtension("a/b.jpg", std::vector<std::string>()));
+
+    // 返回的是原字符串的一部分
+    const std::string s = "x/y/z.bin";
+    CHECK(Utils_Path::Stem(s).data() == s.data() + 4);
+}
+
+TEST_CASE("Path join")
+{
+    std::string out;
+    CHECK(Utils_Path::Join(out, "a", "b") == "a/b");
+    CHECK(Utils_Path::Join(out, "a/", "b") == "a/b");
+    CHECK(Utils_Path::Join(out, "a\\", "/b") == "a\\b");
+    CHECK(Utils_Path::Join(out, "a", "b", '\\') == "a\\b");
+    CHECK(Utils_Path::Join(out, "", "b") == "b");
+    CHECK(Utils_Path::Join(out, "a", "") == "a");
+
+    // 重复使用同一个缓冲区 不再分配
+    out.reserve(64);
+    const char *data = out.data();
+    for (int i = 0; i < 10; i++)
+        Utils_Path::Join(out, "images/camera", std::to_string(i) + ".png");
+    CHECK(out == "images/camera/9.png");
+    CHECK(out.data() == data);
+
+    char buf[8];
+    CHECK(Utils_Path::Join(buf, sizeof(buf), "ab", "cd") == 5);
+    CHECK(std::string(buf) == "ab/cd");
+    CHECK(Utils_Path::Join(buf, sizeof(buf), "abcd/", "/efgh") == 9);
+    CHECK(std::string(buf) == "abcd/ef");
+    CHECK(Utils_Path::Join(nullptr, 0, "a", "b") == 3);
+}
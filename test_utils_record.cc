@@ -0,0 +1,162 @@
+// 单元测试
+#include "./utils_record.h"
+#include "./Utils_Exception.h"
+
+#include <stdio.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+static std::string Payload(size_t i)
+{
+    std::string s(i * 7 % 53, static_cast<char>('a' + i % 26));
+    s += std::to_string(i);
+    return s;
+}
+
+static void PatchByte(const char *file, uint64_t pos)
+{
+    std::fstream f(file, std::ios::in | std::ios::out | std::ios::binary);
+    f.seekg(static_cast<std::streamoff>(pos));
+    char c = 0;
+    f.get(c);
+    f.seekp(static_cast<std::streamoff>(pos));
+    f.put(static_cast<char>(c ^ 0x5A));
+}
+
+TEST_CASE("Crc32c")
+{
+    CHECK(Utils_Crc32c::Compute("", 0) == 0);
+    CHECK(Utils_Crc32c::Compute("123456789") == 0xE3069283u);
+    CHECK(Utils_Crc32c::ExtendTable(0, "123456789", 9) == 0xE3069283u);
+    const std::string zeros(32, '\0');
+    CHECK(Utils_Crc32c::Compute(zeros) == 0x8A9136AAu);
+
+    // 任意起点 / 长度 指令与查表一致, 分段计算与整体一致
+    std::string data;
+    for (int i = 0; i < 300; i++)
+        data += static_cast<char>(i * 131 + 7);
+    bool same = true;
+    for (size_t off = 0; off < 9; off++)
+    {
+        for (size_t len = 0; off + len <= data.size(); len += 13)
+        {
+            const uint32_t whole = Utils_Crc32c::Compute(data.data() + off, len);
+            same = same && whole == Utils_Crc32c::ExtendTable(0, data.data() + off, len);
+            const size_t half = len / 3;
+            same = same && whole == Utils_Crc32c::Extend(Utils_Crc32c::Compute(data.data() + off, half),
+                                                        data.data() + off + half, len - half);
+        }
+    }
+    CHECK(same);
+}
+
+TEST_CASE("RecordFile")
+{
+    const char *file = "test_utils_record.tmp";
+    const size_t n = 200;
+
+    Utils_RecordWriter writer;
+    CHECK_FALSE(writer.Append("x"));
+    CHECK(writer.Error() == Error_IDOI_FileWritePointerNull);
+
+    Utils_RecordWriter::Options opt;
+    opt.tag = 0x46524D31;
+    opt.buffer_size = 256;
+    REQUIRE(writer.Open(file, opt));
+    for (size_t i = 0; i < n; i++)
+        CHECK(writer.Append(Payload(i)));
+    const std::vector<uint32_t> values = { 1, 2, 3, 0xFFFFFFFF };
+    CHECK(writer.AppendArray(values.data(), values.size()));
+    CHECK(writer.size() == n + 1);
+    CHECK(writer.Close());
+
+    Utils_RecordReader reader;
+    REQUIRE(reader.Open(file));
+    CHECK_FALSE(reader.Recovered());
+    CHECK(reader.Tag() == opt.tag);
+    REQUIRE(reader.size() == n + 1);
+    bool same = true;
+    std::string_view rec;
+    for (size_t i = n; i-- > 0;)
+    {
+        same = same && reader.Get(i, rec) && rec == Payload(i);
+        same = same && reader.Offset(i) % Utils_RecordFormat::kAlign == 0;
+    }
+    CHECK(same);
+    Utils_MappedSpan<uint32_t> span;
+    REQUIRE(reader.GetSpan(n, span));
+    CHECK(std::vector<uint32_t>(span.begin(), span.end()) == values);
+    Utils_MappedSpan<uint64_t> odd;
+    CHECK_FALSE(reader.GetSpan(0, odd));
+    CHECK_FALSE(reader.Get(n + 1, rec));
+    CHECK(reader.Error() == Error_IDOI_RecordVerifyError);
+
+    // 损坏一条记录的数据  只有这一条校验失败
+    const uint64_t bad = reader.Offset(50) + Utils_RecordFormat::kRecordHeader;
+    reader.Close();
+    PatchByte(file, bad);
+    REQUIRE(reader.Open(file));
+    CHECK_FALSE(reader.Get(50, rec));
+    CHECK(reader.Get(49, rec));
+    CHECK(reader.Get(51, rec));
+    PatchByte(file, bad);
+    reader.Close();
+
+    // 崩溃: 没有索引块, 最后一条记录不完整
+    REQUIRE(reader.Open(file));
+    const uint64_t cut = reader.Offset(n - 1) + 5;
+    reader.Close();
+    std::filesystem::resize_file(file, cut);
+    Utils_RecordReader::Options strict;
+    strict.recover = false;
+    CHECK_FALSE(reader.Open(file, strict));
+    CHECK(reader.Error() == Error_IDOI_FileVerifyError);
+    REQUIRE(reader.Open(file));
+    CHECK(reader.Recovered());
+    CHECK(reader.size() == n - 1);
+    CHECK(reader.Get(n - 2, rec));
+    CHECK(rec == Payload(n - 2));
+    CHECK(reader.ValidEnd() == reader.Offset(n - 1 - 1) + Utils_RecordFormat::kRecordHeader +
+          Utils_RecordFormat::AlignUp(Payload(n - 2).size()));
+    reader.Close();
+
+    // 追加打开  截掉不完整的尾部后继续写入
+    REQUIRE(writer.Open(file, Utils_RecordWriter::Options(), true));
+    CHECK(writer.size() == n - 1);
+    CHECK(writer.Append("again"));
+    CHECK(writer.Sync());
+    CHECK(writer.Close());
+    REQUIRE(reader.Open(file));
+    CHECK_FALSE(reader.Recovered());
+    CHECK(reader.Tag() == opt.tag);
+    REQUIRE(reader.size() == n);
+    CHECK(reader.Get(n - 1, rec));
+    CHECK(rec == "again");
+    CHECK(reader.Get(0, rec));
+    CHECK(rec == Payload(0));
+    reader.Close();
+
+    // 中间的记录损坏 且没有索引: 恢复到损坏之前
+    REQUIRE(reader.Open(file));
+    const uint64_t mid = reader.Offset(10) + 4;
+    const uint64_t index = reader.ValidEnd();
+    reader.Close();
+    std::filesystem::resize_file(file, index);
+    PatchByte(file, mid);
+    REQUIRE(reader.Open(file));
+    CHECK(reader.Recovered());
+    CHECK(reader.size() == 10);
+    reader.Close();
+    remove(file);
+
+    CHECK_FALSE(reader.Open("not_exist_file.tmp"));
+    CHECK(reader.Error() == Error_IDOI_FileNotExist);
+    std::ofstream(file) << "not a record file";
+    CHECK_FALSE(reader.Open(file));
+    CHECK(reader.Error() == Error_IDOI_FileVerifyError);
+    CHECK_FALSE(writer.Open(file, Utils_RecordWriter::Options(), true));
+    CHECK(writer.Error() == Error_IDOI_FileVerifyError);
+    remove(file);
+}
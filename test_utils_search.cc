@@ -0,0 +1,155 @@
+// 单元测试
+#include "./utils_search.h"
+
+#include <stdio.h>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+typedef std::vector<Utils_SearchMatch> Matches;
+
+// 逐个模式 逐个位置比较, 顺序与自动机相同: 按结尾位置, 同一结尾较长的在前
+static Matches Naive(const std::vector<std::string> &pats, std::string_view text)
+{
+    Matches res;
+    for (size_t e = 1; e <= text.size(); e++)
+    {
+        std::vector<uint32_t> ids;
+        for (uint32_t id = 0; id < pats.size(); id++)
+        {
+            const std::string &p = pats[id];
+            if (p.size() <= e && text.compare(e - p.size(), p.size(), p) == 0)
+                ids.push_back(id);
+        }
+        std::stable_sort(ids.begin(), ids.end(), [&](uint32_t a, uint32_t b) { return pats[a].size() > pats[b].size(); });
+        for (uint32_t id : ids)
+        {
+            Utils_SearchMatch m;
+            m.pos = e - pats[id].size();
+            m.pattern = id;
+            m.len = static_cast<uint32_t>(pats[id].size());
+            res.push_back(m);
+        }
+    }
+    return res;
+}
+
+TEST_CASE("MultiSearch basic")
+{
+    Utils_MultiSearch ms;
+    CHECK(ms.Add("he") == 0);
+    CHECK(ms.Add("she") == 1);
+    CHECK(ms.Add("his") == 2);
+    CHECK(ms.Add("hers") == 3);
+    CHECK(ms.Add("") == -1);
+    CHECK_FALSE(ms.IsBuilt());
+    CHECK(ms.FindAll("ushers").empty());
+    REQUIRE(ms.Build());
+    CHECK_FALSE(ms.Build());
+    CHECK(ms.Add("x") == -1);
+
+    Matches m = ms.FindAll("ushers");
+    REQUIRE(m.size() == 3);
+    CHECK(m[0].pattern == 1);
+    CHECK(m[0].pos == 1);
+    CHECK(m[1].pattern == 0);
+    CHECK(m[1].pos == 2);
+    CHECK(m[2].pattern == 3);
+    CHECK(m[2].pos == 2);
+
+    CHECK(ms.Contains("this"));
+    CHECK_FALSE(ms.Contains("hxsxrs"));
+    CHECK(ms.FindAll("").empty());
+
+    // 回调返回 false 停止
+    size_t n = ms.Scan("he he he", [](const Utils_SearchMatch &) { return false; });
+    CHECK(n == 1);
+}
+
+TEST_CASE("MultiSearch ignore case and error codes")
+{
+    Utils_MultiSearch ms(true);
+    ms.Add("Code:1000");
+    ms.Add("Code:5001");
+    ms.Add("timeout");
+    ms.Add("[ERROR]");
+    REQUIRE(ms.Build());
+    std::string log =
+        "[2019-12-25 10:00:01.123] [info] open camera\n"
+        "[2019-12-25 10:00:02.456] [error] Exception occur:\t Code:1000\tMess:yml 文件不存在\n"
+        "[2019-12-25 10:00:03.789] [warn] serial TIMEOUT, code:5001\n";
+    Matches m = ms.FindAll(log);
+    REQUIRE(m.size() == 4);
+    CHECK(m[0].pattern == 3);
+    CHECK(log.compare(m[1].pos, m[1].len, "Code:1000") == 0);
+    CHECK(log.compare(m[2].pos, m[2].len, "TIMEOUT") == 0);
+    CHECK(log.compare(m[3].pos, m[3].len, "code:5001") == 0);
+}
+
+TEST_CASE("MultiSearch random compare with naive")
+{
+    std::mt19937 rng(2019);
+    for (int round = 0; round < 200; round++)
+    {
+        // 小字母表 产生大量重叠和公共前后缀
+        int alpha = 2 + static_cast<int>(rng() % 4);
+        auto gen = [&](size_t len) {
+            std::string s;
+            for (size_t i = 0; i < len; i++)
+                s.push_back(static_cast<char>('a' + rng() % alpha));
+            return s;
+        };
+        std::vector<std::string> pats;
+        Utils_MultiSearch ms;
+        size_t count = 1 + rng() % 12;
+        for (size_t i = 0; i < count; i++)
+        {
+            pats.push_back(gen(1 + rng() % 6));
+            ms.Add(pats.back());
+        }
+        REQUIRE(ms.Build());
+        std::string text = gen(rng() % 300);
+        CHECK((ms.FindAll(text) == Naive(pats, text)));
+    }
+}
+
+TEST_CASE("MultiSearch parallel equals serial")
+{
+    std::mt19937 rng(7);
+    std::vector<std::string> pats = { "Code:1000", "Code:1001", "Code:5000", "Code:6001", "\n[error]",
+                                      "resync", "sync", "ab\ncd" };
+    Utils_MultiSearch ms;
+    for (const auto &p : pats)
+        ms.Add(p);
+    REQUIRE(ms.Build());
+
+    // 4MB 文本, 保证多线程真正分块; 模式跨行 跨块
+    std::string text;
+    const char *words[] = { "[info] camera open ", "Code:1000 ", "resync ", "[error] ", "ab\ncd ", "\n", "Code:6001\n" };
+    while (text.size() < (4u << 20))
+        text += words[rng() % 7];
+
+    Matches serial = ms.FindAll(text);
+    CHECK(serial.size() > 1000);
+    for (int threads : { 2, 3, 4, 7 })
+    {
+        Matches parallel = ms.FindAll(text, threads);
+        CHECK(parallel.size() == serial.size());
+        CHECK((parallel == serial));
+    }
+    std::string_view head = std::string_view(text).substr(0, 20000);
+    CHECK((ms.FindAll(head) == Naive(pats, head)));
+
+    // 文件
+    const char *file = "test_utils_search.tmp.log";
+    FILE *fp = fopen(file, "wb");
+    REQUIRE(fp != nullptr);
+    fwrite(text.data(), 1, text.size(), fp);
+    fclose(fp);
+    Matches from_file;
+    CHECK(ms.FindAllInFile(file, from_file, 4));
+    CHECK((from_file == serial));
+    remove(file);
+    CHECK_FALSE(ms.FindAllInFile(file, from_file));
+}
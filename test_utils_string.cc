@@ -3,6 +3,10 @@
 #include "./utils.h"
 #include "./utils_string.h"
 
+#include <string.h>
+#include <random>
+#include <sstream>
+
 
 TEST_CASE("Test utils_string Func Str2Vec")
 {
@@ -62,8 +66,8 @@ TEST_CASE("Test String 2 Num")
 {
     CHECK(Utils_String::String2Num("123", 10) == 123);
     CHECK(Utils_String::String2Num("F", 16) == 15);
-    CHECK(Utils_String::String2Num("1111", 2) == 7);
-    CHECK(Utils_String::String2Num("777", 10) == 511);
+    CHECK(Utils_String::String2Num("1111", 2) == 15);
+    CHECK(Utils_String::String2Num("777", 8) == 511);
 }
 
 TEST_CASE("Hex 2 Num")  ///< The test case
@@ -154,3 +158,264 @@ TEST_CASE("CharArr2String")
 }
 
 
+
+TEST_CASE("String Upper Lowwer")
+{
+    CHECK(Utils_String::StringUpper("abcXYZ_019 ü") == "ABCXYZ_019 ü");
+    CHECK(Utils_String::StringLowwer("ABCxyz@[`{") == "abcxyz@[`{");
+
+    // 超过 16 字节 走 SIMD 路径
+    std::string str = "Hello_World.JPG-hello_world.jpg";
+    Utils_String::StringLowwerInPlace(str);
+    CHECK(str == "hello_world.jpg-hello_world.jpg");
+    Utils_String::StringUpperInPlace(str);
+    CHECK(str == "HELLO_WORLD.JPG-HELLO_WORLD.JPG");
+
+    char buf[8] = { 0 };
+    Utils_String::StringLowwer("IMG.PNG", buf, 7);
+    CHECK(std::string(buf) == "img.png");
+}
+
+TEST_CASE("String NoCase compare and hash")
+{
+    CHECK(Utils_String::StringEqualNoCase("Capture_0001.JPG", "capture_0001.jpg"));
+    CHECK(Utils_String::StringEqualNoCase("", ""));
+    CHECK_FALSE(Utils_String::StringEqualNoCase("abc", "abd"));
+    CHECK_FALSE(Utils_String::StringEqualNoCase("@", "`"));
+    CHECK_FALSE(Utils_String::StringEqualNoCase("abc", "abcd"));
+
+    CHECK(Utils_String::StringStartsWithNoCase("IMG_2019.png", "img_"));
+    CHECK_FALSE(Utils_String::StringStartsWithNoCase("im", "img"));
+
+    CHECK(Utils_String::StringHashNoCase("Sensor_Front.BIN") == Utils_String::StringHashNoCase("sensor_front.bin"));
+    CHECK(Utils_String::StringHashNoCase("a") != Utils_String::StringHashNoCase("b"));
+}
+
+TEST_CASE("constexpr version and number parse")
+{
+    static_assert(Utils_String::StringVersionToInt("1.1") == 101, "");
+    static_assert(Utils_String::StringVersionToInt("v1.2.3") == 10203, "");
+    static_assert(Utils_String::StringVersionToInt("1.2", 3) == 10200, "");
+    static_assert(Utils_String::StringVersionToInt("1.2.3", 2) == 102, "");
+    static_assert(Utils_String::ParseVersion("1.10.0") > Utils_String::ParseVersion("1.9"), "");
+    static_assert(Utils_String::ParseVersion("2.0") == Utils_String::ParseVersion("2"), "");
+    static_assert(Utils_String::Hex2Num("AA 55") == 0xAA55, "");
+    static_assert(Utils_String::Hex2Uchar("7E") == 0x7E, "");
+    static_assert(Utils_String::String2Num("115200") == 115200, "");
+    static_assert(Utils_String::String2Num("-zz", 36) == -1295, "");
+
+    // 非法输入 不再 assert
+    CHECK(Utils_String::StringVersionToInt("") == -1);
+    CHECK(Utils_String::StringVersionToInt("abc") == -1);
+    CHECK(Utils_String::StringVersionToInt("3.4.5-rc1") == 30405);
+    CHECK(Utils_String::StringVersionToInt(std::string("1.")) == 100);
+    CHECK(Utils_String::ParseVersion("x").depth == 0);
+
+    // 每一级超过 99 或结果超过 int 时失败, 原来溢出 ("1.100" 与 "2.0" 相等)
+    CHECK(Utils_String::StringVersionToInt("1.100") == -1);
+    CHECK(Utils_String::StringVersionToInt("1.100") != Utils_String::StringVersionToInt("2.0"));
+    CHECK(Utils_String::StringVersionToInt("1.2.3.4.5") == 102030405);
+    CHECK(Utils_String::StringVersionToInt("1.2.3.4.5.6") == -1);
+    CHECK(Utils_String::StringVersionToInt("99999999999999999999") == -1);
+    CHECK(Utils_String::StringVersionToInt("1.2.3.4.5.6", 3) == 10203);
+    CHECK(Utils_String::StringVersionToInt("1", 6) == -1);
+    CHECK(Utils_String::ParseVersion("1.2.3.4.5.6").depth == 6);
+    CHECK(Utils_String::ParseVersion("2147483647").part[0] == 2147483647);
+    CHECK(Utils_String::ParseVersion("1.2147483648").depth == 0);
+    CHECK(Utils_String::ParseVersion("99999999999999999999").depth == 0);
+    CHECK(Utils_String::String2Num("12ab", 10) == 12);
+    CHECK(Utils_String::String2Num("11", 1) == 0);
+}
+
+TEST_CASE("Base64 encode decode")
+{
+    // RFC 4648 测试向量
+    const char *plain[] = { "", "f", "fo", "foo", "foob", "fooba", "foobar" };
+    const char *std64[] = { "", "Zg==", "Zm8=", "Zm9v", "Zm9vYg==", "Zm9vYmE=", "Zm9vYmFy" };
+    const char *url64[] = { "", "Zg", "Zm8", "Zm9v", "Zm9vYg", "Zm9vYmE", "Zm9vYmFy" };
+    for (int i = 0; i < 7; i++)
+    {
+        CHECK(Utils_String::Base64Encode(plain[i]) == std64[i]);
+        CHECK(Utils_String::Base64Encode(plain[i], true) == url64[i]);
+        std::string out;
+        CHECK(Utils_String::Base64Decode(std64[i], out));
+        CHECK(out == plain[i]);
+        CHECK(Utils_String::Base64Decode(url64[i], out, true));
+        CHECK(out == plain[i]);
+        CHECK(Utils_String::Base64Decode(std64[i], out, true));   // URL-safe 允许 '='
+        CHECK(out == plain[i]);
+    }
+
+    std::string bin = "\xfb\xff\xfe\x3e\x3f";
+    CHECK(Utils_String::Base64Encode(bin) == "+//+Pj8=");
+    CHECK(Utils_String::Base64Encode(bin, true) == "-__-Pj8");
+
+    // 超过 32 字节 走 SIMD 路径, 所有字节值往返
+    std::string all;
+    for (int i = 0; i < 256 * 3; i++)
+        all.push_back(static_cast<char>(i * 7 + (i >> 8)));
+    for (size_t len = 0; len <= all.size(); len += (len < 100 ? 1 : 37))
+    {
+        for (int url = 0; url < 2; url++)
+        {
+            std::string_view src(all.data(), len);
+            std::string enc = Utils_String::Base64Encode(src, url != 0);
+            CHECK(enc.size() == Utils_String::Base64EncodeSize(len, url != 0));
+            std::string dec;
+            CHECK(Utils_String::Base64Decode(enc, dec, url != 0));
+            CHECK(dec == src);
+        }
+    }
+
+    // 严格校验
+    std::string out;
+    CHECK_FALSE(Utils_String::Base64Decode("Zg=", out));          // 长度
+    CHECK_FALSE(Utils_String::Base64Decode("Zg", out));           // 标准模式需要 '='
+    CHECK_FALSE(Utils_String::Base64Decode("Z", out, true));
+    CHECK_FALSE(Utils_String::Base64Decode("Zh==", out));         // 填充位不为 0
+    CHECK_FALSE(Utils_String::Base64Decode("Zm9=", out));
+    CHECK_FALSE(Utils_String::Base64Decode("Zm=v", out));         // '=' 位置
+    CHECK_FALSE(Utils_String::Base64Decode("Z===", out));
+    CHECK_FALSE(Utils_String::Base64Decode("====", out));
+    CHECK_FALSE(Utils_String::Base64Decode("Zm9v\nYmFy", out));   // 空白
+    CHECK_FALSE(Utils_String::Base64Decode("-__-Pj8=", out));     // 字母表混用
+    CHECK_FALSE(Utils_String::Base64Decode("+//+Pj8", out, true));
+    CHECK(out.empty());
+
+    // SIMD 块中的非法字符
+    std::string enc = Utils_String::Base64Encode(all);
+    for (size_t pos : { size_t(0), size_t(17), size_t(31), size_t(500), enc.size() - 5 })
+    {
+        for (char bad : { '*', '\x80', '\xff', '-', '=', ' ' })
+        {
+            std::string broken = enc;
+            broken[pos] = bad;
+            CHECK_FALSE(Utils_String::Base64Decode(broken, out));
+        }
+    }
+
+    // 写入调用者缓冲区
+    char buf[16];
+    CHECK(Utils_String::Base64Encode("abc", 3, buf) == 4);
+    uchar raw[8];
+    size_t len = 0;
+    CHECK(Utils_String::Base64Decode(std::string_view(buf, 4), raw, &len));
+    CHECK(len == 3);
+    CHECK(raw[0] == 'a');
+    CHECK(raw[2] == 'c');
+}
+
+// 逐个字符的参考实现, 用于与查表实现随机对比
+static std::string RefHex2String(const std::string &str, bool flg_space)
+{
+    if (str.size() > 2 && str[2] == ' ')
+        flg_space = true;
+    size_t step = flg_space ? 3 : 2;
+    std::string res;
+    for (size_t i = 0; i + 1 < str.size() && res.size() < (flg_space ? str.size() + 1 : str.size()) / step; i += step)
+        res.push_back(static_cast<char>(Utils_String::Hex2Uchar(std::string_view(str).substr(i, 2))));
+    return res;
+}
+
+// 原来基于 getline 的实现
+static std::vector<std::string> RefSplit(const std::string &str, char sep, bool skip_empty)
+{
+    std::vector<std::string> res;
+    std::istringstream iss(str);
+    for (std::string item; getline(iss, item, sep);)
+    {
+        if (!skip_empty || !item.empty())
+            res.push_back(item);
+    }
+    return res;
+}
+
+TEST_CASE("String conversion properties")
+{
+    std::mt19937 rng(2019);
+    for (int round = 0; round < 2000; round++)
+    {
+        size_t len = rng() % 70;
+        std::string bin(len, '\0');
+        for (char &c : bin)
+            c = static_cast<char>(rng());
+        uchar *raw = reinterpret_cast<uchar *>(&bin[0]);
+
+        // hex 往返
+        std::string hex_sp = Utils_String::CharArr2Hex(raw, static_cast<int>(len), 1);
+        std::string hex = Utils_String::CharArr2Hex(raw, static_cast<int>(len), 0);
+        CHECK(hex_sp.size() == (len == 0 ? 0 : len * 3 - 1));
+        CHECK(hex.size() == len * 2);
+        CHECK(Utils_String::Hex2String(hex_sp) == bin);
+        if (len > 1)
+            CHECK(Utils_String::Hex2String(hex, false) == bin);
+        CHECK(Utils_String::ShowCharArr(&bin) == (len == 0 ? std::string() : hex_sp + " "));
+
+        // 任意字符 与参考实现一致
+        std::string junk(rng() % 12, '\0');
+        for (char &c : junk)
+            c = "0123456789abcdefABCDEF xZ\x80"[rng() % 26];
+        CHECK(Utils_String::Hex2String(junk) == RefHex2String(junk, true));
+        CHECK(Utils_String::Hex2String(junk, false) == RefHex2String(junk, false));
+
+        // Hex2CharArr 与 Hex2String 结果相同
+        for (int sp = 0; sp < 2; sp++)
+        {
+            const std::string expect = Utils_String::Hex2String(junk, sp != 0);
+            uchar *arr = nullptr;
+            CHECK((Utils_String::Hex2CharArr(arr, junk, sp != 0) == nullptr) == expect.empty());
+            if (arr != nullptr)
+                CHECK(std::string(reinterpret_cast<char *>(arr), expect.size()) == expect);
+            delete[] arr;
+        }
+
+        // 拷贝 和 分割
+        char *copy = Utils_String::String2Char(bin);
+        CHECK(memcmp(copy, bin.c_str(), len + 1) == 0);
+        CHECK(Utils_String::CharArr2String(copy, static_cast<int>(len)) == bin);
+        delete[] copy;
+
+        std::string csv(rng() % 16, '\0');
+        for (char &c : csv)
+            c = "ab,"[rng() % 3];
+        for (int skip = 0; skip < 2; skip++)
+            CHECK(Utils_String::Str2Vec(csv, ',', skip != 0) == RefSplit(csv, ',', skip != 0));
+
+        // 数字往返
+        int num = static_cast<int>(rng());
+        int base = 2 + static_cast<int>(rng() % 35);
+        CHECK(Utils_String::String2Num(Utils_String::NumToString(num, 1, base), base) == num);
+        CHECK(Utils_String::NumToString(num, 0) == std::to_string(num));
+    }
+
+    // 长字符串 原来固定分配 100 字节
+    std::string long_str(1000, 'x');
+    char *copy = Utils_String::ConstChar2Char(long_str.c_str());
+    CHECK(std::string(copy) == long_str);
+    delete[] copy;
+    CHECK(Utils_String::ConstChar2Char(nullptr) == nullptr);
+
+    // 不足 3 个字符 原来返回 nullptr 构造 string
+    CHECK(Utils_String::Hex2String("").empty());
+    CHECK(Utils_String::Hex2String("A").empty());
+    CHECK(Utils_String::Hex2String("4A") == "J");
+    CHECK(Utils_String::Hex2String("4a", false) == "J");
+
+    // 一个字节 原来 Hex2CharArr 返回 nullptr
+    uchar *arr = nullptr;
+    CHECK(Utils_String::Hex2CharArr(arr, "ab") != nullptr);
+    CHECK(arr[0] == 0xAB);
+    delete[] arr;
+    arr = nullptr;
+    CHECK(Utils_String::Hex2CharArr(arr, "4a", false) != nullptr);
+    CHECK(arr[0] == 'J');
+    delete[] arr;
+    arr = nullptr;
+    CHECK(Utils_String::Hex2CharArr(arr, "A") == nullptr);
+    CHECK(arr == nullptr);
+
+    std::vector<std::string> parts = Utils_String::Str2Vector("a,b||c d", ",| ", true);
+    CHECK(parts == std::vector<std::string>({ "a", "b", "c", "d" }));
+    parts = Utils_String::Str2Vector("a,,b", ",", false);
+    CHECK(parts == std::vector<std::string>({ "a", "", "b" }));
+}
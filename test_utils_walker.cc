@@ -0,0 +1,190 @@
+// 单元测试
+#include "./utils_walker.h"
+#include "./utils_concurrent.h"
+#include "./utils_glob.h"
+#include "./utils_files.h"
+
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+// 生成测试目录  root/d{0..3}/s{0..3}/f{0..4}.{jpg,TXT} 以及 .hidden 目录
+static std::string MakeTree(void)
+{
+    fs::path root = fs::temp_directory_path() / "test_utils_walker";
+    fs::remove_all(root);
+    for (int d = 0; d < 4; d++)
+    {
+        for (int s = 0; s < 4; s++)
+        {
+            fs::path dir = root / ("d" + std::to_string(d)) / ("s" + std::to_string(s));
+            fs::create_directories(dir);
+            for (int f = 0; f < 5; f++)
+                std::ofstream(dir / ("f" + std::to_string(f) + (f % 2 ? ".jpg" : ".TXT"))) << f;
+        }
+    }
+    fs::create_directories(root / ".hidden");
+    std::ofstream(root / ".hidden" / "h.jpg") << 1;
+    std::ofstream(root / "top.jpg") << 1;
+    return root.string();
+}
+
+TEST_CASE("Walker list and filters")
+{
+    const std::string root = MakeTree();
+    const size_t total = 4 * 4 * 5 + 2;
+
+    // 与 std::filesystem 的结果一致
+    std::vector<std::string> ref;
+    for (const auto &e : fs::recursive_directory_iterator(root))
+    {
+        if (e.is_regular_file())
+            ref.push_back(e.path().string());
+    }
+    std::sort(ref.begin(), ref.end());
+
+    for (int threads : { 1, 4 })
+    {
+        Utils_Walker::Options opt;
+        opt.threads = threads;
+        std::vector<std::string> files = Utils_Walker::List(root, opt);
+        CHECK(files.size() == total);
+        CHECK(files == ref);
+    }
+
+    Utils_Walker::Options opt;
+    opt.extensions = { "JPG" };
+    CHECK(Utils_Walker::List(root, opt).size() == 4 * 4 * 2 + 2);
+    opt.skip_hidden = true;
+    CHECK(Utils_Walker::List(root, opt).size() == 4 * 4 * 2 + 1);
+
+    Utils_Glob glob("f[0-2].*");
+    Utils_Walker::Options g;
+    g.filter = &glob;
+    CHECK(Utils_Walker::List(root, g).size() == 4 * 4 * 3);
+
+    // 深度  0 只有根目录下的项
+    Utils_Walker::Options d;
+    d.max_depth = 0;
+    d.report_dirs = true;
+    CHECK(Utils_Walker::List(root, d).size() == 4 + 1 + 1);
+    d.max_depth = 1;
+    d.report_dirs = false;
+    CHECK(Utils_Walker::List(root, d).size() == 2);     // top.jpg .hidden/h.jpg
+    d.max_depth = 2;
+    CHECK(Utils_Walker::List(root, d).size() == total);
+
+    // 回调中的类型和深度
+    std::atomic<int> dirs(0), deep(0);
+    Utils_Walker::Options r;
+    r.report_dirs = true;
+    Utils_Walker::Walk(root, r, [&](const Utils_WalkEntry &e, int) {
+        if (e.type == Utils_WalkEntry::kDir)
+            dirs++;
+        if (e.type == Utils_WalkEntry::kFile && e.depth == 2)
+            deep++;
+        CHECK(e.path.size() > e.name.size());
+    });
+    CHECK(dirs == 4 + 4 * 4 + 1);
+    CHECK(deep == 4 * 4 * 5);
+
+    // 提前停止
+    std::atomic<int> seen(0);
+    size_t n = Utils_Walker::Walk(root, Utils_Walker::Options(), [&](const Utils_WalkEntry &) { return ++seen < 3; });
+    CHECK(n >= 3);
+    CHECK(n < total);
+
+    // ListAllFiles 使用同一个实现
+    CHECK(Utils_Files::ListAllFiles(root) == ref);
+    std::vector<std::string> jpg;
+    Utils_Files::ListAllFiles(root, jpg, Utils_Glob("*.jpg"));
+    CHECK(jpg.size() == 4 * 4 * 2 + 2);
+
+    CHECK(Utils_Walker::List(root + "/not_exist", Utils_Walker::Options()).empty());
+    fs::remove_all(root);
+}
+
+TEST_CASE("Walker channel and symlinks")
+{
+    const std::string root = MakeTree();
+
+    // 小容量通道 遍历线程等待消费者
+    Utils_BoundedChannel<std::string> ch(4);
+    Utils_Walker::Options opt;
+    opt.threads = 3;
+    std::thread producer([&]() { Utils_Walker::Walk(root, opt, ch); });
+    size_t count = 0;
+    for (std::string path; ch.Pop(path);)
+        count++;
+    producer.join();
+    CHECK(count == 4 * 4 * 5 + 2);
+    CHECK(ch.IsClosed());
+
+    // 消费者提前关闭
+    Utils_BoundedChannel<std::string> ch2(2);
+    std::thread producer2([&]() { Utils_Walker::Walk(root, opt, ch2); });
+    std::string first;
+    CHECK(ch2.Pop(first));
+    ch2.Close();
+    producer2.join();
+
+#ifndef _WIN32
+    // 指向祖先目录的链接  不跟随时为链接本身, 跟随时不重复进入
+    fs::create_directory_symlink(root, fs::path(root) / "d0" / "loop");
+    Utils_Walker::Options s;
+    s.report_dirs = true;
+    int links = 0;
+    Utils_Walker::Walk(root, s, [&](const Utils_WalkEntry &e) { links += e.type == Utils_WalkEntry::kSymlink; });
+    CHECK(links == 1);
+    s.follow_symlinks = true;
+    s.report_dirs = false;
+    CHECK(Utils_Walker::List(root, s).size() == 4 * 4 * 5 + 2);
+#endif
+    fs::remove_all(root);
+}
+
+TEST_CASE("BoundedChannel")
+{
+    Utils_BoundedChannel<int> ch(3);
+    CHECK(ch.capacity() == 3);
+    int v = 1;
+    CHECK(ch.TryPush(v));
+    v = 2;
+    CHECK(ch.TryPush(v));
+    v = 3;
+    CHECK(ch.TryPush(v));
+    v = 4;
+    CHECK_FALSE(ch.TryPush(v));
+    CHECK(ch.size() == 3);
+    int out = 0;
+    CHECK(ch.Pop(out));
+    CHECK(out == 1);
+    CHECK(ch.Push(4));
+
+    std::vector<int> batch;
+    CHECK(ch.PopBatch(batch, 10) == 3);
+    CHECK(batch == std::vector<int>({ 2, 3, 4 }));
+    CHECK_FALSE(ch.TryPop(out));
+
+    // 多生产者 多消费者
+    Utils_BoundedChannel<int> mp(8);
+    std::atomic<long> sum(0);
+    std::vector<std::thread> consumers, producers;
+    for (int c = 0; c < 3; c++)
+        consumers.emplace_back([&]() { for (int x; mp.Pop(x);) sum += x; });
+    for (int p = 0; p < 4; p++)
+        producers.emplace_back([&]() { for (int i = 1; i <= 1000; i++) mp.Push(i); });
+    for (auto &t : producers)
+        t.join();
+    mp.Close();
+    for (auto &t : consumers)
+        t.join();
+    CHECK(sum == 4L * 1000 * 1001 / 2);
+    CHECK_FALSE(mp.Push(1));
+}
@@ -14,6 +14,26 @@
 #include "./utils_logger.h"
 #include "./Utils_Exception.h"
 #include "./utils_string.h"
+#include "./utils_format.h"
+#include "./utils_builder.h"
+#include "./utils_intern.h"
+#include "./utils_encoding.h"
+#include "./utils_frame.h"
+#include "./utils_mmap.h"
+#include "./utils_csv.h"
+#include "./utils_search.h"
+#include "./utils_glob.h"
+#include "./utils_config.h"
+#include "./utils_concurrent.h"
+#include "./utils_walker.h"
+#include "./utils_index.h"
+#include "./utils_binary.h"
+#include "./utils_lines.h"
+#include "./utils_async.h"
+#include "./utils_record.h"
+#include "./utils_loader.h"
+#include "./utils_path.h"
+#include "./utils_hash.h"
 #include "./utils_files.h"
 #include "./utils_cv.h"
 #include "./utils_data.h"
@@ -24,6 +44,8 @@
 // 直接继承 可以使用 同一的类名 访问
 class Utils :
     public Utils_String,
+    public Utils_Format,
+    public Utils_Encoding,
     public Utils_Files,
     public Utils_Data,
     public Utils_CV
@@ -0,0 +1,244 @@
+/**
+ * @file    Code\utils\utils_async.cc.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   异步组提交写入的实现
+ *          * 后台线程空闲时等待条件变量; 生产者放入后只在后台线程睡眠时加锁唤醒 (sleeping_ 标志, 两边各一个 fence)
+ *          * 屏障的目标是调用时队列已占位的位置, 包括其他线程正在放入的行
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#include "./utils_async.h"
+
+#include <algorithm>
+#include <chrono>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+Utils_AsyncWriter::~Utils_AsyncWriter()
+{
+    Close();
+}
+
+bool Utils_AsyncWriter::Open(const std::string & file, const Options & opt)
+{
+    Close();
+    fp_ = fopen(file.c_str(), opt.append ? "ab" : "wb");
+    if (fp_ == nullptr)
+        return false;
+    // 拼接在自己的缓冲区中 一次提交一次 write
+    setvbuf(fp_, nullptr, _IONBF, 0);
+    opt_ = opt;
+    opt_.batch_bytes = std::max<size_t>(opt_.batch_bytes, 1);
+    queue_.reset(new Utils_MpmcQueue<std::string>(std::max<size_t>(opt_.queue_capacity, 2)));
+    wake_ = false;
+    stop_.store(false);
+    failed_.store(false);
+    flush_target_ = sync_target_ = flushed_ = synced_ = 0;
+    lines_.store(0);
+    commits_.store(0);
+    running_ = true;
+    thread_ = std::thread(&Utils_AsyncWriter::Run, this);
+    return true;
+}
+
+void Utils_AsyncWriter::Wake(void)
+{
+    // 与 Run 中 sleeping_ 的写入 + 队列检查配对: 要么这里看到睡眠, 要么 Run 看到新的元素
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!sleeping_.load(std::memory_order_relaxed))
+        return;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        wake_ = true;
+    }
+    wake_cv_.notify_one();
+}
+
+bool Utils_AsyncWriter::Write(std::string line)
+{
+    if (!IsOpen() || failed_.load(std::memory_order_relaxed))
+        return false;
+    for (int spin = 0; !queue_->TryPush(line); spin++)
+    {
+        // 队列满  唤醒后台线程, 先让出 CPU, 再短暂睡眠
+        Wake();
+        if (failed_.load(std::memory_order_relaxed) || stop_.load(std::memory_order_relaxed))
+            return false;
+        if (spin < 16)
+            std::this_thread::yield();
+        else
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+    Wake();
+    return true;
+}
+
+bool Utils_AsyncWriter::TryWrite(std::string & line)
+{
+    if (!IsOpen() || failed_.load(std::memory_order_relaxed) || !queue_->TryPush(line))
+        return false;
+    Wake();
+    return true;
+}
+
+bool Utils_AsyncWriter::Barrier(bool sync)
+{
+    if (!IsOpen())
+        return false;
+    const uint64_t target = queue_->Pushed();
+    std::unique_lock<std::mutex> lock(mutex_);
+    uint64_t &want = sync ? sync_target_ : flush_target_;
+    want = std::max(want, target);
+    wake_ = true;
+    wake_cv_.notify_one();
+    done_cv_.wait(lock, [&]() { return (sync ? synced_ : flushed_) >= target || !running_; });
+    return !failed_.load();
+}
+
+bool Utils_AsyncWriter::Flush(void)
+{
+    return Barrier(false);
+}
+
+bool Utils_AsyncWriter::Sync(void)
+{
+    return Barrier(true);
+}
+
+bool Utils_AsyncWriter::Close(void)
+{
+    if (!IsOpen())
+        return false;
+    stop_.store(true);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        wake_ = true;
+    }
+    wake_cv_.notify_one();
+    thread_.join();
+    bool ok = !failed_.load();
+    ok = (fclose(fp_) == 0) && ok;
+    fp_ = nullptr;
+    queue_.reset();
+    return ok;
+}
+
+bool Utils_AsyncWriter::Commit(std::string & buf, bool sync)
+{
+    if (!buf.empty())
+    {
+        if (!failed_.load(std::memory_order_relaxed) &&
+            (fwrite(buf.data(), 1, buf.size(), fp_) != buf.size() || fflush(fp_) != 0))
+            failed_.store(true);
+        commits_.fetch_add(1, std::memory_order_release);
+        buf.clear();
+    }
+    if (sync && !failed_.load(std::memory_order_relaxed))
+    {
+#ifdef _WIN32
+        if (_commit(_fileno(fp_)) != 0)
+            failed_.store(true);
+#else
+        if (fsync(fileno(fp_)) != 0)
+            failed_.store(true);
+#endif
+    }
+    return !failed_.load();
+}
+
+/**
+ * @fn  void Utils_AsyncWriter::Run(void)
+ *
+ * @brief   后台线程  取出的行拼接到 buf, 满足提交条件时一次写入, 然后完成已经满足的屏障
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+void Utils_AsyncWriter::Run(void)
+{
+    typedef std::chrono::steady_clock Clock;
+    const auto interval = std::chrono::milliseconds(std::max(opt_.commit_ms, 0));
+    std::string buf;
+    buf.reserve(std::min<size_t>(opt_.batch_bytes, size_t(64) << 20) + 4096);
+    uint64_t popped = 0;
+    uint64_t pending = 0;       // buf 中的行数
+    Clock::time_point first;
+
+    for (;;)
+    {
+        bool got = false;
+        for (std::string line; buf.size() < opt_.batch_bytes && queue_->TryPop(line); popped++, pending++)
+        {
+            if (buf.empty())
+                first = Clock::now();
+            buf += line;
+            if (opt_.newline)
+                buf += '\n';
+            got = true;
+        }
+
+        uint64_t flush_target, sync_target;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            flush_target = flush_target_;
+            sync_target = sync_target_;
+        }
+        const bool stop = stop_.load(std::memory_order_acquire);
+        const bool drained = popped == queue_->Pushed();
+        const bool want_sync = sync_target > synced_ && popped >= sync_target;
+        const bool want_flush = flush_target > flushed_ && popped >= flush_target;
+        const bool due = buf.size() >= opt_.batch_bytes || (!buf.empty() && Clock::now() - first >= interval) ||
+            (stop && drained);
+        if ((due && !buf.empty()) || want_sync || want_flush)
+        {
+            const bool sync = want_sync || (opt_.sync_on_commit && !buf.empty());
+            Commit(buf, sync);
+            lines_.fetch_add(pending, std::memory_order_release);
+            pending = 0;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                flushed_ = popped;
+                if (sync)
+                    synced_ = popped;
+            }
+            done_cv_.notify_all();
+        }
+        if (stop && drained && buf.empty())
+            break;
+        if (got || buf.size() >= opt_.batch_bytes)
+            continue;
+        if (popped != queue_->Pushed())
+        {
+            // 生产者已占位 还没有写完
+            std::this_thread::yield();
+            continue;
+        }
+
+        // 空闲  等待唤醒 或 提交时间到
+        std::unique_lock<std::mutex> lock(mutex_);
+        sleeping_.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!wake_ && popped == queue_->Pushed() && !stop_.load() && flush_target_ <= flushed_ && sync_target_ <= synced_)
+        {
+            auto timeout = std::chrono::milliseconds(100);
+            if (!buf.empty())
+                timeout = std::max(std::chrono::milliseconds(0),
+                                   std::chrono::duration_cast<std::chrono::milliseconds>(first + interval - Clock::now()) +
+                                   std::chrono::milliseconds(1));
+            wake_cv_.wait_for(lock, timeout, [this]() { return wake_; });
+        }
+        wake_ = false;
+        sleeping_.store(false, std::memory_order_relaxed);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_ = false;
+    }
+    done_cv_.notify_all();
+}
@@ -0,0 +1,171 @@
+/**
+ * @file    Code\utils\utils_async.h.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   异步文本写入  代替 Utils_Files::WriteStringTxt 每行 flush 一次
+ *          * 生产者把行放入无锁队列 (Utils_MpmcQueue) 后立即返回, 后台线程把多行拼接后一次写入 (组提交)
+ *          * 提交条件: 缓冲的数据达到 batch_bytes, 最早的一行等待超过 commit_ms, 或者有屏障请求
+ *          * Flush 等待之前的行写入系统, Sync 再 fsync 到磁盘 (持久化屏障)
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#pragma once
+#ifndef UTILS_ASYNC_H_
+#define UTILS_ASYNC_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include "./utils_concurrent.h"
+
+/**
+ * @class   Utils_AsyncWriter utils_async.h Code\utils\utils_async.h
+ *
+ * @brief   异步组提交写入  Write 可以在多个线程同时调用, 同一线程写入的行保持顺序
+ *          * Open / Close 不能与 Write 同时调用
+ *          *   Utils_AsyncWriter writer;
+ *          *   writer.Open("measure.txt");
+ *          *   writer.Write(line);             // 测量循环中调用, 不等待磁盘
+ *          *   writer.Sync();                  // 需要确认已经落盘时
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+class Utils_AsyncWriter
+{
+    public:
+
+    struct Options
+    {
+        size_t queue_capacity = size_t(1) << 16;    ///< 队列中最多的行数, 满时 Write 等待
+        size_t batch_bytes = size_t(1) << 20;       ///< 缓冲的数据达到时提交
+        int commit_ms = 50;                         ///< 最早的一行等待超过时提交
+        bool sync_on_commit = false;                ///< 每次提交都 fsync
+        bool append = true;                         ///< 追加 或 清空文件
+        bool newline = true;                        ///< 每行后面加 "\n"
+    };
+
+    Utils_AsyncWriter() = default;
+    ~Utils_AsyncWriter();
+
+    Utils_AsyncWriter(const Utils_AsyncWriter &) = delete;
+    Utils_AsyncWriter &operator=(const Utils_AsyncWriter &) = delete;
+
+    /**
+     * @fn  bool Utils_AsyncWriter::Open(const std::string &file, const Options &opt);
+     *
+     * @brief   打开文件并启动后台线程  已打开的先 Close
+     */
+    bool Open(const std::string &file, const Options &opt);
+
+    bool Open(const std::string &file)
+    {
+        return Open(file, Options());
+    }
+
+    /**
+     * @fn  bool Utils_AsyncWriter::Write(std::string line);
+     *
+     * @brief   放入一行  队列满时等待后台线程取出
+     *
+     * @return  false 没有打开 或 写入已经失败
+     */
+    bool Write(std::string line);
+
+    /**
+     * @fn  bool Utils_AsyncWriter::TryWrite(std::string &line);
+     *
+     * @brief   不等待  队列满时返回 false, line 保持不变
+     */
+    bool TryWrite(std::string &line);
+
+    /**
+     * @fn  bool Utils_AsyncWriter::Flush(void);
+     *
+     * @brief   等待调用之前放入的行 (所有线程) 写入系统
+     */
+    bool Flush(void);
+
+    /**
+     * @fn  bool Utils_AsyncWriter::Sync(void);
+     *
+     * @brief   持久化屏障  等待调用之前放入的行写入并 fsync, 返回 true 后数据在磁盘上
+     */
+    bool Sync(void);
+
+    /**
+     * @fn  bool Utils_AsyncWriter::Close(void);
+     *
+     * @brief   写完队列中剩余的行, 停止后台线程并关闭文件  返回之前所有写入是否成功
+     */
+    bool Close(void);
+
+    bool IsOpen(void) const
+    {
+        return fp_ != nullptr;
+    }
+
+    bool good(void) const
+    {
+        return IsOpen() && !failed_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @fn  uint64_t Utils_AsyncWriter::Lines(void) const
+     *
+     * @brief   已经写入系统的行数
+     */
+    uint64_t Lines(void) const
+    {
+        return lines_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @fn  uint64_t Utils_AsyncWriter::Commits(void) const
+     *
+     * @brief   提交 (write 调用) 的次数
+     */
+    uint64_t Commits(void) const
+    {
+        return commits_.load(std::memory_order_acquire);
+    }
+
+    private:
+
+    bool Barrier(bool sync);
+    void Wake(void);
+    void Run(void);
+    bool Commit(std::string &buf, bool sync);
+
+    Options opt_;
+    FILE *fp_ = nullptr;
+    std::unique_ptr<Utils_MpmcQueue<std::string>> queue_;
+    std::thread thread_;
+
+    std::mutex mutex_;
+    std::condition_variable wake_cv_;       ///< 唤醒后台线程
+    std::condition_variable done_cv_;       ///< 屏障完成
+    bool wake_ = false;
+    std::atomic<bool> sleeping_{ false };
+    std::atomic<bool> stop_{ false };
+    std::atomic<bool> failed_{ false };
+
+    // 屏障  目标为队列位置, 后台线程取到该位置并提交后完成
+    uint64_t flush_target_ = 0;
+    uint64_t sync_target_ = 0;
+    uint64_t flushed_ = 0;                  ///< 已写入系统的队列位置
+    uint64_t synced_ = 0;                   ///< 已 fsync 的队列位置
+    bool running_ = false;
+
+    std::atomic<uint64_t> lines_{ 0 };
+    std::atomic<uint64_t> commits_{ 0 };
+};
+
+#endif  // UTILS_ASYNC_H_
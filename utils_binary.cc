@@ -0,0 +1,200 @@
+/**
+ * @file    Code\utils\utils_binary.cc.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   带缓冲的二进制写入的实现
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#include "./utils_binary.h"
+
+#include <algorithm>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+Utils_BinaryWriter::~Utils_BinaryWriter()
+{
+    Close();
+}
+
+bool Utils_BinaryWriter::Init(const Options &opt)
+{
+    cap_ = std::max<size_t>(opt.buffer_size, 64);
+    buf_.reset(new char[cap_]);
+    len_ = 0;
+    written_ = 0;
+    swap_ = Utils_ByteOrder::NeedSwap(opt.endian);
+    failed_ = false;
+    sync_ = opt.sync;
+    policy_ = opt.policy;
+    threshold_ = std::min(opt.flush_threshold, cap_);
+    return true;
+}
+
+bool Utils_BinaryWriter::Open(const std::string & file, const Options & opt, bool append)
+{
+    Close();
+    fp_ = fopen(file.c_str(), append ? "ab" : "wb");
+    if (fp_ == nullptr)
+        return false;
+    // 已经有自己的缓冲区 关闭 stdio 缓冲, fwrite 直接写入
+    setvbuf(fp_, nullptr, _IONBF, 0);
+    return Init(opt);
+}
+
+bool Utils_BinaryWriter::Attach(std::ostream & os, const Options & opt)
+{
+    Close();
+    os_ = &os;
+    return Init(opt);
+}
+
+bool Utils_BinaryWriter::WriteSink(const char * data, size_t size)
+{
+    if (failed_)
+        return false;
+    if (fp_ != nullptr)
+        failed_ = fwrite(data, 1, size, fp_) != size;
+    else if (os_ != nullptr)
+        failed_ = !os_->write(data, static_cast<std::streamsize>(size));
+    else
+        failed_ = true;
+    if (!failed_)
+        written_ += size;
+    return !failed_;
+}
+
+bool Utils_BinaryWriter::WriteBuffer(void)
+{
+    if (len_ == 0)
+        return !failed_;
+    bool ok = WriteSink(buf_.get(), len_);
+    len_ = 0;
+    return ok;
+}
+
+bool Utils_BinaryWriter::AfterPut(void)
+{
+    switch (policy_)
+    {
+        case kThreshold:
+            return len_ < threshold_ || Flush();
+        case kAlways:
+            return Flush();
+        default:
+            return !failed_;
+    }
+}
+
+bool Utils_BinaryWriter::PutBytes(const void * data, size_t size)
+{
+    if (failed_ || !IsOpen())
+        return false;
+    const char *p = static_cast<const char *>(data);
+    if (size <= cap_ - len_)
+    {
+        if (size != 0)
+            memcpy(buf_.get() + len_, p, size);
+        len_ += size;
+        return AfterPut();
+    }
+    // 先填满缓冲区 写出, 剩余部分大于缓冲区时直接写入 避免再拷贝一次
+    const size_t head = cap_ - len_;
+    memcpy(buf_.get() + len_, p, head);
+    len_ = cap_;
+    if (!WriteBuffer())
+        return false;
+    p += head;
+    size -= head;
+    if (size >= cap_)
+    {
+        if (!WriteSink(p, size))
+            return false;
+        return policy_ == kWhenFull || Flush();
+    }
+    memcpy(buf_.get(), p, size);
+    len_ = size;
+    return AfterPut();
+}
+
+bool Utils_BinaryWriter::PutString(std::string_view str, size_t len, char pad)
+{
+    const size_t n = std::min(str.size(), len);
+    if (!PutBytes(str.data(), n))
+        return false;
+    // 补齐  分段写入缓冲区
+    char fill[256];
+    memset(fill, pad, sizeof(fill));
+    for (size_t rest = len - n; rest > 0;)
+    {
+        const size_t k = std::min(rest, sizeof(fill));
+        if (!PutBytes(fill, k))
+            return false;
+        rest -= k;
+    }
+    return true;
+}
+
+bool Utils_BinaryWriter::PutCString(std::string_view str)
+{
+    return PutBytes(str.data(), str.size()) && Append("", 1);
+}
+
+bool Utils_BinaryWriter::Flush(void)
+{
+    if (!IsOpen())
+        return false;
+    if (!WriteBuffer())
+        return false;
+    if (fp_ != nullptr)
+    {
+        failed_ = fflush(fp_) != 0;
+        if (!failed_ && sync_)
+            return Sync();
+    }
+    else
+    {
+        failed_ = !os_->flush();
+    }
+    return !failed_;
+}
+
+bool Utils_BinaryWriter::Sync(void)
+{
+    if (!IsOpen() || !WriteBuffer())
+        return false;
+    if (fp_ == nullptr)
+    {
+        failed_ = !os_->flush();
+        return !failed_;
+    }
+    if (fflush(fp_) != 0)
+        failed_ = true;
+#ifdef _WIN32
+    else if (_commit(_fileno(fp_)) != 0)
+        failed_ = true;
+#else
+    else if (fsync(fileno(fp_)) != 0)
+        failed_ = true;
+#endif
+    return !failed_;
+}
+
+bool Utils_BinaryWriter::Close(void)
+{
+    if (!IsOpen())
+        return false;
+    bool ok = Flush();
+    if (fp_ != nullptr)
+        ok = (fclose(fp_) == 0) && ok;
+    fp_ = nullptr;
+    os_ = nullptr;
+    buf_.reset();
+    cap_ = 0;
+    len_ = 0;
+    return ok;
+}
@@ -0,0 +1,354 @@
+/**
+ * @file    Code\utils\utils_binary.h.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   带缓冲的二进制写入  代替 Utils_Files::WriteData 每个值一次 fstream::write
+ *          * 数据先写入用户态缓冲区 (默认 1MB), 满了 或 按刷新策略 一次写入文件
+ *          * 可以指定 小端 / 大端 / 本机 字节序, 数组在缓冲区中直接转换字节序
+ *          * 定长字符串字段 不足补齐 超长截断, 与 Utils_MappedReader::ReadString 对应
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#pragma once
+#ifndef UTILS_BINARY_H_
+#define UTILS_BINARY_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#ifdef _MSC_VER
+#include <stdlib.h>
+#endif
+
+/**
+ * @brief   字节序
+ */
+enum class Utils_Endian : uint8_t
+{
+    kLittle,
+    kBig,
+    kNative,
+};
+
+/**
+ * @class   Utils_ByteOrder utils_binary.h Code\utils\utils_binary.h
+ *
+ * @brief   字节序转换  支持 整数 浮点 枚举
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+class Utils_ByteOrder
+{
+    public:
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    static constexpr bool kNativeLittle = false;
+#else
+    static constexpr bool kNativeLittle = true;
+#endif
+
+    /**
+     * @fn  static bool Utils_ByteOrder::NeedSwap(Utils_Endian endian)
+     *
+     * @brief   按 endian 写出时是否需要交换字节
+     */
+    static constexpr bool NeedSwap(Utils_Endian endian)
+    {
+        return endian != Utils_Endian::kNative && ((endian == Utils_Endian::kLittle) != kNativeLittle);
+    }
+
+    template<typename T>
+    static T Swap(T value)
+    {
+        static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>, "T must be arithmetic or enum");
+        if constexpr (sizeof(T) == 1)
+        {
+            return value;
+        }
+        else
+        {
+            using U = std::conditional_t<sizeof(T) == 2, uint16_t, std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>>;
+            static_assert(sizeof(U) == sizeof(T), "unsupported size");
+            U u;
+            memcpy(&u, &value, sizeof(T));
+            u = SwapUnsigned(u);
+            memcpy(&value, &u, sizeof(T));
+            return value;
+        }
+    }
+
+    private:
+
+    static uint16_t SwapUnsigned(uint16_t v)
+    {
+#ifdef _MSC_VER
+        return _byteswap_ushort(v);
+#else
+        return __builtin_bswap16(v);
+#endif
+    }
+
+    static uint32_t SwapUnsigned(uint32_t v)
+    {
+#ifdef _MSC_VER
+        return _byteswap_ulong(v);
+#else
+        return __builtin_bswap32(v);
+#endif
+    }
+
+    static uint64_t SwapUnsigned(uint64_t v)
+    {
+#ifdef _MSC_VER
+        return _byteswap_uint64(v);
+#else
+        return __builtin_bswap64(v);
+#endif
+    }
+};
+
+/**
+ * @class   Utils_BinaryWriter utils_binary.h Code\utils\utils_binary.h
+ *
+ * @brief   二进制写入  写入文件 或 已有的 std::ostream (例如 Utils_Files 使用的 fstream)
+ *          * 写入失败后 good() 为 false, 之后的写入都返回 false
+ *          * 析构时 Close, 写入缓冲区中剩余的数据
+ *          *   Utils_BinaryWriter::Options opt;
+ *          *   opt.endian = Utils_Endian::kBig;
+ *          *   Utils_BinaryWriter writer;
+ *          *   writer.Open("frame.bin", opt);
+ *          *   writer.Put<uint32_t>(count);
+ *          *   writer.PutArray(points.data(), points.size());
+ *          *   writer.PutString(name, 32);
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+class Utils_BinaryWriter
+{
+    public:
+
+    /**
+     * @brief   刷新策略  何时把缓冲区写入文件
+     */
+    enum FlushPolicy
+    {
+        kWhenFull,      ///< 缓冲区满 或 调用 Flush / Close 时
+        kThreshold,     ///< 缓冲的数据达到 flush_threshold 字节时
+        kAlways,        ///< 每次 Put 之后 (调试 或 需要其他进程立即看到数据时)
+    };
+
+    struct Options
+    {
+        size_t buffer_size = size_t(1) << 20;   ///< 缓冲区大小 最小 64 字节
+        Utils_Endian endian = Utils_Endian::kLittle;
+        FlushPolicy policy = kWhenFull;
+        size_t flush_threshold = size_t(64) << 10;
+        bool sync = false;                      ///< 每次刷新之后 fsync (只对 Open 打开的文件有效)
+    };
+
+    Utils_BinaryWriter() = default;
+    ~Utils_BinaryWriter();
+
+    Utils_BinaryWriter(const Utils_BinaryWriter &) = delete;
+    Utils_BinaryWriter &operator=(const Utils_BinaryWriter &) = delete;
+
+    /**
+     * @fn  bool Utils_BinaryWriter::Open(const std::string &file, const Options &opt, bool append = false);
+     *
+     * @brief   打开文件  已打开的先 Close
+     */
+    bool Open(const std::string &file, const Options &opt, bool append = false);
+
+    bool Open(const std::string &file)
+    {
+        return Open(file, Options());
+    }
+
+    /**
+     * @fn  bool Utils_BinaryWriter::Attach(std::ostream &os, const Options &opt);
+     *
+     * @brief   写入已有的流  不拥有流, Close 时只刷新不关闭
+     */
+    bool Attach(std::ostream &os, const Options &opt);
+
+    bool Attach(std::ostream &os)
+    {
+        return Attach(os, Options());
+    }
+
+    /**
+     * @fn  bool Utils_BinaryWriter::Flush(void);
+     *
+     * @brief   缓冲区写入文件 (系统缓存), Options::sync 时同时 fsync
+     */
+    bool Flush(void);
+
+    /**
+     * @fn  bool Utils_BinaryWriter::Sync(void);
+     *
+     * @brief   Flush 并 fsync, 返回后数据已写入磁盘
+     */
+    bool Sync(void);
+
+    /**
+     * @fn  bool Utils_BinaryWriter::Close(void);
+     *
+     * @brief   刷新并关闭  返回之前所有写入是否成功
+     */
+    bool Close(void);
+
+    bool IsOpen(void) const
+    {
+        return fp_ != nullptr || os_ != nullptr;
+    }
+
+    bool good(void) const
+    {
+        return IsOpen() && !failed_;
+    }
+
+    /**
+     * @fn  uint64_t Utils_BinaryWriter::Tell(void) const
+     *
+     * @brief   已写入的字节数 (含缓冲区中的)  Open 追加时从 0 开始
+     */
+    uint64_t Tell(void) const
+    {
+        return written_ + len_;
+    }
+
+    size_t Buffered(void) const
+    {
+        return len_;
+    }
+
+    /**
+     * @fn  template<typename T> bool Utils_BinaryWriter::Put(T value)
+     *
+     * @brief   写入一个 整数 / 浮点 / 枚举, 按 Options::endian 转换字节序
+     */
+    template<typename T>
+    bool Put(T value)
+    {
+        static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>, "use PutRaw for structs");
+        if (swap_)
+            value = Utils_ByteOrder::Swap(value);
+        return Append(&value, sizeof(T));
+    }
+
+    /**
+     * @fn  template<typename T> bool Utils_BinaryWriter::PutArray(const T *data, size_t count)
+     *
+     * @brief   写入数组  字节序相同时整块拷贝, 否则在缓冲区中逐个转换
+     */
+    template<typename T>
+    bool PutArray(const T *data, size_t count)
+    {
+        static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>, "use PutRaw for structs");
+        if (!swap_ || sizeof(T) == 1)
+            return PutBytes(data, count * sizeof(T));
+        if (failed_ || !IsOpen())
+            return false;
+        while (count > 0)
+        {
+            size_t room = (cap_ - len_) / sizeof(T);
+            if (room == 0)
+            {
+                if (!WriteBuffer())
+                    return false;
+                continue;
+            }
+            const size_t n = room < count ? room : count;
+            char *dst = buf_.get() + len_;
+            for (size_t i = 0; i < n; i++)
+            {
+                T v = Utils_ByteOrder::Swap(data[i]);
+                memcpy(dst + i * sizeof(T), &v, sizeof(T));
+            }
+            len_ += n * sizeof(T);
+            data += n;
+            count -= n;
+        }
+        return AfterPut();
+    }
+
+    template<typename T>
+    bool PutArray(const std::vector<T> &data)
+    {
+        return PutArray(data.data(), data.size());
+    }
+
+    /**
+     * @fn  template<typename T> bool Utils_BinaryWriter::PutRaw(const T &value)
+     *
+     * @brief   按内存原样写入 POD 结构体, 不转换字节序
+     */
+    template<typename T>
+    bool PutRaw(const T &value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+        return Append(&value, sizeof(T));
+    }
+
+    /**
+     * @fn  bool Utils_BinaryWriter::PutBytes(const void *data, size_t size);
+     *
+     * @brief   写入字节  大于缓冲区的数据不经过缓冲区直接写入
+     */
+    bool PutBytes(const void *data, size_t size);
+
+    /**
+     * @fn  bool Utils_BinaryWriter::PutString(std::string_view str, size_t len, char pad = '\0');
+     *
+     * @brief   定长字符串字段  写入 len 个字节, 不足用 pad 补齐, 超长截断
+     */
+    bool PutString(std::string_view str, size_t len, char pad = '\0');
+
+    /**
+     * @fn  bool Utils_BinaryWriter::PutCString(std::string_view str);
+     *
+     * @brief   字符串 + '\0'
+     */
+    bool PutCString(std::string_view str);
+
+    private:
+
+    bool Append(const void *data, size_t size)
+    {
+        if (size <= cap_ - len_ && !failed_)
+        {
+            memcpy(buf_.get() + len_, data, size);
+            len_ += size;
+            return policy_ == kWhenFull || AfterPut();
+        }
+        return PutBytes(data, size);
+    }
+
+    bool Init(const Options &opt);
+    bool AfterPut(void);
+    bool WriteBuffer(void);
+    bool WriteSink(const char *data, size_t size);
+
+    std::unique_ptr<char[]> buf_;
+    size_t cap_ = 0;
+    size_t len_ = 0;
+    uint64_t written_ = 0;
+    bool swap_ = false;
+    bool failed_ = false;
+    bool sync_ = false;
+    FlushPolicy policy_ = kWhenFull;
+    size_t threshold_ = 0;
+    FILE *fp_ = nullptr;
+    std::ostream *os_ = nullptr;
+};
+
+#endif  // UTILS_BINARY_H_
@@ -0,0 +1,373 @@
+/**
+ * @file    Code\utils\utils_builder.h.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   字符串拼接组件  栈上内联缓冲区 + 可选的内存池, 代替 std::string 的 + / append 链
+ *          * 内联缓冲区放得下时 整个拼接过程不分配内存, 超出后从内存池 (或堆) 扩容
+ *          * 数字通过 Utils_Format 直接写入缓冲区, 不经过 std::to_string
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#pragma once
+#ifndef UTILS_BUILDER_H_
+#define UTILS_BUILDER_H_
+
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "./utils_format.h"
+
+/**
+ * @class   Utils_Arena utils_builder.h Code\utils\utils_builder.h
+ *
+ * @brief   简单的线性内存池  只分配不单独释放, Reset 时整体回收, 非线程安全
+ *          * 适合一次处理过程中的大量临时字符串, 例如一次目录遍历 或一帧日志
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+class Utils_Arena
+{
+    public:
+
+    /**
+     * @fn  explicit Utils_Arena::Utils_Arena(size_t block_size = 4096)
+     *
+     * @brief   构造  第一次分配时才申请内存块
+     *
+     * @param   block_size  (Optional) 每个内存块的大小
+     */
+    explicit Utils_Arena(size_t block_size = 4096) : block_size_(block_size) {}
+
+    Utils_Arena(const Utils_Arena &) = delete;
+    Utils_Arena &operator=(const Utils_Arena &) = delete;
+
+    /**
+     * @fn  void *Utils_Arena::Allocate(size_t n, size_t align = alignof(std::max_align_t))
+     *
+     * @brief   分配 n 字节  当前块不够时申请新块, 超过块大小的请求单独成块
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param   n       字节数
+     * @param   align   (Optional) 对齐 必须为 2 的幂
+     *
+     * @return  内存地址 在 Reset 或析构之前有效
+     */
+    void *Allocate(size_t n, size_t align = alignof(std::max_align_t))
+    {
+        size_t pos = AlignedPos(align);
+        if (blocks_.empty() || pos + n > blocks_.back().cap)
+        {
+            Block block;
+            block.cap = n + align > block_size_ ? n + align : block_size_;
+            block.mem.reset(new char[block.cap]);
+            blocks_.push_back(std::move(block));
+            used_ = 0;
+            pos = AlignedPos(align);
+        }
+        used_ = pos + n;
+        total_ += n;
+        return blocks_.back().mem.get() + pos;
+    }
+
+    /**
+     * @fn  void Utils_Arena::Reset(void)
+     *
+     * @brief   回收全部内存  保留第一个块继续使用
+     */
+    void Reset(void)
+    {
+        if (blocks_.size() > 1)
+            blocks_.resize(1);
+        used_ = 0;
+        total_ = 0;
+    }
+
+    /**
+     * @fn  size_t Utils_Arena::Used(void) const
+     *
+     * @brief   已经分配出去的字节数
+     */
+    size_t Used(void) const
+    {
+        return total_;
+    }
+
+    private:
+
+    struct Block
+    {
+        std::unique_ptr<char[]> mem;
+        size_t cap = 0;
+    };
+
+    // 当前块中 下一个按 align 对齐的位置
+    size_t AlignedPos(size_t align) const
+    {
+        if (blocks_.empty())
+            return 0;
+        uintptr_t cur = reinterpret_cast<uintptr_t>(blocks_.back().mem.get()) + used_;
+        return used_ + static_cast<size_t>(((cur + align - 1) & ~static_cast<uintptr_t>(align - 1)) - cur);
+    }
+
+    std::vector<Block> blocks_;
+    size_t block_size_;
+    size_t used_ = 0;       ///< 当前块已使用
+    size_t total_ = 0;
+};
+
+/**
+ * @class   Utils_StringBuilder utils_builder.h Code\utils\utils_builder.h
+ *
+ * @brief   字符串拼接  N 字节的内联缓冲区, 超出后从 arena (没有则从堆) 扩容, 结果始终以 \0 结尾
+ *          * Utils_StringBuilder<> sb;  sb.Append(path).Append('\\').Append(idx).Append(".bmp");
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ *
+ * @tparam  N   内联缓冲区大小
+ */
+template<size_t N = 256>
+class Utils_StringBuilder
+{
+    static_assert(N >= 2, "inline buffer too small");
+
+    public:
+
+    Utils_StringBuilder()
+    {
+        inline_[0] = '\0';
+    }
+
+    /**
+     * @fn  explicit Utils_StringBuilder::Utils_StringBuilder(Utils_Arena *arena)
+     *
+     * @brief   扩容时从 arena 分配, 内存随 arena 回收
+     *
+     * @param [in,out]  arena   If non-null, the arena
+     */
+    explicit Utils_StringBuilder(Utils_Arena *arena) : arena_(arena)
+    {
+        inline_[0] = '\0';
+    }
+
+    ~Utils_StringBuilder()
+    {
+        ReleaseHeap();
+    }
+
+    Utils_StringBuilder(const Utils_StringBuilder &) = delete;
+    Utils_StringBuilder &operator=(const Utils_StringBuilder &) = delete;
+
+    /**
+     * @fn  template<typename T> Utils_StringBuilder &Utils_StringBuilder::Append(const T &val)
+     *
+     * @brief   追加  字符串 / string_view / 字符 原样追加, 整数 浮点数 格式化后追加
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @tparam  T   Generic type parameter.
+     * @param   val The value
+     *
+     * @return  自身 可以链式调用
+     */
+    template<typename T>
+    Utils_StringBuilder &Append(const T &val)
+    {
+        if constexpr (std::is_same_v<T, char>)
+        {
+            Reserve(1)[0] = val;
+            size_++;
+            data_[size_] = '\0';
+        }
+        else if constexpr (std::is_same_v<T, bool>)
+        {
+            Append(std::string_view(val ? "true" : "false"));
+        }
+        else if constexpr (std::is_integral_v<T>)
+        {
+            AppendInt(val);
+        }
+        else if constexpr (std::is_floating_point_v<T>)
+        {
+            AppendFloat(static_cast<double>(val));
+        }
+        else
+        {
+            std::string_view str(val);
+            memcpy(Reserve(str.size()), str.data(), str.size());
+            size_ += str.size();
+            data_[size_] = '\0';
+        }
+        return *this;
+    }
+
+    /**
+     * @fn  template<typename T> Utils_StringBuilder &Utils_StringBuilder::AppendInt(T num, int width = 0, int base = 10)
+     *
+     * @brief   追加整数  前补 0 到 width 位
+     *
+     * @tparam  T   整数类型
+     * @param   num     Number of
+     * @param   width   (Optional) 最小宽度
+     * @param   base    (Optional) 进制 2-36
+     *
+     * @return  自身
+     */
+    template<typename T>
+    Utils_StringBuilder &AppendInt(T num, int width = 0, int base = 10)
+    {
+        char *dst = Reserve(Utils_Format::kIntBufSize + static_cast<size_t>(width > 0 ? width : 0));
+        size_t cap = Capacity() - size_;
+        if constexpr (std::is_signed_v<T>)
+            size_ += Utils_Format::FormatInt(dst, cap, static_cast<long long>(num), width, base);
+        else
+            size_ += Utils_Format::FormatUInt(dst, cap, static_cast<unsigned long long>(num), width, base);
+        data_[size_] = '\0';
+        return *this;
+    }
+
+    /**
+     * @fn  Utils_StringBuilder &Utils_StringBuilder::AppendFloat(double num, int precision = -1)
+     *
+     * @brief   追加浮点数  precision 为小数位数, 小于 0 时输出最短可还原表示
+     *
+     * @param   num         Number of
+     * @param   precision   (Optional) 小数位数
+     *
+     * @return  自身
+     */
+    Utils_StringBuilder &AppendFloat(double num, int precision = -1)
+    {
+        // 定点输出 1e308 需要 300 多位
+        size_t need = Utils_Format::kFloatBufSize + 330 + static_cast<size_t>(precision > 0 ? precision : 0);
+        char *dst = Reserve(Utils_Format::kFloatBufSize);
+        size_t n = Utils_Format::FormatFloat(dst, Capacity() - size_, num, precision);
+        if (n == 0)
+        {
+            dst = Reserve(need);
+            n = Utils_Format::FormatFloat(dst, Capacity() - size_, num, precision);
+        }
+        size_ += n;
+        data_[size_] = '\0';
+        return *this;
+    }
+
+    /**
+     * @fn  void Utils_StringBuilder::Resize(size_t n)
+     *
+     * @brief   截断到 n 个字符  用于递归拼接路径时回退, n 不能大于当前长度
+     *
+     * @param   n   新长度
+     */
+    void Resize(size_t n)
+    {
+        if (n < size_)
+        {
+            size_ = n;
+            data_[size_] = '\0';
+        }
+    }
+
+    void Clear(void)
+    {
+        Resize(0);
+    }
+
+    const char *c_str(void) const
+    {
+        return data_;
+    }
+
+    const char *data(void) const
+    {
+        return data_;
+    }
+
+    size_t size(void) const
+    {
+        return size_;
+    }
+
+    bool empty(void) const
+    {
+        return size_ == 0;
+    }
+
+    std::string_view view(void) const
+    {
+        return std::string_view(data_, size_);
+    }
+
+    std::string str(void) const
+    {
+        return std::string(data_, size_);
+    }
+
+    /**
+     * @fn  bool Utils_StringBuilder::IsInline(void) const
+     *
+     * @brief   是否仍在使用内联缓冲区 (没有发生过分配)
+     */
+    bool IsInline(void) const
+    {
+        return data_ == inline_;
+    }
+
+    private:
+
+    size_t Capacity(void) const
+    {
+        return cap_ - 1;    // 预留 \0
+    }
+
+    /**
+     * @fn  char *Utils_StringBuilder::Reserve(size_t n)
+     *
+     * @brief   保证尾部至少有 n 字节空间 (不含 \0)  按 2 倍扩容
+     *
+     * @param   n   字节数
+     *
+     * @return  当前结尾的地址
+     */
+    char *Reserve(size_t n)
+    {
+        if (size_ + n > Capacity())
+        {
+            size_t cap = cap_ * 2;
+            while (cap < size_ + n + 1)
+                cap *= 2;
+            char *mem = arena_ != nullptr ? static_cast<char *>(arena_->Allocate(cap, 1))
+                                          : static_cast<char *>(malloc(cap));
+            memcpy(mem, data_, size_ + 1);
+            ReleaseHeap();
+            data_ = mem;
+            cap_ = cap;
+        }
+        return data_ + size_;
+    }
+
+    void ReleaseHeap(void)
+    {
+        if (data_ != inline_ && arena_ == nullptr)
+            free(data_);
+    }
+
+    Utils_Arena *arena_ = nullptr;
+    char *data_ = inline_;
+    size_t size_ = 0;
+    size_t cap_ = N;
+    char inline_[N];
+};
+
+#endif  // UTILS_BUILDER_H_
@@ -0,0 +1,549 @@
+/**
+ * @file    Code\utils\utils_config.cc.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   配置文件读取的实现
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#include "./utils_config.h"
+#include "./utils_mmap.h"
+#include "./utils_string.h"
+#include "./utils_logger.h"
+#include "./Utils_Exception.h"
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <sys/stat.h>
+
+static inline bool IsBlank(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+static std::string_view Trim(std::string_view s)
+{
+    while (!s.empty() && IsBlank(s.front()))
+        s.remove_prefix(1);
+    while (!s.empty() && IsBlank(s.back()))
+        s.remove_suffix(1);
+    return s;
+}
+
+static std::string_view StripQuotes(std::string_view s)
+{
+    if (s.size() >= 2 && (s.front() == '"' || s.front() == '\'') && s.back() == s.front())
+        return s.substr(1, s.size() - 2);
+    return s;
+}
+
+Utils_ConfigValue Utils_ConfigValue::Parse(std::string_view text)
+{
+    Utils_ConfigValue v;
+    v.text = text;
+    std::string_view s = Trim(text);
+    if (s.empty())
+        return v;
+
+    if (Utils_String::StringEqualNoCase(s, "true") || Utils_String::StringEqualNoCase(s, "yes") ||
+        Utils_String::StringEqualNoCase(s, "on"))
+    {
+        v.b = true;
+        v.flags = kBool;
+        return v;
+    }
+    if (Utils_String::StringEqualNoCase(s, "false") || Utils_String::StringEqualNoCase(s, "no") ||
+        Utils_String::StringEqualNoCase(s, "off"))
+    {
+        v.flags = kBool;
+        return v;
+    }
+
+    // from_chars 不接受 '+'
+    bool neg = s.front() == '-';
+    std::string_view num = (neg || s.front() == '+') ? s.substr(1) : s;
+    if (num.empty() || num.front() == '-' || num.front() == '+')
+        return v;
+    const char *end = num.data() + num.size();
+    uint64_t u = 0;
+    std::from_chars_result r;
+    if (num.size() > 2 && num[0] == '0' && (num[1] == 'x' || num[1] == 'X'))
+        r = std::from_chars(num.data() + 2, end, u, 16);
+    else
+        r = std::from_chars(num.data(), end, u, 10);
+    if (r.ec == std::errc() && r.ptr == end)
+    {
+        v.i = neg ? static_cast<int64_t>(0 - u) : static_cast<int64_t>(u);
+        v.d = neg ? -static_cast<double>(u) : static_cast<double>(u);
+        v.b = u != 0;
+        v.flags = kInt | kDouble;
+        return v;
+    }
+
+    double d = 0;
+    r = std::from_chars(num.data(), end, d);
+    if (r.ec == std::errc() && r.ptr == end)
+    {
+        v.d = neg ? -d : d;
+        v.flags = kDouble;
+    }
+    return v;
+}
+
+std::vector<std::string_view> Utils_ConfigValue::SplitList(std::string_view text)
+{
+    std::vector<std::string_view> res;
+    std::string_view s = Trim(text);
+    if (s.size() >= 2 && s.front() == '[' && s.back() == ']')
+        s = Trim(s.substr(1, s.size() - 2));
+    if (s.empty())
+        return res;
+
+    char quote = 0;
+    size_t start = 0;
+    for (size_t i = 0; i <= s.size(); i++)
+    {
+        if (i < s.size() && quote != 0)
+        {
+            if (s[i] == quote)
+                quote = 0;
+        }
+        else if (i < s.size() && (s[i] == '"' || s[i] == '\''))
+        {
+            quote = s[i];
+        }
+        else if (i == s.size() || s[i] == ',')
+        {
+            res.push_back(StripQuotes(Trim(s.substr(start, i - start))));
+            start = i + 1;
+        }
+    }
+    return res;
+}
+
+Utils_ConfigTable::Utils_ConfigTable(std::string text, uint32_t generation)
+    : generation_(generation), text_(std::move(text))
+{
+    ParseText();
+}
+
+std::string_view Utils_ConfigTable::Store(std::string s)
+{
+    owned_.push_back(std::move(s));
+    return owned_.back();
+}
+
+size_t Utils_ConfigTable::IndexOf(std::string_view key) const
+{
+    auto it = std::lower_bound(keys_.begin(), keys_.end(), key);
+    if (it == keys_.end() || *it != key)
+        return npos;
+    return static_cast<size_t>(it - keys_.begin());
+}
+
+/**
+ * @fn  static std::string_view StripComment(std::string_view s, bool ini)
+ *
+ * @brief   去掉未加引号的值后面的注释  YAML 为 " #", INI 还有 " ;"
+ */
+static std::string_view StripComment(std::string_view s, bool ini)
+{
+    for (size_t i = 0; i < s.size(); i++)
+    {
+        if ((s[i] == '#' || (ini && s[i] == ';')) && (i == 0 || IsBlank(s[i - 1])))
+            return Trim(s.substr(0, i));
+    }
+    return s;
+}
+
+/**
+ * @fn  static bool Unquote(std::string_view s, std::string &out, std::string_view &inner)
+ *
+ * @brief   解析引号开头的值  双引号支持 \n \t \\ \" 转义, 单引号中 '' 表示一个 '
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ *
+ * @param           s       以引号开头的值
+ * @param [in,out]  out     有转义时的结果
+ * @param [in,out]  inner   没有转义时 引号之间的文本
+ *
+ * @return  True 需要使用 out, false 直接使用 inner
+ */
+static bool Unquote(std::string_view s, std::string &out, std::string_view &inner)
+{
+    const char q = s.front();
+    bool escaped = false;
+    size_t i = 1;
+    for (; i < s.size(); i++)
+    {
+        char c = s[i];
+        if (q == '"' && c == '\\' && i + 1 < s.size())
+        {
+            if (!escaped)
+                out.assign(s.data() + 1, i - 1);
+            escaped = true;
+            c = s[++i];
+            out.push_back(c == 'n' ? '\n' : c == 't' ? '\t' : c == 'r' ? '\r' : c == '0' ? '\0' : c);
+            continue;
+        }
+        if (c == q)
+        {
+            if (q == '\'' && i + 1 < s.size() && s[i + 1] == '\'')
+            {
+                if (!escaped)
+                    out.assign(s.data() + 1, i - 1);
+                escaped = true;
+                out.push_back('\'');
+                i++;
+                continue;
+            }
+            break;
+        }
+        if (escaped)
+            out.push_back(c);
+    }
+    inner = s.substr(1, i - 1);
+    return escaped;
+}
+
+/**
+ * @fn  void Utils_ConfigTable::ParseText(void)
+ *
+ * @brief   逐行解析
+ *          * YAML: 按缩进维护父节点栈, "key:" 后面为空或者为 !!tag 时作为父节点, 其后的 "- x" 作为列表收集
+ *          * INI : [section] 作为前缀, 遇到新的 section 清空父节点栈
+ *          * 键 值 尽量直接指向 text_, 只有拼接的键和转义过的值保存到 owned_
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+void Utils_ConfigTable::ParseText(void)
+{
+    struct Parent
+    {
+        size_t indent;
+        std::string_view key;   ///< 完整的键
+    };
+    std::vector<Parent> parents;
+    std::string_view section;
+    std::vector<std::pair<std::string_view, Utils_ConfigValue>> entries;
+
+    // 当前收集的 "- x" 列表, 拼成 "x, y" 作为父节点的值
+    std::string_view list_key;
+    size_t list_indent = 0;
+    std::string list;
+    bool list_any = false;
+    auto flush_list = [&]()
+    {
+        if (list_any)
+        {
+            Utils_ConfigValue v = Utils_ConfigValue::Parse(Store(std::move(list)));
+            v.flags = 0;
+            entries.emplace_back(list_key, v);
+        }
+        list_key = std::string_view();
+        list.clear();
+        list_any = false;
+    };
+
+    std::string scratch;
+    std::string_view all(text_);
+    for (size_t pos = 0; pos < all.size();)
+    {
+        size_t eol = all.find('\n', pos);
+        if (eol == std::string_view::npos)
+            eol = all.size();
+        std::string_view line = all.substr(pos, eol - pos);
+        pos = eol + 1;
+
+        size_t indent = 0;
+        while (indent < line.size() && (line[indent] == ' ' || line[indent] == '\t'))
+            indent++;
+        line = Trim(line);
+        if (line.empty() || line[0] == '#' || line[0] == ';' || line[0] == '%' || line.substr(0, 3) == "---" ||
+            line == "...")
+            continue;
+
+        // YAML 块列表
+        if (line[0] == '-' && (line.size() == 1 || IsBlank(line[1])))
+        {
+            if (list_key.empty() || indent < list_indent)
+                continue;
+            std::string_view item = Trim(line.substr(1));
+            if (!item.empty() && (item[0] == '"' || item[0] == '\''))
+            {
+                std::string_view inner;
+                if (Unquote(item, scratch, inner))
+                    item = scratch;
+                else
+                    item = inner;
+            }
+            else
+            {
+                item = StripComment(item, false);
+            }
+            if (list_any)
+                list += ", ";
+            // 含有 ',' 的项加引号, SplitList 不会切开
+            if (item.find(',') != std::string_view::npos)
+                list.append("\"").append(item).append("\"");
+            else
+                list.append(item);
+            list_any = true;
+            continue;
+        }
+        flush_list();
+
+        // INI section
+        if (line[0] == '[' && line.back() == ']' && line.find_first_of(":=") == std::string_view::npos)
+        {
+            section = Trim(line.substr(1, line.size() - 2));
+            parents.clear();
+            continue;
+        }
+
+        size_t delim = line.find_first_of(":=");
+        if (delim == std::string_view::npos || delim == 0)
+            continue;
+        const bool ini = line[delim] == '=';
+        std::string_view key = StripQuotes(Trim(line.substr(0, delim)));
+        std::string_view val = Trim(line.substr(delim + 1));
+
+        while (!parents.empty() && parents.back().indent >= indent)
+            parents.pop_back();
+        std::string_view prefix = parents.empty() ? section : parents.back().key;
+        std::string_view full = key;
+        if (!prefix.empty())
+        {
+            std::string s;
+            s.reserve(prefix.size() + 1 + key.size());
+            s.append(prefix).append(".").append(key);
+            full = Store(std::move(s));
+        }
+
+        bool quoted = false;
+        if (!val.empty() && (val[0] == '"' || val[0] == '\''))
+        {
+            std::string_view inner;
+            val = Unquote(val, scratch, inner) ? Store(scratch) : inner;
+            quoted = true;
+        }
+        else
+        {
+            val = StripComment(val, ini);
+        }
+
+        if (!quoted && (val.empty() || val.substr(0, 2) == "!!"))
+        {
+            parents.push_back({ indent, full });
+            list_key = full;
+            list_indent = indent;
+            continue;
+        }
+        Utils_ConfigValue v = Utils_ConfigValue::Parse(val);
+        if (quoted)
+            v.flags = 0;
+        entries.emplace_back(full, v);
+    }
+    flush_list();
+
+    // 排序 重复的键保留最后一个
+    std::stable_sort(entries.begin(), entries.end(),
+                     [](const auto &a, const auto &b) { return a.first < b.first; });
+    keys_.reserve(entries.size());
+    values_.reserve(entries.size());
+    for (size_t i = 0; i < entries.size(); i++)
+    {
+        if (i + 1 < entries.size() && entries[i + 1].first == entries[i].first)
+            continue;
+        keys_.push_back(entries[i].first);
+        values_.push_back(entries[i].second);
+    }
+}
+
+static bool ReadText(const std::string &file, std::string &text)
+{
+    Utils_MappedFile mf;
+    if (!mf.Open(file))
+        return false;
+    // 拷贝一份 文件被改写或截断时不影响正在读取的表
+    text.assign(mf.view());
+    return true;
+}
+
+static bool StatFile(const std::string &file, int64_t &mtime, int64_t &size)
+{
+#ifdef _WIN32
+    struct _stat64 st;
+    if (_stat64(file.c_str(), &st) != 0)
+        return false;
+    mtime = static_cast<int64_t>(st.st_mtime) * 1000000000;
+#else
+    struct stat st;
+    if (stat(file.c_str(), &st) != 0)
+        return false;
+#if defined(__linux__)
+    mtime = static_cast<int64_t>(st.st_mtim.tv_sec) * 1000000000 + st.st_mtim.tv_nsec;
+#else
+    mtime = static_cast<int64_t>(st.st_mtime) * 1000000000;
+#endif
+#endif
+    size = static_cast<int64_t>(st.st_size);
+    return true;
+}
+
+Utils_Config::Utils_Config()
+{
+    tables_.push_back(std::make_unique<Utils_ConfigTable>(std::string(), 0));
+    current_.store(tables_.back().get(), std::memory_order_release);
+}
+
+Utils_Config::~Utils_Config()
+{
+    StopWatch();
+}
+
+Utils_Config &Utils_Config::Global(void)
+{
+    static Utils_Config config;
+    return config;
+}
+
+void Utils_Config::Publish(std::string text)
+{
+    ReloadFn fn;
+    void *ctx;
+    const Utils_ConfigTable *table;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        tables_.push_back(std::make_unique<Utils_ConfigTable>(std::move(text), ++generation_));
+        table = tables_.back().get();
+        current_.store(table, std::memory_order_release);
+        fn = reload_fn_;
+        ctx = reload_ctx_;
+    }
+    LInfo("config loaded, generation {0}, {1} keys", table->Generation(), table->size());
+    if (fn != nullptr)
+        fn(ctx, *table);
+}
+
+void Utils_Config::Load(const std::string & file)
+{
+    std::string text;
+    int64_t mtime = 0, size = -1;
+    StatFile(file, mtime, size);
+    if (!ReadText(file, text))
+    {
+        LError("config file {0} not exist", file);
+        throw Utils_Exception(Error_YML_FileNotExist, file);
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        file_ = file;
+        file_mtime_ = mtime;
+        file_size_ = size;
+    }
+    Publish(std::move(text));
+}
+
+void Utils_Config::LoadString(std::string_view text)
+{
+    Publish(std::string(text));
+}
+
+bool Utils_Config::Reload(void)
+{
+    std::string file;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        file = file_;
+    }
+    if (file.empty())
+        return false;
+
+    std::string text;
+    int64_t mtime = 0, size = -1;
+    StatFile(file, mtime, size);
+    if (!ReadText(file, text))
+    {
+        LWarn("config file {0} reload failed, keep generation {1}", file, Generation());
+        return false;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        file_mtime_ = mtime;
+        file_size_ = size;
+    }
+    Publish(std::move(text));
+    return true;
+}
+
+bool Utils_Config::FileChanged(void)
+{
+    std::string file;
+    int64_t old_mtime, old_size;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        file = file_;
+        old_mtime = file_mtime_;
+        old_size = file_size_;
+    }
+    int64_t mtime, size;
+    if (file.empty() || !StatFile(file, mtime, size))
+        return false;
+    return mtime != old_mtime || size != old_size;
+}
+
+bool Utils_Config::Watch(int interval_ms)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (file_.empty())
+            return false;
+    }
+    std::lock_guard<std::mutex> lock(watch_mutex_);
+    if (watcher_.joinable())
+        return false;
+    watch_stop_ = false;
+    const auto interval = std::chrono::milliseconds(interval_ms > 0 ? interval_ms : 1);
+    watcher_ = std::thread([this, interval]()
+    {
+        std::unique_lock<std::mutex> lock(watch_mutex_);
+        while (!watch_cv_.wait_for(lock, interval, [this]() { return watch_stop_; }))
+        {
+            lock.unlock();
+            if (FileChanged())
+                Reload();
+            lock.lock();
+        }
+    });
+    return true;
+}
+
+void Utils_Config::StopWatch(void)
+{
+    std::thread t;
+    {
+        std::lock_guard<std::mutex> lock(watch_mutex_);
+        watch_stop_ = true;
+        t.swap(watcher_);
+    }
+    watch_cv_.notify_all();
+    if (t.joinable())
+        t.join();
+}
+
+void Utils_Config::SetReloadCallback(ReloadFn fn, void *ctx)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    reload_fn_ = fn;
+    reload_ctx_ = ctx;
+}
+
+void Utils_Config::ThrowMissing(std::string_view key)
+{
+    LError("config key {0} not exist or type mismatch", key);
+    throw Utils_Exception(Error_YML_FileNode_NoExist, key);
+}
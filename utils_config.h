@@ -0,0 +1,428 @@
+/**
+ * @file    Code\utils\utils_config.h.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   配置文件读取  代替 cv::FileStorage 逐个节点读取 YML
+ *          * 支持 YAML 的映射子集 (缩进嵌套, 注释, 引号, [a, b] 列表, - 列表) 和 INI ([section] key = value)
+ *          * 嵌套的键用 '.' 连接: Image: / Polar: / nImgWidth: 1280  ->  "Image.Polar.nImgWidth"
+ *          * 文件映射之后整体拷贝一次并解析成只读的表, 数值在加载时解析好, 读取时不再转换
+ *          * 热加载: 后台线程检测文件变化, 生成新表后原子替换, 读取方不加锁
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#pragma once
+#ifndef UTILS_CONFIG_H_
+#define UTILS_CONFIG_H_
+
+#include <stdint.h>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @struct  Utils_ConfigValue
+ *
+ * @brief   一个配置项的值  原始文本, 以及加载时解析出的整数 浮点数 布尔值
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+struct Utils_ConfigValue
+{
+    enum : uint8_t
+    {
+        kInt = 1,
+        kDouble = 2,
+        kBool = 4,
+    };
+
+    std::string_view text;  ///< 去掉引号和转义之后的文本
+    int64_t i = 0;
+    double d = 0;
+    bool b = false;
+    uint8_t flags = 0;
+
+    /**
+     * @fn  static Utils_ConfigValue Utils_ConfigValue::Parse(std::string_view text);
+     *
+     * @brief   解析标量  整数 (十进制 0x 十六进制), 浮点数, true false yes no on off
+     */
+    static Utils_ConfigValue Parse(std::string_view text);
+
+    /**
+     * @fn  template<typename T> bool Utils_ConfigValue::As(T &out) const
+     *
+     * @brief   按类型取值  整数只接受整数文本, 浮点数接受整数和浮点数文本
+     *          * std::vector<T> 接受 [1, 2, 3] 或 1, 2, 3, 任何一个元素失败则整体失败
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @tparam  T   bool, 整数, 浮点数, std::string, std::string_view, std::vector
+     * @param [in,out]  out 结果 失败时不修改
+     *
+     * @return  True if it succeeds, false 类型不符
+     */
+    template<typename T>
+    bool As(T &out) const
+    {
+        if constexpr (std::is_same_v<T, bool>)
+        {
+            if ((flags & kBool) == 0)
+                return false;
+            out = b;
+        }
+        else if constexpr (std::is_integral_v<T>)
+        {
+            if ((flags & kInt) == 0)
+                return false;
+            out = static_cast<T>(i);
+        }
+        else if constexpr (std::is_floating_point_v<T>)
+        {
+            if ((flags & kDouble) == 0)
+                return false;
+            out = static_cast<T>(d);
+        }
+        else if constexpr (std::is_same_v<T, std::string_view>)
+        {
+            out = text;
+        }
+        else if constexpr (std::is_same_v<T, std::string>)
+        {
+            out.assign(text.data(), text.size());
+        }
+        else
+        {
+            typename T::value_type item{};
+            T res;
+            for (std::string_view s : SplitList(text))
+            {
+                if (!Parse(s).As(item))
+                    return false;
+                res.push_back(item);
+            }
+            out = std::move(res);
+        }
+        return true;
+    }
+
+    /**
+     * @fn  static std::vector<std::string_view> Utils_ConfigValue::SplitList(std::string_view text);
+     *
+     * @brief   去掉外层 [], 按 ',' 切分并去掉每项首尾的空格和引号
+     */
+    static std::vector<std::string_view> SplitList(std::string_view text);
+};
+
+/**
+ * @class   Utils_ConfigTable utils_config.h Code\utils\utils_config.h
+ *
+ * @brief   一次加载的全部配置  生成之后只读, 键和值都指向表内部的文本
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+class Utils_ConfigTable
+{
+    public:
+
+    /**
+     * @fn  Utils_ConfigTable::Utils_ConfigTable(std::string text, uint32_t generation);
+     *
+     * @brief   解析文本  不能识别的行忽略, 重复的键后面的生效
+     *
+     * @param   text        文件内容
+     * @param   generation  版本号 每次加载加 1
+     */
+    Utils_ConfigTable(std::string text, uint32_t generation);
+
+    Utils_ConfigTable(const Utils_ConfigTable &) = delete;
+    Utils_ConfigTable &operator=(const Utils_ConfigTable &) = delete;
+
+    uint32_t Generation(void) const
+    {
+        return generation_;
+    }
+
+    size_t size(void) const
+    {
+        return keys_.size();
+    }
+
+    std::string_view Key(size_t idx) const
+    {
+        return keys_[idx];
+    }
+
+    const Utils_ConfigValue &Value(size_t idx) const
+    {
+        return values_[idx];
+    }
+
+    /**
+     * @fn  size_t Utils_ConfigTable::IndexOf(std::string_view key) const;
+     *
+     * @brief   二分查找键  找不到返回 npos
+     */
+    size_t IndexOf(std::string_view key) const;
+
+    const Utils_ConfigValue *Find(std::string_view key) const
+    {
+        size_t idx = IndexOf(key);
+        return idx == npos ? nullptr : &values_[idx];
+    }
+
+    template<typename T>
+    bool Get(std::string_view key, T &out) const
+    {
+        const Utils_ConfigValue *v = Find(key);
+        return v != nullptr && v->As(out);
+    }
+
+    template<typename T>
+    T GetOr(std::string_view key, T def) const
+    {
+        Get(key, def);
+        return def;
+    }
+
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    private:
+
+    void ParseText(void);
+    std::string_view Store(std::string s);
+
+    uint32_t generation_ = 0;
+    std::string text_;
+    std::deque<std::string> owned_;     ///< 拼接出来的键 和 转义之后的值
+    std::vector<std::string_view> keys_;
+    std::vector<Utils_ConfigValue> values_;
+};
+
+/**
+ * @class   Utils_Config utils_config.h Code\utils\utils_config.h
+ *
+ * @brief   配置  当前的表通过原子指针发布, 读取不加锁
+ *          * 旧的表保留到对象析构, 之前取得的引用一直有效 (配置很小, 重新加载的次数有限)
+ *          *   Utils_Config::Global().Load("config.yml");
+ *          *   int w = Utils_Config::Global().Get<int>("RunPara.Image.Polar.nImgWidth");
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+class Utils_Config
+{
+    public:
+
+    typedef void (*ReloadFn)(void *ctx, const Utils_ConfigTable &table);
+
+    Utils_Config();
+    ~Utils_Config();
+
+    Utils_Config(const Utils_Config &) = delete;
+    Utils_Config &operator=(const Utils_Config &) = delete;
+
+    static Utils_Config &Global(void);
+
+    /**
+     * @fn  void Utils_Config::Load(const std::string &file);
+     *
+     * @brief   加载配置文件  之后 Reload 和 Watch 使用同一个文件
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param   file    The file
+     *
+     * @exception   Utils_Exception 文件不存在 Error_YML_FileNotExist
+     */
+    void Load(const std::string &file);
+
+    /**
+     * @fn  void Utils_Config::LoadString(std::string_view text);
+     *
+     * @brief   从字符串加载 用于默认配置和测试
+     */
+    void LoadString(std::string_view text);
+
+    /**
+     * @fn  bool Utils_Config::Reload(void);
+     *
+     * @brief   重新读取 Load 的文件  失败时保留当前的表
+     *
+     * @return  True if it succeeds, false 文件不存在或者读取失败
+     */
+    bool Reload(void);
+
+    /**
+     * @fn  bool Utils_Config::Watch(int interval_ms = 1000);
+     *
+     * @brief   启动后台线程 每 interval_ms 检查一次文件修改时间和大小, 变化时 Reload
+     *
+     * @return  True if it succeeds, false 没有 Load 文件或已经启动
+     */
+    bool Watch(int interval_ms = 1000);
+
+    void StopWatch(void);
+
+    /**
+     * @fn  void Utils_Config::SetReloadCallback(ReloadFn fn, void *ctx);
+     *
+     * @brief   每次发布新表之后在加载的线程中回调
+     */
+    void SetReloadCallback(ReloadFn fn, void *ctx);
+
+    /**
+     * @fn  const Utils_ConfigTable &Utils_Config::Table(void) const
+     *
+     * @brief   当前的表  一直有效, 多次读取需要一致的值时先取得表再读
+     */
+    const Utils_ConfigTable &Table(void) const
+    {
+        return *current_.load(std::memory_order_acquire);
+    }
+
+    uint32_t Generation(void) const
+    {
+        return Table().Generation();
+    }
+
+    /**
+     * @fn  template<typename T> T Utils_Config::Get(std::string_view key) const
+     *
+     * @brief   按类型读取
+     *
+     * @exception   Utils_Exception 键不存在或类型不符 Error_YML_FileNode_NoExist
+     */
+    template<typename T>
+    T Get(std::string_view key) const
+    {
+        T res{};
+        if (!Table().Get(key, res))
+            ThrowMissing(key);
+        return res;
+    }
+
+    template<typename T>
+    bool Get(std::string_view key, T &out) const
+    {
+        return Table().Get(key, out);
+    }
+
+    template<typename T>
+    T GetOr(std::string_view key, T def) const
+    {
+        return Table().GetOr(key, def);
+    }
+
+    [[noreturn]] static void ThrowMissing(std::string_view key);
+
+    private:
+
+    void Publish(std::string text);
+    bool FileChanged(void);
+
+    std::atomic<const Utils_ConfigTable *> current_;
+    std::mutex mutex_;                                      ///< 保护下面的成员, 只有加载的一方使用
+    std::vector<std::unique_ptr<Utils_ConfigTable>> tables_;
+    uint32_t generation_ = 0;
+    std::string file_;
+    int64_t file_mtime_ = 0;
+    int64_t file_size_ = -1;
+    ReloadFn reload_fn_ = nullptr;
+    void *reload_ctx_ = nullptr;
+
+    std::thread watcher_;
+    std::mutex watch_mutex_;
+    std::condition_variable watch_cv_;
+    bool watch_stop_ = false;
+};
+
+/**
+ * @class   Utils_ConfigKey utils_config.h Code\utils\utils_config.h
+ *
+ * @brief   预先绑定的键  第一次读取时查找, 之后直到表被替换都直接按下标访问
+ *          * 缓存 (版本号, 下标) 放在一个 64 位原子变量中, 多个线程共用一个静态的键是安全的
+ *          *   static Utils_ConfigKey width("RunPara.Image.Polar.nImgWidth");
+ *          *   int w = width.Get<int>();
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+class Utils_ConfigKey
+{
+    public:
+
+    explicit Utils_ConfigKey(std::string_view key, const Utils_Config &config = Utils_Config::Global())
+        : key_(key), config_(&config), cache_(0)
+    {
+    }
+
+    const std::string &Name(void) const
+    {
+        return key_;
+    }
+
+    /**
+     * @fn  const Utils_ConfigValue *Utils_ConfigKey::Resolve(void) const
+     *
+     * @brief   当前表中的值  不存在返回 nullptr
+     */
+    const Utils_ConfigValue *Resolve(void) const
+    {
+        const Utils_ConfigTable &table = config_->Table();
+        uint64_t c = cache_.load(std::memory_order_relaxed);
+        size_t idx;
+        if (static_cast<uint32_t>(c >> 32) == table.Generation())
+        {
+            idx = static_cast<size_t>(static_cast<uint32_t>(c)) - 1;
+        }
+        else
+        {
+            idx = table.IndexOf(key_);
+            cache_.store((uint64_t(table.Generation()) << 32) | static_cast<uint32_t>(idx + 1),
+                         std::memory_order_relaxed);
+        }
+        return idx == Utils_ConfigTable::npos ? nullptr : &table.Value(idx);
+    }
+
+    template<typename T>
+    bool Get(T &out) const
+    {
+        const Utils_ConfigValue *v = Resolve();
+        return v != nullptr && v->As(out);
+    }
+
+    template<typename T>
+    T Get(void) const
+    {
+        T res{};
+        if (!Get(res))
+            Utils_Config::ThrowMissing(key_);
+        return res;
+    }
+
+    template<typename T>
+    T GetOr(T def) const
+    {
+        Get(def);
+        return def;
+    }
+
+    private:
+
+    std::string key_;
+    const Utils_Config *config_;
+    mutable std::atomic<uint64_t> cache_;   ///< 高 32 位 版本号, 低 32 位 下标 + 1 (0 表示不存在)
+};
+
+#endif  // UTILS_CONFIG_H_
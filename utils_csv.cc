@@ -0,0 +1,420 @@
+/**
+ * @file    Code\utils\utils_csv.cc.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   CSV 读写组件的实现
+ *          * 不含引号的行 (绝大多数测量数据) 走快速路径: memchr 找行尾, 再在行内 memchr 找分隔符
+ *          * 含引号的记录先按引号奇偶找到记录结尾 (可能跨行), 再逐字段处理 "" 转义
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#include "./utils_csv.h"
+#include "./utils_string.h"
+
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+/**
+ * @class   Utils_CsvParser
+ *
+ * @brief   解析一段数据  字段数组和转义缓冲区在记录之间复用
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+class Utils_CsvParser
+{
+    public:
+
+    explicit Utils_CsvParser(const Utils_Csv::Options &opt) : opt_(opt) {}
+
+    /**
+     * @fn  size_t Utils_CsvParser::Run(const char *p, const char *end, Utils_Csv::RowFn fn, void *ctx, int worker, const std::atomic<bool> *stop)
+     *
+     * @brief   解析 [p, end) 中的全部记录
+     *
+     * @return  回调的记录数
+     */
+    size_t Run(const char *p, const char *end, Utils_Csv::RowFn fn, void *ctx, int worker, std::atomic<bool> *stop)
+    {
+        size_t index = 0;
+        Utils_CsvRow row;
+        while (p < end)
+        {
+            const char *eol = static_cast<const char *>(memchr(p, '\n', static_cast<size_t>(end - p)));
+            if (eol == nullptr)
+                eol = end;
+            if (opt_.skip_empty_lines && (eol == p || (eol == p + 1 && *p == '\r')))
+            {
+                p = eol < end ? eol + 1 : end;
+                continue;
+            }
+
+            fields_.clear();
+            if (memchr(p, opt_.quote, static_cast<size_t>(eol - p)) == nullptr)
+            {
+                SplitPlain(p, eol);
+                p = eol < end ? eol + 1 : end;
+            }
+            else
+            {
+                p = SplitQuoted(p, end);
+            }
+
+            row.fields_ = fields_.data();
+            row.count_ = fields_.size();
+            row.index_ = index++;
+            if (!fn(ctx, row, worker))
+            {
+                if (stop != nullptr)
+                    stop->store(true, std::memory_order_relaxed);
+                break;
+            }
+            if (stop != nullptr && (index & 1023) == 0 && stop->load(std::memory_order_relaxed))
+                break;
+        }
+        return index;
+    }
+
+    /**
+     * @fn  static const char *Utils_CsvParser::FindRecordEnd(const char *p, const char *end, char quote, bool in_quote)
+     *
+     * @brief   从 p 开始 找到第一个不在引号内的换行  in_quote 为 p 处是否在引号内
+     *
+     * @return  换行的位置, 没有则返回 end
+     */
+    static const char *FindRecordEnd(const char *p, const char *end, char quote, bool in_quote)
+    {
+        for (;;)
+        {
+            if (!in_quote)
+            {
+                // 引号外 找换行和引号中 先出现的那个
+                const char *nl = static_cast<const char *>(memchr(p, '\n', static_cast<size_t>(end - p)));
+                const char *lim = nl != nullptr ? nl : end;
+                const char *q = static_cast<const char *>(memchr(p, quote, static_cast<size_t>(lim - p)));
+                if (q == nullptr)
+                    return lim;
+                p = q + 1;
+                in_quote = true;
+            }
+            else
+            {
+                const char *q = static_cast<const char *>(memchr(p, quote, static_cast<size_t>(end - p)));
+                if (q == nullptr)
+                    return end;
+                p = q + 1;
+                in_quote = false;
+            }
+        }
+    }
+
+    private:
+
+    void SplitPlain(const char *p, const char *eol)
+    {
+        const char *line_end = (eol > p && eol[-1] == '\r') ? eol - 1 : eol;
+        for (;;)
+        {
+            const char *s = static_cast<const char *>(memchr(p, opt_.sep, static_cast<size_t>(line_end - p)));
+            if (s == nullptr)
+            {
+                fields_.emplace_back(p, static_cast<size_t>(line_end - p));
+                return;
+            }
+            fields_.emplace_back(p, static_cast<size_t>(s - p));
+            p = s + 1;
+        }
+    }
+
+    // 含引号的记录  返回下一条记录的开头
+    const char *SplitQuoted(const char *p, const char *end)
+    {
+        const char q = opt_.quote;
+        const char *rec_end = FindRecordEnd(p, end, q, false);
+        const char *next = rec_end < end ? rec_end + 1 : end;
+        if (rec_end > p && rec_end[-1] == '\r')
+            rec_end--;
+
+        // 转义后的长度不超过原始长度, 预留后 string_view 不会因为扩容失效
+        scratch_.clear();
+        scratch_.reserve(static_cast<size_t>(rec_end - p));
+
+        const char *f = p;
+        for (;;)
+        {
+            if (f < rec_end && *f == q)
+            {
+                const char *begin = f + 1;
+                const char *s = begin;
+                size_t start = scratch_.size();
+                bool escaped = false;
+                const char *close = nullptr;
+                for (;;)
+                {
+                    const char *hit = static_cast<const char *>(memchr(s, q, static_cast<size_t>(rec_end - s)));
+                    if (hit == nullptr)
+                        break;
+                    if (hit + 1 < rec_end && hit[1] == q)
+                    {
+                        // "" 转义为一个引号
+                        escaped = true;
+                        scratch_.append(s, static_cast<size_t>(hit + 1 - s));
+                        s = hit + 2;
+                        continue;
+                    }
+                    close = hit;
+                    break;
+                }
+                const char *content_end = close != nullptr ? close : rec_end;
+                if (escaped)
+                {
+                    scratch_.append(s, static_cast<size_t>(content_end - s));
+                    fields_.emplace_back(scratch_.data() + start, scratch_.size() - start);
+                }
+                else
+                {
+                    fields_.emplace_back(begin, static_cast<size_t>(content_end - begin));
+                }
+                if (close == nullptr)
+                    return next;
+
+                // 结束引号到分隔符之间的内容忽略
+                const char *sp = static_cast<const char *>(memchr(close + 1, opt_.sep, static_cast<size_t>(rec_end - close - 1)));
+                if (sp == nullptr)
+                    return next;
+                f = sp + 1;
+            }
+            else
+            {
+                const char *sp = static_cast<const char *>(memchr(f, opt_.sep, static_cast<size_t>(rec_end - f)));
+                if (sp == nullptr)
+                {
+                    fields_.emplace_back(f, static_cast<size_t>(rec_end - f));
+                    return next;
+                }
+                fields_.emplace_back(f, static_cast<size_t>(sp - f));
+                f = sp + 1;
+            }
+        }
+    }
+
+    const Utils_Csv::Options &opt_;
+    std::vector<std::string_view> fields_;
+    std::string scratch_;
+};
+
+size_t Utils_Csv::Parse(std::string_view data, const Options & opt, RowFn fn, void * ctx)
+{
+    if (fn == nullptr)
+        return 0;
+    Utils_CsvParser parser(opt);
+    return parser.Run(data.data(), data.data() + data.size(), fn, ctx, 0, nullptr);
+}
+
+size_t Utils_Csv::RecordEnd(std::string_view data, const Options & opt)
+{
+    const char *end = data.data() + data.size();
+    const char *rec_end = Utils_CsvParser::FindRecordEnd(data.data(), end, opt.quote, false);
+    return static_cast<size_t>((rec_end < end ? rec_end + 1 : end) - data.data());
+}
+
+/**
+ * @fn  size_t Utils_Csv::ParseParallel(std::string_view data, const Options &opt, int threads, RowFn fn, void *ctx)
+ *
+ * @brief   三步:  1. 各线程统计自己那一块的引号个数  2. 前缀和得到每块起点是否在引号内,
+ *          把起点移到其后第一个引号外的换行之后  3. 各线程解析 [起点 i, 起点 i+1)
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ *
+ * @param           data    The data
+ * @param           opt     格式
+ * @param           threads 线程数
+ * @param           fn      行回调
+ * @param [in,out]  ctx     回调上下文
+ *
+ * @return  回调的记录数
+ */
+size_t Utils_Csv::ParseParallel(std::string_view data, const Options & opt, int threads, RowFn fn, void * ctx)
+{
+    if (fn == nullptr)
+        return 0;
+    if (threads <= 0)
+        threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    const size_t kMinChunk = 1 << 20;
+    threads = static_cast<int>(std::min<size_t>(static_cast<size_t>(threads), data.size() / kMinChunk + 1));
+    if (threads <= 1)
+        return Parse(data, opt, fn, ctx);
+
+    const char *base = data.data();
+    const char *end = base + data.size();
+    const size_t n = static_cast<size_t>(threads);
+    std::vector<size_t> bound(n + 1);
+    for (size_t i = 0; i <= n; i++)
+        bound[i] = data.size() / n * i;
+    bound[n] = data.size();
+
+    auto run = [&](auto &&job) {
+        std::vector<std::thread> workers;
+        for (size_t i = 1; i < n; i++)
+            workers.emplace_back(job, i);
+        job(0);
+        for (std::thread &w : workers)
+            w.join();
+    };
+
+    // 1. 引号个数
+    std::vector<size_t> quotes(n, 0);
+    run([&](size_t i) {
+        quotes[i] = static_cast<size_t>(std::count(base + bound[i], base + bound[i + 1], opt.quote));
+    });
+
+    // 2. 起点对齐到记录开头
+    std::vector<size_t> start(n + 1);
+    start[0] = 0;
+    start[n] = data.size();
+    std::vector<bool> in_quote(n, false);
+    size_t parity = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        in_quote[i] = (parity & 1) != 0;
+        parity += quotes[i];
+    }
+    run([&](size_t i) {
+        if (i == 0)
+            return;
+        const char *nl = Utils_CsvParser::FindRecordEnd(base + bound[i], end, opt.quote, in_quote[i]);
+        start[i] = static_cast<size_t>((nl < end ? nl + 1 : end) - base);
+    });
+    // 一条记录跨过多个块时 起点可能越过后面的块
+    for (size_t i = 1; i < n; i++)
+        start[i] = std::max(start[i], start[i - 1]);
+
+    // 3. 解析
+    std::vector<size_t> rows(n, 0);
+    std::atomic<bool> stop(false);
+    run([&](size_t i) {
+        Utils_CsvParser parser(opt);
+        rows[i] = parser.Run(base + start[i], base + start[i + 1], fn, ctx, static_cast<int>(i), &stop);
+    });
+
+    size_t total = 0;
+    for (size_t r : rows)
+        total += r;
+    return total;
+}
+
+bool Utils_CsvReader::Open(const std::string & file)
+{
+    if (!file_.Open(file))
+        return false;
+    file_.AdviseSequential();
+    SetData(file_.view());
+    return true;
+}
+
+void Utils_CsvReader::SetData(std::string_view data)
+{
+    header_.clear();
+    body_ = data;
+    // UTF-8 BOM
+    if (body_.size() >= 3 && memcmp(body_.data(), "\xEF\xBB\xBF", 3) == 0)
+        body_.remove_prefix(3);
+    if (!opt_.header)
+        return;
+
+    // 跳过开头的空行后 第一条记录为表头
+    size_t skip = 0;
+    while (skip < body_.size() && (body_[skip] == '\n' || body_[skip] == '\r'))
+        skip++;
+    body_.remove_prefix(skip);
+    size_t head = Utils_Csv::RecordEnd(body_, opt_);
+    Utils_Csv::Parse(body_.substr(0, head), opt_, [this](const Utils_CsvRow &row) {
+        for (size_t i = 0; i < row.size(); i++)
+            header_.emplace_back(row[i]);
+        return false;
+    });
+    body_.remove_prefix(head);
+}
+
+int Utils_CsvReader::Column(std::string_view name) const
+{
+    for (size_t i = 0; i < header_.size(); i++)
+    {
+        if (header_[i] == name)
+            return static_cast<int>(i);
+    }
+    return -1;
+}
+
+Utils_CsvWriter::Utils_CsvWriter(const Utils_Csv::Options & opt, size_t buffer_size)
+    : opt_(opt), limit_(std::max<size_t>(buffer_size, 4096))
+{
+    buf_.reserve(limit_ + 1024);
+}
+
+Utils_CsvWriter::~Utils_CsvWriter()
+{
+    Close();
+}
+
+bool Utils_CsvWriter::Open(const std::string & file, bool append)
+{
+    Close();
+    file_ = fopen(file.c_str(), append ? "ab" : "wb");
+    if (file_ == nullptr)
+        return false;
+    // 自己管理缓冲区  关闭 stdio 的缓冲 避免二次拷贝
+    setvbuf(file_, nullptr, _IONBF, 0);
+    ok_ = true;
+    first_ = true;
+    return true;
+}
+
+Utils_CsvWriter &Utils_CsvWriter::EndRow(void)
+{
+    buf_ += '\n';
+    first_ = true;
+    if (buf_.size() >= limit_)
+        Flush();
+    return *this;
+}
+
+bool Utils_CsvWriter::Flush(void)
+{
+    if (file_ != nullptr && !buf_.empty())
+    {
+        if (fwrite(buf_.data(), 1, buf_.size(), file_) != buf_.size())
+            ok_ = false;
+    }
+    buf_.clear();
+    return ok_;
+}
+
+bool Utils_CsvWriter::Close(void)
+{
+    if (file_ == nullptr)
+        return ok_;
+    Flush();
+    if (fclose(file_) != 0)
+        ok_ = false;
+    file_ = nullptr;
+    return ok_;
+}
+
+void Utils_CsvWriter::AppendField(std::string & dst, std::string_view field, const Utils_Csv::Options & opt)
+{
+    bool need = !field.empty() && (field.front() == ' ' || field.back() == ' ');
+    for (size_t i = 0; !need && i < field.size(); i++)
+    {
+        char c = field[i];
+        need = c == opt.sep || c == opt.quote || c == '\n' || c == '\r';
+    }
+    if (need)
+        Utils_String::AppendQuoteString(dst, field, opt.quote);
+    else
+        dst.append(field.data(), field.size());
+}
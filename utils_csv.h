@@ -0,0 +1,446 @@
+/**
+ * @file    Code\utils\utils_csv.h.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   CSV / TSV 读写组件  用于测量数据日志
+ *          * 读: 文件整体内存映射, 逐行回调, 字段为指向映射区的 string_view, 只有含 "" 转义的字段才拷贝
+ *          * 支持 RFC 4180 引号规则 (字段内的分隔符 换行 以及 "" 转义), 字段按类型解析使用 std::from_chars
+ *          * 多线程模式: 先统计每块的引号个数确定块起点是否在引号内, 再把块起点移到下一条记录开头, 各线程独立解析
+ *          * 写: 累积到大缓冲区后一次 fwrite, 需要时自动加引号
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#pragma once
+#ifndef UTILS_CSV_H_
+#define UTILS_CSV_H_
+
+#include <stdio.h>
+#include <charconv>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "./utils_mmap.h"
+#include "./utils_format.h"
+#include "./utils_detail.h"
+
+/**
+ * @class   Utils_CsvRow utils_csv.h Code\utils\utils_csv.h
+ *
+ * @brief   一条记录  字段在回调返回之前有效
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+class Utils_CsvRow
+{
+    public:
+
+    size_t size(void) const
+    {
+        return count_;
+    }
+
+    /**
+     * @fn  std::string_view Utils_CsvRow::operator[](size_t col) const
+     *
+     * @brief   第 col 个字段  越界返回空
+     */
+    std::string_view operator[](size_t col) const
+    {
+        return col < count_ ? fields_[col] : std::string_view();
+    }
+
+    /**
+     * @fn  size_t Utils_CsvRow::Index(void) const
+     *
+     * @brief   记录序号 (不含表头), 多线程模式下为块内序号
+     */
+    size_t Index(void) const
+    {
+        return index_;
+    }
+
+    /**
+     * @fn  template<typename T> bool Utils_CsvRow::Get(size_t col, T &out) const
+     *
+     * @brief   按类型解析字段  整数 浮点数使用 std::from_chars, 忽略首尾空格, 必须整个字段都能解析
+     *          * bool 接受 1 0 true false, 字符串类型直接赋值
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @tparam  T   Generic type parameter.
+     * @param           col 列号
+     * @param [in,out]  out 解析结果 失败时不修改
+     *
+     * @return  True if it succeeds, false if it fails
+     */
+    template<typename T>
+    bool Get(size_t col, T &out) const
+    {
+        if (col >= count_)
+            return false;
+        std::string_view s = fields_[col];
+        if constexpr (std::is_same_v<T, std::string_view> || std::is_same_v<T, std::string>)
+        {
+            out = T(s);
+            return true;
+        }
+        else
+        {
+            while (!s.empty() && (s.front() == ' ' || s.front() == '\t'))
+                s.remove_prefix(1);
+            while (!s.empty() && (s.back() == ' ' || s.back() == '\t'))
+                s.remove_suffix(1);
+            if constexpr (std::is_same_v<T, bool>)
+            {
+                if (s == "1" || s == "true")
+                    out = true;
+                else if (s == "0" || s == "false")
+                    out = false;
+                else
+                    return false;
+                return true;
+            }
+            else
+            {
+                static_assert(std::is_arithmetic_v<T>, "unsupported csv column type");
+                if (!s.empty() && s.front() == '+')
+                    s.remove_prefix(1);
+                T v{};
+                auto res = std::from_chars(s.data(), s.data() + s.size(), v);
+                if (s.empty() || res.ec != std::errc() || res.ptr != s.data() + s.size())
+                    return false;
+                out = v;
+                return true;
+            }
+        }
+    }
+
+    /**
+     * @fn  template<typename T> T Utils_CsvRow::GetOr(size_t col, T def) const
+     *
+     * @brief   按类型解析字段  失败返回默认值
+     */
+    template<typename T>
+    T GetOr(size_t col, T def) const
+    {
+        Get(col, def);
+        return def;
+    }
+
+    private:
+
+    friend class Utils_CsvParser;     // utils_csv.cc
+
+    const std::string_view *fields_ = nullptr;
+    size_t count_ = 0;
+    size_t index_ = 0;
+};
+
+/**
+ * @class   Utils_Csv utils_csv.h Code\utils\utils_csv.h
+ *
+ * @brief   CSV 解析函数  输入为内存中的数据 (通常是映射的文件)
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+class Utils_Csv
+{
+    public:
+
+    /**
+     * @struct  Options
+     *
+     * @brief   格式  TSV 设置 sep = '\t'
+     */
+    struct Options
+    {
+        char sep = ',';
+        char quote = '"';
+        bool header = false;            ///< 第一条记录为表头
+        bool skip_empty_lines = true;   ///< 跳过空行
+    };
+
+    /**
+     * @brief   行回调  返回 false 停止解析; worker 为线程序号 单线程时为 0
+     */
+    typedef bool (*RowFn)(void *ctx, const Utils_CsvRow &row, int worker);
+
+    /**
+     * @fn  static size_t Utils_Csv::Parse(std::string_view data, const Options &opt, RowFn fn, void *ctx);
+     *
+     * @brief   单线程解析  opt.header 在这里不起作用, 表头由 Utils_CsvReader 处理
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param           data    The data
+     * @param           opt     格式
+     * @param           fn      行回调
+     * @param [in,out]  ctx     回调上下文
+     *
+     * @return  回调的记录数
+     */
+    static size_t Parse(std::string_view data, const Options &opt, RowFn fn, void *ctx);
+
+    /**
+     * @fn  static size_t Utils_Csv::ParseParallel(std::string_view data, const Options &opt, int threads, RowFn fn, void *ctx);
+     *
+     * @brief   多线程解析  数据按字节均分, 每个线程解析一段连续的记录, 第 i 个线程的记录都在第 i+1 个之前
+     *          * 回调会被多个线程同时调用, 用 worker 区分; 数据小于 1MB 时退化为单线程
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param           data    The data
+     * @param           opt     格式
+     * @param           threads 线程数 小于等于 0 时使用 CPU 核数
+     * @param           fn      行回调
+     * @param [in,out]  ctx     回调上下文
+     *
+     * @return  回调的记录数
+     */
+    static size_t ParseParallel(std::string_view data, const Options &opt, int threads, RowFn fn, void *ctx);
+
+    /**
+     * @fn  static size_t Utils_Csv::RecordEnd(std::string_view data, const Options &opt);
+     *
+     * @brief   第一条记录的结尾 (含换行) 的偏移  引号内的换行不算
+     *
+     * @param   data    The data
+     * @param   opt     格式
+     *
+     * @return  偏移
+     */
+    static size_t RecordEnd(std::string_view data, const Options &opt);
+
+    /**
+     * @fn  template<typename Fn> static size_t Utils_Csv::Parse(std::string_view data, const Options &opt, Fn &&fn)
+     *
+     * @brief   单线程解析  fn(const Utils_CsvRow &) 返回 void 或 bool (false 停止)
+     */
+    template<typename Fn>
+    static size_t Parse(std::string_view data, const Options &opt, Fn &&fn)
+    {
+        return Parse(data, opt, &Utils_Detail::Invoke<std::remove_reference_t<Fn>, const Utils_CsvRow &>, const_cast<void *>(static_cast<const void *>(&fn)));
+    }
+
+    /**
+     * @fn  template<typename Fn> static size_t Utils_Csv::ParseParallel(std::string_view data, const Options &opt, int threads, Fn &&fn)
+     *
+     * @brief   多线程解析  fn(const Utils_CsvRow &, int worker) 返回 void 或 bool, 需要线程安全
+     */
+    template<typename Fn>
+    static size_t ParseParallel(std::string_view data, const Options &opt, int threads, Fn &&fn)
+    {
+        return ParseParallel(data, opt, threads, &Utils_Detail::Invoke<std::remove_reference_t<Fn>, const Utils_CsvRow &>,
+                             const_cast<void *>(static_cast<const void *>(&fn)));
+    }
+};
+
+/**
+ * @class   Utils_CsvReader utils_csv.h Code\utils\utils_csv.h
+ *
+ * @brief   CSV 文件读取  内存映射文件, 可选表头
+ *          *   Utils_CsvReader reader(opt);  reader.Open("data.csv");
+ *          *   int t = reader.Column("temp");
+ *          *   reader.ForEach([&](const Utils_CsvRow &row){ double v = row.GetOr(t, 0.0); });
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+class Utils_CsvReader
+{
+    public:
+
+    explicit Utils_CsvReader(const Utils_Csv::Options &opt = Utils_Csv::Options()) : opt_(opt) {}
+
+    /**
+     * @fn  bool Utils_CsvReader::Open(const std::string &file);
+     *
+     * @brief   映射文件 读取表头
+     *
+     * @param   file    The file
+     *
+     * @return  True if it succeeds, false if it fails
+     */
+    bool Open(const std::string &file);
+
+    /**
+     * @fn  void Utils_CsvReader::SetData(std::string_view data);
+     *
+     * @brief   解析内存中的数据 (不拷贝, 调用者保证数据有效), 读取表头
+     *
+     * @param   data    The data
+     */
+    void SetData(std::string_view data);
+
+    const std::vector<std::string> &Header(void) const
+    {
+        return header_;
+    }
+
+    /**
+     * @fn  int Utils_CsvReader::Column(std::string_view name) const;
+     *
+     * @brief   表头名称对应的列号  找不到返回 -1
+     *
+     * @param   name    The name
+     *
+     * @return  列号
+     */
+    int Column(std::string_view name) const;
+
+    template<typename Fn>
+    size_t ForEach(Fn &&fn) const
+    {
+        return Utils_Csv::Parse(body_, opt_, std::forward<Fn>(fn));
+    }
+
+    template<typename Fn>
+    size_t ForEachParallel(Fn &&fn, int threads = 0) const
+    {
+        return Utils_Csv::ParseParallel(body_, opt_, threads, std::forward<Fn>(fn));
+    }
+
+    private:
+
+    Utils_Csv::Options opt_;
+    Utils_MappedFile file_;
+    std::string_view body_;
+    std::vector<std::string> header_;
+};
+
+/**
+ * @class   Utils_CsvWriter utils_csv.h Code\utils\utils_csv.h
+ *
+ * @brief   CSV 写入  先写入内存缓冲区, 超过 buffer_size 时一次写出, 不再每行 flush
+ *          *   writer.Row("time", "temp");  writer.Row(t, 23.5);
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+class Utils_CsvWriter
+{
+    public:
+
+    explicit Utils_CsvWriter(const Utils_Csv::Options &opt = Utils_Csv::Options(), size_t buffer_size = 1 << 20);
+    ~Utils_CsvWriter();
+
+    Utils_CsvWriter(const Utils_CsvWriter &) = delete;
+    Utils_CsvWriter &operator=(const Utils_CsvWriter &) = delete;
+
+    /**
+     * @fn  bool Utils_CsvWriter::Open(const std::string &file, bool append = false);
+     *
+     * @brief   打开文件  append 为 true 时追加
+     *
+     * @param   file    The file
+     * @param   append  (Optional) 追加写入
+     *
+     * @return  True if it succeeds, false if it fails
+     */
+    bool Open(const std::string &file, bool append = false);
+
+    /**
+     * @fn  template<typename T> Utils_CsvWriter &Utils_CsvWriter::Field(const T &val)
+     *
+     * @brief   写入一个字段  数字通过 Utils_Format 格式化, 字符串需要时加引号
+     *
+     * @tparam  T   Generic type parameter.
+     * @param   val The value
+     *
+     * @return  自身
+     */
+    template<typename T>
+    Utils_CsvWriter &Field(const T &val)
+    {
+        if (!first_)
+            buf_ += opt_.sep;
+        first_ = false;
+        if constexpr (std::is_same_v<T, bool>)
+            buf_ += val ? '1' : '0';
+        else if constexpr (std::is_same_v<T, char>)
+            AppendField(buf_, std::string_view(&val, 1), opt_);
+        else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>)
+            Utils_Format::AppendInt(buf_, static_cast<long long>(val));
+        else if constexpr (std::is_integral_v<T>)
+            Utils_Format::AppendUInt(buf_, static_cast<unsigned long long>(val));
+        else if constexpr (std::is_floating_point_v<T>)
+            Utils_Format::AppendFloat(buf_, static_cast<double>(val));
+        else
+            AppendField(buf_, std::string_view(val), opt_);
+        return *this;
+    }
+
+    /**
+     * @fn  Utils_CsvWriter &Utils_CsvWriter::EndRow(void);
+     *
+     * @brief   结束一行  缓冲区超过阈值时写出
+     *
+     * @return  自身
+     */
+    Utils_CsvWriter &EndRow(void);
+
+    /**
+     * @fn  template<typename... Args> Utils_CsvWriter &Utils_CsvWriter::Row(const Args &... args)
+     *
+     * @brief   写入一整行
+     */
+    template<typename... Args>
+    Utils_CsvWriter &Row(const Args &... args)
+    {
+        (Field(args), ...);
+        return EndRow();
+    }
+
+    /**
+     * @fn  bool Utils_CsvWriter::Flush(void);
+     *
+     * @brief   缓冲区写到文件
+     *
+     * @return  目前为止的写入都成功返回 true
+     */
+    bool Flush(void);
+
+    /**
+     * @fn  bool Utils_CsvWriter::Close(void);
+     *
+     * @brief   写出剩余数据并关闭文件
+     *
+     * @return  True if it succeeds, false if it fails
+     */
+    bool Close(void);
+
+    bool IsOpen(void) const
+    {
+        return file_ != nullptr;
+    }
+
+    /**
+     * @fn  static void Utils_CsvWriter::AppendField(std::string &dst, std::string_view field, const Utils_Csv::Options &opt);
+     *
+     * @brief   按 RFC 4180 追加字段  含分隔符 引号 换行 或首尾空格时加引号, 引号写成 ""
+     *
+     * @param [in,out]  dst     Destination
+     * @param           field   The field
+     * @param           opt     格式
+     */
+    static void AppendField(std::string &dst, std::string_view field, const Utils_Csv::Options &opt);
+
+    private:
+
+    Utils_Csv::Options opt_;
+    size_t limit_;
+    FILE *file_ = nullptr;
+    std::string buf_;
+    bool first_ = true;
+    bool ok_ = true;
+};
+
+#endif  // UTILS_CSV_H_
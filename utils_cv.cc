@@ -426,9 +426,13 @@ void Utils_CV::CreatMapMat(cv::Mat & map_x,
 
     // 需要判断是否 超过范围 避免 溢出值
     // 求算出来 中心点到四个边缘 的最小值, 
-    int maxR_h = std::min(std::min(cen_x, cen_y),
-                        std::min(gConfig->mRunPara.Image.Polar.nImgWidth - cen_x,
-                                gConfig->mRunPara.Image.Polar.nImgHeight - cen_y));
+    // 没有加载配置 (或没有这两项) 时 只按中心点到左上边缘限制, 不抛出异常
+    static const Utils_ConfigKey kImgWidth("RunPara.Image.Polar.nImgWidth");
+    static const Utils_ConfigKey kImgHeight("RunPara.Image.Polar.nImgHeight");
+    int maxR_h = std::min(cen_x, cen_y);
+    int img_width = 0, img_height = 0;
+    if (kImgWidth.Get(img_width) && kImgHeight.Get(img_height))
+        maxR_h = std::min(maxR_h, std::min(img_width - cen_x, img_height - cen_y));
     // 计算出来 设定值与给出值的最小值
     max_r = std::min(max_r, maxR_h);
 
@@ -179,6 +179,8 @@ class Utils_CV
      * @fn  void Utils_CV::CreatMapMat(cv::Mat & map_x, cv::Mat & map_y, int cen_x, int cen_y, int min_r, int max_r, int Width = -1, int Height = -1);
      *
      * @brief   创建 映射map 图像
+     *          * 配置中有 RunPara.Image.Polar.nImgWidth / nImgHeight 时 max_r 不超过图像边缘,
+     *            配置未加载时不读取 只按中心点限制
      *
      * @author  IRIS_Chen
      * @date    2019/7/20
@@ -20,7 +20,7 @@ class Utils_Data
     /**
      * @fn  template<typename T1, typename T2> static void Utils_Data::LeastSquare(const std::vector<T1> &data_x, const std::vector<T2>& data_y, float &var_a, float &var_b)
      *
-     * @brief   閫氳繃xy  寰楀埌 鏁版嵁鐨?鏈€灏忎簩涔樺弬鏁?
+     * @brief   通过xy  得到 数据的 最小二乘参数
      *
      * @author  IRIS_Chen
      * @date    2019/12/3
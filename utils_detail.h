@@ -0,0 +1,96 @@
+/**
+ * @file    Code\utils\utils_detail.h.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   各模块内部共用的小函数  位扫描 ASCII 大小写 回调转发, 不在 utils.h 中包含
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#pragma once
+#ifndef UTILS_DETAIL_H_
+#define UTILS_DETAIL_H_
+
+#include <stdint.h>
+#include <type_traits>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+/**
+ * @class   Utils_Detail utils_detail.h Code\utils\utils_detail.h
+ *
+ * @brief   内部实现使用
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+class Utils_Detail
+{
+    public:
+
+    /**
+     * @fn  static inline int Utils_Detail::LowestBit(uint32_t mask)
+     *
+     * @brief   最低的 1 位的位置  mask 不能为 0
+     */
+    static inline int LowestBit(uint32_t mask)
+    {
+#ifdef _MSC_VER
+        unsigned long idx;
+        _BitScanForward(&idx, mask);
+        return static_cast<int>(idx);
+#else
+        return __builtin_ctz(mask);
+#endif
+    }
+
+    /**
+     * @fn  static constexpr uint8_t Utils_Detail::FoldCase(uint8_t c)
+     *
+     * @brief   ASCII 大写转小写, 其他字节不变  与 Utils_String::StringEqualNoCase 的规则相同
+     */
+    static constexpr uint8_t FoldCase(uint8_t c)
+    {
+        return (c >= 'A' && c <= 'Z') ? static_cast<uint8_t>(c | 0x20) : c;
+    }
+
+    /**
+     * @fn  template<typename Fn, typename Arg> static bool Utils_Detail::Invoke(void *ctx, Arg arg, int worker)
+     *
+     * @brief   函数指针 + ctx 形式的回调转发到 lambda
+     *          * ctx 指向 Fn, 调用 fn(arg, worker) 或 fn(arg), 返回 void 时视为 true
+     *          * Walk(root, opt, &Utils_Detail::Invoke<Fn, const Utils_WalkEntry &>, &fn)
+     */
+    template<typename Fn, typename Arg>
+    static bool Invoke(void *ctx, Arg arg, int worker)
+    {
+        Fn &fn = *static_cast<Fn *>(ctx);
+        if constexpr (std::is_invocable_v<Fn &, Arg, int>)
+        {
+            if constexpr (std::is_same_v<std::invoke_result_t<Fn &, Arg, int>, void>)
+            {
+                fn(arg, worker);
+                return true;
+            }
+            else
+            {
+                return static_cast<bool>(fn(arg, worker));
+            }
+        }
+        else
+        {
+            if constexpr (std::is_same_v<std::invoke_result_t<Fn &, Arg>, void>)
+            {
+                fn(arg);
+                return true;
+            }
+            else
+            {
+                return static_cast<bool>(fn(arg));
+            }
+        }
+    }
+};
+
+#endif  // UTILS_DETAIL_H_
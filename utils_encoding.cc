@@ -0,0 +1,484 @@
+/**
+ * @file    Code\utils\utils_encoding.cc.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   字符编码组件的实现
+ *          * ASCII 部分 SSE2 批量处理, 非 ASCII 部分逐字符处理, 遇到 ASCII 后重新进入批量处理
+ *          * GBK 没有内置码表, 连续的非 ASCII 片段交给系统编码转换 (Windows CP936 / iconv)
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#include "./utils_encoding.h"
+#include "./utils_detail.h"
+
+#include <string.h>
+#include <stdint.h>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <errno.h>
+#include <iconv.h>
+#endif
+
+// x64 上 SSE2 必然存在, 其他平台回退到逐字节处理
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define UTILS_ENCODING_SSE2 1
+#endif
+
+typedef unsigned char u8;
+
+/**
+ * @fn  static inline int DecodeUtf8(const u8 *p, const u8 *end, uint32_t &cp)
+ *
+ * @brief   解码一个 UTF-8 字符  按照 Unicode 表 3-7 检查第二个字节的范围
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ *
+ * @param           p   字符起始
+ * @param           end 数据结尾
+ * @param [in,out]  cp  码点
+ *
+ * @return  字符的字节数, 非法返回 0
+ */
+static inline int DecodeUtf8(const u8 *p, const u8 *end, uint32_t &cp)
+{
+    unsigned c = p[0];
+    size_t left = static_cast<size_t>(end - p);
+    if (c < 0x80)
+    {
+        cp = c;
+        return 1;
+    }
+    if (c < 0xC2)
+        return 0;
+    if (c < 0xE0)
+    {
+        if (left < 2 || (p[1] & 0xC0) != 0x80)
+            return 0;
+        cp = ((c & 0x1F) << 6) | (p[1] & 0x3F);
+        return 2;
+    }
+    if (c < 0xF0)
+    {
+        unsigned lo = c == 0xE0 ? 0xA0 : 0x80;     // 过长编码
+        unsigned hi = c == 0xED ? 0x9F : 0xBF;     // 代理区
+        if (left < 3 || p[1] < lo || p[1] > hi || (p[2] & 0xC0) != 0x80)
+            return 0;
+        cp = ((c & 0x0F) << 12) | ((p[1] & 0x3F) << 6) | (p[2] & 0x3F);
+        return 3;
+    }
+    if (c < 0xF5)
+    {
+        unsigned lo = c == 0xF0 ? 0x90 : 0x80;     // 过长编码
+        unsigned hi = c == 0xF4 ? 0x8F : 0xBF;     // 超过 U+10FFFF
+        if (left < 4 || p[1] < lo || p[1] > hi || (p[2] & 0xC0) != 0x80 || (p[3] & 0xC0) != 0x80)
+            return 0;
+        cp = ((c & 0x07) << 18) | ((p[1] & 0x3F) << 12) | ((p[2] & 0x3F) << 6) | (p[3] & 0x3F);
+        return 4;
+    }
+    return 0;
+}
+
+static inline char *EncodeUtf8(char *out, uint32_t cp)
+{
+    if (cp < 0x80)
+    {
+        *out++ = static_cast<char>(cp);
+    }
+    else if (cp < 0x800)
+    {
+        *out++ = static_cast<char>(0xC0 | (cp >> 6));
+        *out++ = static_cast<char>(0x80 | (cp & 0x3F));
+    }
+    else if (cp < 0x10000)
+    {
+        *out++ = static_cast<char>(0xE0 | (cp >> 12));
+        *out++ = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        *out++ = static_cast<char>(0x80 | (cp & 0x3F));
+    }
+    else
+    {
+        *out++ = static_cast<char>(0xF0 | (cp >> 18));
+        *out++ = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+        *out++ = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        *out++ = static_cast<char>(0x80 | (cp & 0x3F));
+    }
+    return out;
+}
+
+size_t Utils_Encoding::AsciiPrefix(const char * data, size_t len)
+{
+    size_t i = 0;
+#ifdef UTILS_ENCODING_SSE2
+    for (; i + 16 <= len; i += 16)
+    {
+        int mask = _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i)));
+        if (mask != 0)
+            return i + static_cast<size_t>(Utils_Detail::LowestBit(static_cast<unsigned>(mask)));
+    }
+#endif
+    while (i < len && static_cast<u8>(data[i]) < 0x80)
+        i++;
+    return i;
+}
+
+bool Utils_Encoding::IsAscii(std::string_view str)
+{
+    return AsciiPrefix(str.data(), str.size()) == str.size();
+}
+
+size_t Utils_Encoding::Utf8ValidPrefix(std::string_view str)
+{
+    const u8 *begin = reinterpret_cast<const u8 *>(str.data());
+    const u8 *end = begin + str.size();
+    const u8 *p = begin;
+    while (p < end)
+    {
+        p += AsciiPrefix(reinterpret_cast<const char *>(p), static_cast<size_t>(end - p));
+
+        // 非 ASCII 片段 (中文等) 逐字符检查 直到下一个 ASCII
+        while (p < end && *p >= 0x80)
+        {
+            uint32_t cp;
+            int k = DecodeUtf8(p, end, cp);
+            if (k == 0)
+                return static_cast<size_t>(p - begin);
+            p += k;
+        }
+    }
+    return str.size();
+}
+
+bool Utils_Encoding::IsUtf8(std::string_view str)
+{
+    return Utf8ValidPrefix(str) == str.size();
+}
+
+/**
+ * @fn  static bool AppendUtf16(std::u16string &dst, const u8 *p, size_t len)
+ *
+ * @brief   UTF-8 转 UTF-16 追加到 dst  输出单元数不超过输入字节数
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ *
+ * @param [in,out]  dst Destination
+ * @param           p   UTF-8 数据
+ * @param           len The length
+ *
+ * @return  输入全部合法返回 true
+ */
+static bool AppendUtf16(std::u16string &dst, const u8 *p, size_t len)
+{
+    size_t old = dst.size();
+    dst.resize(old + len);
+    char16_t *out = &dst[0] + old;
+    const u8 *end = p + len;
+    bool ok = true;
+    while (p < end)
+    {
+#ifdef UTILS_ENCODING_SSE2
+        // 16 个 ASCII 字节 零扩展为 16 个 UTF-16 单元
+        const __m128i zero = _mm_setzero_si128();
+        while (end - p >= 16)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+            if (_mm_movemask_epi8(v) != 0)
+                break;
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out), _mm_unpacklo_epi8(v, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 8), _mm_unpackhi_epi8(v, zero));
+            p += 16;
+            out += 16;
+        }
+        if (p == end)
+            break;
+#endif
+        do
+        {
+            uint32_t cp;
+            int k = DecodeUtf8(p, end, cp);
+            if (k == 0)
+            {
+                cp = 0xFFFD;
+                k = 1;
+                ok = false;
+            }
+            p += k;
+            if (cp >= 0x10000)
+            {
+                cp -= 0x10000;
+                *out++ = static_cast<char16_t>(0xD800 + (cp >> 10));
+                *out++ = static_cast<char16_t>(0xDC00 + (cp & 0x3FF));
+            }
+            else
+            {
+                *out++ = static_cast<char16_t>(cp);
+            }
+        } while (p < end && *p >= 0x80);
+    }
+    dst.resize(static_cast<size_t>(out - dst.data()));
+    return ok;
+}
+
+/**
+ * @fn  static bool AppendUtf8(std::string &dst, const char16_t *p, size_t len)
+ *
+ * @brief   UTF-16 转 UTF-8 追加到 dst  输出字节数不超过 3 倍输入单元数
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ *
+ * @param [in,out]  dst Destination
+ * @param           p   UTF-16 数据
+ * @param           len 单元数
+ *
+ * @return  输入全部合法返回 true
+ */
+static bool AppendUtf8(std::string &dst, const char16_t *p, size_t len)
+{
+    size_t old = dst.size();
+    dst.resize(old + len * 3);
+    char *out = &dst[0] + old;
+    const char16_t *end = p + len;
+    bool ok = true;
+    while (p < end)
+    {
+#ifdef UTILS_ENCODING_SSE2
+        // 16 个单元都小于 0x80 时 压缩成 16 字节
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i high = _mm_set1_epi16(static_cast<short>(0xFF80));
+        while (end - p >= 16)
+        {
+            __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+            __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 8));
+            __m128i t = _mm_and_si128(_mm_or_si128(a, b), high);
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(t, zero)) != 0xFFFF)
+                break;
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out), _mm_packus_epi16(a, b));
+            p += 16;
+            out += 16;
+        }
+        if (p == end)
+            break;
+#endif
+        do
+        {
+            uint32_t c = *p++;
+            if (c >= 0xD800 && c <= 0xDFFF)
+            {
+                if (c <= 0xDBFF && p < end && *p >= 0xDC00 && *p <= 0xDFFF)
+                {
+                    c = 0x10000 + ((c - 0xD800) << 10) + (*p++ - 0xDC00);
+                }
+                else
+                {
+                    c = 0xFFFD;
+                    ok = false;
+                }
+            }
+            out = EncodeUtf8(out, c);
+        } while (p < end && *p >= 0x80);
+    }
+    dst.resize(static_cast<size_t>(out - dst.data()));
+    return ok;
+}
+
+bool Utils_Encoding::Utf8ToUtf16(std::string_view src, std::u16string & dst)
+{
+    dst.clear();
+    return AppendUtf16(dst, reinterpret_cast<const u8 *>(src.data()), src.size());
+}
+
+bool Utils_Encoding::Utf16ToUtf8(std::u16string_view src, std::string & dst)
+{
+    dst.clear();
+    return AppendUtf8(dst, src.data(), src.size());
+}
+
+#ifdef _WIN32
+
+static const UINT kCodePageGbk = 936;
+
+// GBK 片段 -> UTF-16 -> UTF-8
+static bool GbkRunToUtf8(const char *p, size_t len, std::string &dst)
+{
+    thread_local std::u16string wbuf;
+    int n = static_cast<int>(len);
+    DWORD flags = MB_ERR_INVALID_CHARS;
+    int wn = MultiByteToWideChar(kCodePageGbk, flags, p, n, nullptr, 0);
+    bool ok = wn > 0;
+    if (!ok)
+    {
+        flags = 0;
+        wn = MultiByteToWideChar(kCodePageGbk, flags, p, n, nullptr, 0);
+    }
+    wbuf.resize(static_cast<size_t>(wn));
+    MultiByteToWideChar(kCodePageGbk, flags, p, n, reinterpret_cast<wchar_t *>(&wbuf[0]), wn);
+    return AppendUtf8(dst, wbuf.data(), wbuf.size()) && ok;
+}
+
+// UTF-8 片段 -> UTF-16 -> GBK
+static bool Utf8RunToGbk(const char *p, size_t len, std::string &dst)
+{
+    thread_local std::u16string wbuf;
+    wbuf.clear();
+    bool ok = AppendUtf16(wbuf, reinterpret_cast<const u8 *>(p), len);
+    const wchar_t *w = reinterpret_cast<const wchar_t *>(wbuf.data());
+    int wn = static_cast<int>(wbuf.size());
+    BOOL used_default = FALSE;
+    int n = WideCharToMultiByte(kCodePageGbk, 0, w, wn, nullptr, 0, "?", &used_default);
+    size_t old = dst.size();
+    dst.resize(old + static_cast<size_t>(n));
+    WideCharToMultiByte(kCodePageGbk, 0, w, wn, &dst[old], n, "?", &used_default);
+    return ok && !used_default;
+}
+
+#else
+
+/**
+ * @class   IconvHandle
+ *
+ * @brief   每个线程缓存一个 iconv 句柄 避免每次 iconv_open
+ */
+struct IconvHandle
+{
+    iconv_t cd;
+    IconvHandle(const char *to, const char *from) : cd(iconv_open(to, from)) {}
+    ~IconvHandle()
+    {
+        if (cd != reinterpret_cast<iconv_t>(-1))
+            iconv_close(cd);
+    }
+};
+
+/**
+ * @fn  static bool IconvRun(iconv_t cd, const char *p, size_t len, std::string &dst, std::string_view bad, bool from_utf8)
+ *
+ * @brief   iconv 转换一个片段  非法或无法表示的字符输出 bad 后跳过
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ *
+ * @param           cd          iconv 句柄
+ * @param           p           输入
+ * @param           len         The length
+ * @param [in,out]  dst         Destination
+ * @param           bad         替换字符
+ * @param           from_utf8   输入是否为 UTF-8 (决定出错时跳过的长度)
+ *
+ * @return  全部转换成功返回 true
+ */
+static bool IconvRun(iconv_t cd, const char *p, size_t len, std::string &dst, std::string_view bad, bool from_utf8)
+{
+    if (cd == reinterpret_cast<iconv_t>(-1))
+        return false;
+    bool ok = true;
+    size_t old = dst.size();
+    size_t room = len * 3 + 4;
+    dst.resize(old + room);
+    char *in = const_cast<char *>(p);
+    size_t in_left = len;
+    char *out = &dst[old];
+    size_t out_left = room;
+    iconv(cd, nullptr, nullptr, nullptr, nullptr);
+    while (in_left > 0)
+    {
+        if (iconv(cd, &in, &in_left, &out, &out_left) != static_cast<size_t>(-1))
+            break;
+        if (errno == E2BIG || out_left < bad.size())
+        {
+            size_t used = static_cast<size_t>(out - dst.data());
+            dst.resize(dst.size() + room);
+            out = &dst[0] + used;
+            out_left = dst.size() - used;
+            continue;
+        }
+        // EILSEQ / EINVAL  输出替换字符 跳过一个字符
+        ok = false;
+        size_t skip = 1;
+        if (from_utf8)
+        {
+            uint32_t cp;
+            int k = DecodeUtf8(reinterpret_cast<const u8 *>(in), reinterpret_cast<const u8 *>(in + in_left), cp);
+            skip = k > 0 ? static_cast<size_t>(k) : 1;
+        }
+        in += skip;
+        in_left -= skip;
+        memcpy(out, bad.data(), bad.size());
+        out += bad.size();
+        out_left -= bad.size();
+    }
+    dst.resize(static_cast<size_t>(out - dst.data()));
+    return ok;
+}
+
+static bool GbkRunToUtf8(const char *p, size_t len, std::string &dst)
+{
+    thread_local IconvHandle handle("UTF-8", "GBK");
+    return IconvRun(handle.cd, p, len, dst, "\xEF\xBF\xBD", false);
+}
+
+static bool Utf8RunToGbk(const char *p, size_t len, std::string &dst)
+{
+    thread_local IconvHandle handle("GBK", "UTF-8");
+    return IconvRun(handle.cd, p, len, dst, "?", true);
+}
+
+#endif
+
+bool Utils_Encoding::GbkToUtf8(std::string_view src, std::string & dst)
+{
+    dst.clear();
+    dst.reserve(src.size() + src.size() / 2);
+    const char *p = src.data();
+    const char *end = p + src.size();
+    bool ok = true;
+    while (p < end)
+    {
+        size_t n = AsciiPrefix(p, static_cast<size_t>(end - p));
+        dst.append(p, n);
+        p += n;
+        if (p == end)
+            break;
+
+        // 连续的双字节字符  第二个字节可能落在 ASCII 范围 (0x40-0x7E), 按字符跳过
+        const char *run = p;
+        while (p < end && static_cast<u8>(*p) >= 0x80)
+        {
+            u8 c = static_cast<u8>(*p);
+            p += (c >= 0x81 && c <= 0xFE && end - p >= 2) ? 2 : 1;
+        }
+        ok = GbkRunToUtf8(run, static_cast<size_t>(p - run), dst) && ok;
+    }
+    return ok;
+}
+
+bool Utils_Encoding::Utf8ToGbk(std::string_view src, std::string & dst)
+{
+    dst.clear();
+    dst.reserve(src.size());
+    const char *p = src.data();
+    const char *end = p + src.size();
+    bool ok = true;
+    while (p < end)
+    {
+        size_t n = AsciiPrefix(p, static_cast<size_t>(end - p));
+        dst.append(p, n);
+        p += n;
+        if (p == end)
+            break;
+
+        // UTF-8 多字节字符里不会出现 ASCII 字节
+        const char *run = p;
+        while (p < end && static_cast<u8>(*p) >= 0x80)
+            p++;
+        ok = Utf8RunToGbk(run, static_cast<size_t>(p - run), dst) && ok;
+    }
+    return ok;
+}
@@ -0,0 +1,143 @@
+/**
+ * @file    Code\utils\utils_encoding.h.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   字符编码组件  UTF-8 校验, UTF-8 <-> UTF-16 (Qt / Win32 宽字符), GBK <-> UTF-8 (文件名 日志)
+ *          * 所有转换先用 SSE2 一次处理 16 字节的 ASCII, 只有非 ASCII 的部分逐字符处理
+ *          * 非法输入替换为 U+FFFD (GBK 方向为 '?'), 函数返回 false 但仍输出完整结果
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#pragma once
+#ifndef UTILS_ENCODING_H_
+#define UTILS_ENCODING_H_
+
+#include <string>
+#include <string_view>
+
+/**
+ * @class   Utils_Encoding utils_encoding.h Code\utils\utils_encoding.h
+ *
+ * @brief   The utilities encoding.
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+class Utils_Encoding
+{
+    public:
+
+    /**
+     * @fn  static size_t Utils_Encoding::AsciiPrefix(const char *data, size_t len);
+     *
+     * @brief   开头连续 ASCII 字符的长度  SSE2 每次检查 16 字节
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param   data    The data
+     * @param   len     The length
+     *
+     * @return  ASCII 前缀长度, 全部为 ASCII 时等于 len
+     */
+    static size_t AsciiPrefix(const char *data, size_t len);
+
+    /**
+     * @fn  static bool Utils_Encoding::IsAscii(std::string_view str);
+     *
+     * @brief   是否全部为 ASCII
+     *
+     * @param   str The string
+     *
+     * @return  True if ascii, false if not
+     */
+    static bool IsAscii(std::string_view str);
+
+    /**
+     * @fn  static size_t Utils_Encoding::Utf8ValidPrefix(std::string_view str);
+     *
+     * @brief   最长合法 UTF-8 前缀的长度  拒绝过长编码 代理区 以及超过 U+10FFFF 的码点
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param   str The string
+     *
+     * @return  合法前缀长度, 整体合法时等于 str.size()
+     */
+    static size_t Utf8ValidPrefix(std::string_view str);
+
+    /**
+     * @fn  static bool Utils_Encoding::IsUtf8(std::string_view str);
+     *
+     * @brief   是否为合法 UTF-8
+     *
+     * @param   str The string
+     *
+     * @return  True if valid, false if not
+     */
+    static bool IsUtf8(std::string_view str);
+
+    /**
+     * @fn  static bool Utils_Encoding::Utf8ToUtf16(std::string_view src, std::u16string &dst);
+     *
+     * @brief   UTF-8 转 UTF-16  结果可直接用于 QString::fromUtf16 或 Win32 W 系列接口
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param           src The source
+     * @param [in,out]  dst 输出 覆盖原有内容
+     *
+     * @return  输入全部合法返回 true, 有替换字符返回 false
+     */
+    static bool Utf8ToUtf16(std::string_view src, std::u16string &dst);
+
+    /**
+     * @fn  static bool Utils_Encoding::Utf16ToUtf8(std::u16string_view src, std::string &dst);
+     *
+     * @brief   UTF-16 转 UTF-8  不成对的代理项替换为 U+FFFD
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param           src The source
+     * @param [in,out]  dst 输出 覆盖原有内容
+     *
+     * @return  输入全部合法返回 true, 有替换字符返回 false
+     */
+    static bool Utf16ToUtf8(std::u16string_view src, std::string &dst);
+
+    /**
+     * @fn  static bool Utils_Encoding::GbkToUtf8(std::string_view src, std::string &dst);
+     *
+     * @brief   GBK (CP936) 转 UTF-8  ASCII 部分直接拷贝, 连续的非 ASCII 部分一次交给系统编码转换
+     *          * Windows 使用 MultiByteToWideChar, 其他平台使用 iconv
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param           src The source
+     * @param [in,out]  dst 输出 覆盖原有内容
+     *
+     * @return  输入全部合法返回 true, 有替换字符返回 false
+     */
+    static bool GbkToUtf8(std::string_view src, std::string &dst);
+
+    /**
+     * @fn  static bool Utils_Encoding::Utf8ToGbk(std::string_view src, std::string &dst);
+     *
+     * @brief   UTF-8 转 GBK (CP936)  GBK 无法表示的字符 以及非法的 UTF-8 输出 '?'
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param           src The source
+     * @param [in,out]  dst 输出 覆盖原有内容
+     *
+     * @return  全部转换成功返回 true, 有替换字符返回 false
+     */
+    static bool Utf8ToGbk(std::string_view src, std::string &dst);
+};
+
+#endif  // UTILS_ENCODING_H_
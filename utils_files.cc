@@ -8,10 +8,19 @@
 
 #include "./utils_string.h"
 #include "./utils_files.h"
+#include "./utils_walker.h"
+#include "./utils_path.h"
 
-#include  <io.h>
 #include <string.h>
+#include <algorithm>
+#ifdef _WIN32
+#include <io.h>
 #include <direct.h>
+#else
+#include <unistd.h>
+#include <sys/stat.h>
+#define _access access
+#endif
 
 /**
  * @fn  bool Utils_Files::WriteStringBinary(std::fstream * pfile, const std::string & str, int len)
@@ -35,64 +44,39 @@ std::vector<std::string> Utils_Files::ListAllFiles(const std::string & file_path
     return res;
 }
 
-// 递归列出文件
+// 递归列出文件  使用 Utils_Walker 多线程遍历, 结果排序之后顺序固定
 void Utils_Files::ListAllFiles(const std::string &file_path, std::vector<std::string> &filelist)
 {
-    // 在目录后面加上"\\*.*"进行第一次搜索
-    std::string file_path_new = file_path + "\\*.*";
-    intptr_t handle;
-    _finddata_t findData;
-    handle = _findfirst(file_path_new.c_str (), &findData);
-    if (handle == -1)        // 检查是否成功
-    {
-        return ;
-    }
-    do
-    {
-        // 如果是 目录 则递归 否则不处理
-        if (findData.attrib & _A_SUBDIR)
-        {
-            // 如果找到的是 当前目录 .  或者上层目录 ..  继续
-            if (strcmp(findData.name, ".") == 0 || strcmp(findData.name, "..") == 0)
-            {
-                continue;
-            }
-            // 在目录后面加上"\\"和搜索到的目录名进行下一次搜索
-            file_path_new = file_path + "\\" + std::string(findData.name);
-            ListAllFiles(file_path_new, filelist);
-        }
-        else
-        {
-            file_path_new = file_path + "\\" + std::string(findData.name);
-            filelist.push_back(file_path_new);
-        }
-    }
-    while (_findnext(handle, &findData) == 0);
-    _findclose(handle);  // 关闭搜索句柄
+    std::vector<std::string> res = Utils_Walker::List(file_path, Utils_Walker::Options());
+    filelist.insert(filelist.end(), std::make_move_iterator(res.begin()), std::make_move_iterator(res.end()));
 }
 
-// 从 字符路径中 获取文件名
-std::string Utils_Files::GetFileName(const std::string & file)
+void Utils_Files::ListAllFiles(const std::string & file_path, std::vector<std::string>& filelist, const Utils_Glob & filter)
 {
-    size_t pos_backlash = file.find_last_of('\\');
-    size_t pos_dot = file.find_last_of('.'); // 从后面找到.  避免出错
-
-    // 找不到斜线则 首位, 找不到点 则最后一位
-    pos_backlash = (pos_backlash == std::string::npos) ? -1 : pos_backlash;
-    pos_dot = (pos_dot == std::string::npos) ? file.size() : pos_dot;
+    Utils_Walker::Options opt;
+    opt.filter = &filter;
+    std::vector<std::string> res = Utils_Walker::List(file_path, opt);
+    filelist.insert(filelist.end(), std::make_move_iterator(res.begin()), std::make_move_iterator(res.end()));
+}
 
-    return file.substr(pos_backlash + 1, pos_dot - pos_backlash - 1);
+// 从 字符路径中 获取文件名  '/' 和 '\\' 都作为分隔符, 只去掉文件名中的扩展名
+std::string Utils_Files::GetFileName(const std::string & file)
+{
+    return std::string(Utils_Path::Stem(file));
 }
 
 
 // 二进制文件写入
 bool Utils_Files::WriteStringBinary(std::fstream * pfile, const std::string & str, int len)
 {
-    char *tmp = new char[len];
-    tmp = Utils_String::String2Char(str);
-    pfile->write(tmp, len);
-    delete []tmp;
-    return true;
+    if (pfile == nullptr || len < 0)
+        return false;
+    // 定长字段 超长截断, 不足补 '\0'
+    const size_t n = std::min(str.size(), static_cast<size_t>(len));
+    pfile->write(str.data(), static_cast<std::streamsize>(n));
+    for (size_t i = n; i < static_cast<size_t>(len); i++)
+        pfile->put('\0');
+    return pfile->good();
 }
 
 /**
@@ -111,10 +95,19 @@ bool Utils_Files::WriteStringBinary(std::fstream * pfile, const std::string & st
  */
 bool Utils_Files::ReadStringBinary(std::fstream * pfile, std::string & str, int len)
 {
-    char *tmp = new char[len];
-    pfile->read(tmp, len);
-    str = Utils_String::Char2String(tmp);
-    delete []tmp;
+    if (pfile == nullptr || len < 0)
+        return false;
+    // 定长字段 内容到第一个 '\0' 为止, 字段中没有 '\0' 时不能越过 len 读取
+    str.resize(static_cast<size_t>(len));
+    pfile->read(&str[0], len);
+    if (pfile->gcount() != len)
+    {
+        str.clear();
+        return false;
+    }
+    size_t end = str.find('\0');
+    if (end != std::string::npos)
+        str.resize(end);
     return true;
 }
 
@@ -133,16 +126,16 @@ bool Utils_Files::ReadStringBinary(std::fstream * pfile, std::string & str, int
  */
 bool Utils_Files::WriteStringTxt(std::fstream *pfile, const std::string &str)
 {
-    if (pfile==nullptr && !pfile->is_open ())
+    if (pfile == nullptr || !pfile->is_open())
     {
         return false;
     }
 
-    pfile->write(str.c_str(),str.size());
-
+    // 每行 flush 一次, 高频写入使用 Utils_AsyncWriter
+    pfile->write(str.c_str(), str.size());
     pfile->write("\n", 1);
     pfile->flush();
-    return true;
+    return pfile->good();
 }
 
 
@@ -162,22 +155,14 @@ bool Utils_Files::WriteStringTxt(std::fstream *pfile, const std::string &str)
  */
 bool Utils_Files::SplitFileName(std::string &file_name, std::string &file_path, const std::string &filename)
 {
-    // 根据 filename 更新 file_name_, 和 file_path_  找到最后一个 "/" 如果找不到 pos = -1
-    size_t pos = filename.find_last_of("/");
-    // 如果 找不到前置 /  表示当层目录, 对应的是 "" "/" "./" 
-    if (pos < 2)
-        file_path = "./";
+    // 路径含末尾分隔符, 没有分隔符时为当前目录 "./"; assign 复用调用者字符串的容量
+    const std::string_view dir = Utils_Path::Dir(filename);
+    const std::string_view stem = Utils_Path::Stem(filename);
+    if (dir.empty())
+        file_path.assign("./");
     else
-        file_path = filename.substr(0, pos + 1);    // 将 /  包含到 path 中
-
-                                                    // 从找到的pos 后一位开始就可
-    file_name = filename.substr(pos + 1); // 从/ 开始到最后的结尾
-    pos = file_name.find_last_of(".");     // 计算最后一个 ". "  去除 拓展名
-
-                                           // 表示找到了字符串
-    if (pos > 0)
-        file_name = file_name.substr(0, pos);
-
+        file_path.assign(dir.data(), dir.size());
+    file_name.assign(stem.data(), stem.size());
     return true;
 }
 
@@ -200,12 +185,11 @@ bool Utils_Files::IsDirExist(const std::string & path, bool create_)
     {
         if (create_)
         {
-#ifdef WIN32  
+#ifdef _WIN32
             int flag = _mkdir(path.c_str());
-#endif  
-#ifdef linux   
-            int flag = mkdir(dir.c_str(), 0777);
-#endif  
+#else
+            int flag = mkdir(path.c_str(), 0777);
+#endif
             return (flag == 0);
         }
         else
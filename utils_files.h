@@ -16,6 +16,9 @@
 #include <vector>
 #include <string>
 #include <iostream>
+#include <fstream>
+
+class Utils_Glob;
 
 /**
  * @class   Utils_Files utils_files.h Code\utils\utils_files.h
@@ -54,6 +57,21 @@ class Utils_Files
      */
     static void ListAllFiles(const std::string &file_path, std::vector<std::string> &filelist);
 
+    /**
+     * @fn  static void Utils_Files::ListAllFiles(const std::string &file_path, std::vector<std::string> &filelist, const Utils_Glob &filter);
+     *
+     * @brief   递归列出文件名与通配符匹配的文件  遍历时直接判断, 不匹配的文件不生成路径
+     *          *   ListAllFiles("D:\\data", files, Utils_Glob("*.{jpg,png}", true));
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param           file_path   Full pathname of the file
+     * @param [in,out]  filelist    The filelist
+     * @param           filter      文件名通配符 (utils_glob.h)
+     */
+    static void ListAllFiles(const std::string &file_path, std::vector<std::string> &filelist, const Utils_Glob &filter);
+
     /**
      * @fn  static std::string Utils_Files::GetFileName(const std::string &file);
      *
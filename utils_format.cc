@@ -0,0 +1,410 @@
+/**
+ * @file    Code\utils\utils_format.cc.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   Utilities format class 数字格式化的实现
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#include "./utils_format.h"
+#include "./utils_string.h"
+
+#include <charconv>
+#include <string.h>
+
+/**
+ * @struct  PairTable
+ *
+ * @brief   编译期生成的两位查表 10 进制 00-99, 16 进制 00-FF 大小写各一份
+ */
+struct PairTable
+{
+    char dec[200];
+    char hex_up[512];
+    char hex_lo[512];
+
+    constexpr PairTable() : dec(), hex_up(), hex_lo()
+    {
+        for (int i = 0; i < 100; i++)
+        {
+            dec[i * 2] = static_cast<char>('0' + i / 10);
+            dec[i * 2 + 1] = static_cast<char>('0' + i % 10);
+        }
+        const char up[] = "0123456789ABCDEF";
+        const char lo[] = "0123456789abcdef";
+        for (int i = 0; i < 256; i++)
+        {
+            hex_up[i * 2] = up[i >> 4];
+            hex_up[i * 2 + 1] = up[i & 0x0F];
+            hex_lo[i * 2] = lo[i >> 4];
+            hex_lo[i * 2 + 1] = lo[i & 0x0F];
+        }
+    }
+};
+
+static constexpr PairTable kPairs;
+
+const char * Utils_Format::DigitPairs(void)
+{
+    return kPairs.dec;
+}
+
+const char * Utils_Format::HexPairs(bool upper)
+{
+    return upper ? kPairs.hex_up : kPairs.hex_lo;
+}
+
+/**
+ * @fn  static char *WriteDigits(char *end, unsigned long long num, int base, bool upper)
+ *
+ * @brief   从 end 向前写入 num 的各位数字, 返回第一位的位置
+ *          * 10 和 16 进制每次处理两位, 其余进制交给 std::to_chars
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ *
+ * @param [in,out]  end     缓冲区尾部, 前面至少 kIntBufSize 字节
+ * @param           num     Number of
+ * @param           base    The base
+ * @param           upper   字母大写
+ *
+ * @return  第一位数字的指针
+ */
+static char *WriteDigits(char *end, unsigned long long num, int base, bool upper)
+{
+    char *p = end;
+    if (base == 10)
+    {
+        while (num >= 100)
+        {
+            p -= 2;
+            memcpy(p, kPairs.dec + (num % 100) * 2, 2);
+            num /= 100;
+        }
+        if (num >= 10)
+        {
+            p -= 2;
+            memcpy(p, kPairs.dec + num * 2, 2);
+        }
+        else
+        {
+            *--p = static_cast<char>('0' + num);
+        }
+        return p;
+    }
+    if (base == 16)
+    {
+        const char *table = upper ? kPairs.hex_up : kPairs.hex_lo;
+        while (num >= 0x100)
+        {
+            p -= 2;
+            memcpy(p, table + (num & 0xFF) * 2, 2);
+            num >>= 8;
+        }
+        if (num >= 0x10)
+        {
+            p -= 2;
+            memcpy(p, table + num * 2, 2);
+        }
+        else
+        {
+            *--p = table[num * 2 + 1];
+        }
+        return p;
+    }
+
+    // 其他进制 to_chars 输出在缓冲区开头, 移动到尾部对齐
+    char tmp[Utils_Format::kIntBufSize];
+    std::to_chars_result r = std::to_chars(tmp, tmp + sizeof(tmp), num, base);
+    size_t n = static_cast<size_t>(r.ptr - tmp);
+    if (upper)
+        Utils_String::StringUpper(tmp, tmp, n);
+    p -= n;
+    memcpy(p, tmp, n);
+    return p;
+}
+
+/**
+ * @fn  static size_t FormatImpl(char *buf, size_t cap, unsigned long long mag, bool neg, int width, int base, bool upper)
+ *
+ * @brief   整数格式化公共部分 负号 + 补零 + 数字
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ *
+ * @return  写入字符数, 失败返回 0
+ */
+static size_t FormatImpl(char *buf, size_t cap, unsigned long long mag, bool neg, int width, int base, bool upper)
+{
+    if (base < 2 || base > 36)
+        return 0;
+
+    char tmp[Utils_Format::kIntBufSize];
+    char *end = tmp + sizeof(tmp);
+    char *p = WriteDigits(end, mag, base, upper);
+    size_t digits = static_cast<size_t>(end - p);
+
+    // 宽度包含负号, 与 printf("%0*d") 一致
+    size_t body = digits + (neg ? 1 : 0);
+    size_t pad = (width > 0 && static_cast<size_t>(width) > body) ? static_cast<size_t>(width) - body : 0;
+    size_t total = body + pad;
+    if (total > cap)
+        return 0;
+
+    char *out = buf;
+    if (neg)
+        *out++ = '-';
+    memset(out, '0', pad);
+    memcpy(out + pad, p, digits);
+    return total;
+}
+
+size_t Utils_Format::FormatInt(char * buf, size_t cap, long long num, int width, int base, bool upper)
+{
+    // 取绝对值时避免 LLONG_MIN 溢出
+    unsigned long long mag = num < 0 ? 0ULL - static_cast<unsigned long long>(num) : static_cast<unsigned long long>(num);
+    return FormatImpl(buf, cap, mag, num < 0, width, base, upper);
+}
+
+size_t Utils_Format::FormatUInt(char * buf, size_t cap, unsigned long long num, int width, int base, bool upper)
+{
+    return FormatImpl(buf, cap, num, false, width, base, upper);
+}
+
+/**
+ * @fn  size_t Utils_Format::FormatFloat(char *buf, size_t cap, double num, int precision)
+ *
+ * @brief   std::to_chars 定点输出  不依赖 locale, 不分配内存
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ *
+ * @param [in,out]  buf         The buffer
+ * @param           cap         The capability
+ * @param           num         Number of
+ * @param           precision   The precision
+ *
+ * @return  写入的字符数, 缓冲区不足返回 0
+ */
+size_t Utils_Format::FormatFloat(char * buf, size_t cap, double num, int precision)
+{
+    std::to_chars_result r = precision < 0
+        ? std::to_chars(buf, buf + cap, num, std::chars_format::fixed)
+        : std::to_chars(buf, buf + cap, num, std::chars_format::fixed, precision);
+    if (r.ec != std::errc())
+        return 0;
+    return static_cast<size_t>(r.ptr - buf);
+}
+
+void Utils_Format::AppendInt(std::string & dst, long long num, int width, int base, bool upper)
+{
+    char buf[kIntBufSize];
+    size_t n = FormatInt(buf, sizeof(buf), num, 0, base, upper);
+    if (n == 0)
+        return;
+    if (width > 0 && static_cast<size_t>(width) > n)
+    {
+        // 宽度超过栈上缓冲区 时 直接在字符串中补零
+        size_t sign = (num < 0) ? 1 : 0;
+        dst.append(buf, sign);
+        dst.append(static_cast<size_t>(width) - n, '0');
+        dst.append(buf + sign, n - sign);
+        return;
+    }
+    dst.append(buf, n);
+}
+
+void Utils_Format::AppendUInt(std::string & dst, unsigned long long num, int width, int base, bool upper)
+{
+    char buf[kIntBufSize];
+    size_t n = FormatUInt(buf, sizeof(buf), num, 0, base, upper);
+    if (n == 0)
+        return;
+    if (width > 0 && static_cast<size_t>(width) > n)
+        dst.append(static_cast<size_t>(width) - n, '0');
+    dst.append(buf, n);
+}
+
+void Utils_Format::AppendFloat(std::string & dst, double num, int precision)
+{
+    char buf[kFloatBufSize];
+    size_t n = FormatFloat(buf, sizeof(buf), num, precision);
+    if (n != 0)
+    {
+        dst.append(buf, n);
+        return;
+    }
+
+    // 超大数值 (1e300 定点输出有 300 多位) 直接写到字符串里
+    size_t old = dst.size();
+    size_t room = 330 + static_cast<size_t>(precision < 0 ? 0 : precision);
+    dst.resize(old + room);
+    n = FormatFloat(&dst[old], room, num, precision);
+    dst.resize(old + n);
+}
+
+static void WriteStdout(void *, const char *data, size_t len)
+{
+    fwrite(data, 1, len, stdout);
+}
+
+static void WriteFile(void *ctx, const char *data, size_t len)
+{
+    fwrite(data, 1, len, static_cast<FILE *>(ctx));
+}
+
+static void WriteString(void *ctx, const char *data, size_t len)
+{
+    static_cast<std::string *>(ctx)->append(data, len);
+}
+
+Utils_Format::Sink Utils_Format::StdoutSink(void)
+{
+    Sink sink;
+    sink.write = &WriteStdout;
+    return sink;
+}
+
+Utils_Format::Sink Utils_Format::FileSink(FILE * file)
+{
+    Sink sink;
+    if (file != nullptr)
+    {
+        sink.write = &WriteFile;
+        sink.ctx = file;
+    }
+    return sink;
+}
+
+Utils_Format::Sink Utils_Format::StringSink(std::string * str)
+{
+    Sink sink;
+    if (str != nullptr)
+    {
+        sink.write = &WriteString;
+        sink.ctx = str;
+    }
+    return sink;
+}
+
+/**
+ * @struct  PrintableTable
+ *
+ * @brief   hexdump ASCII 列的查表  可打印字符原样 其余为 '.'
+ */
+struct PrintableTable
+{
+    char v[256];
+    constexpr PrintableTable() : v()
+    {
+        for (int i = 0; i < 256; i++)
+            v[i] = (i >= 0x20 && i < 0x7F) ? static_cast<char>(i) : '.';
+    }
+};
+
+static constexpr PrintableTable kPrintable;
+
+// 偏移 8 位小写 hex + 两个空格
+static inline void WriteOffset(char *dst, size_t offset)
+{
+    const char *hex = kPairs.hex_lo;
+    memcpy(dst + 0, hex + ((offset >> 24) & 0xFF) * 2, 2);
+    memcpy(dst + 2, hex + ((offset >> 16) & 0xFF) * 2, 2);
+    memcpy(dst + 4, hex + ((offset >> 8) & 0xFF) * 2, 2);
+    memcpy(dst + 6, hex + (offset & 0xFF) * 2, 2);
+    dst[8] = ' ';
+    dst[9] = ' ';
+}
+
+/**
+ * @fn  size_t Utils_Format::HexDumpLine(char *dst, const uchar *data, size_t len, size_t offset)
+ *
+ * @brief   一行 16 字节 固定布局: 偏移[0,10) hex[10,59) 分隔[59,61) ASCII[61,77) |\n
+ *          * 满行时 每个字节的位置都是常量, 循环展开后没有分支
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ *
+ * @param [in,out]  dst     The destination
+ * @param           data    The data
+ * @param           len     The length
+ * @param           offset  The offset
+ *
+ * @return  写入的字符数
+ */
+size_t Utils_Format::HexDumpLine(char * dst, const uchar * data, size_t len, size_t offset)
+{
+    const char *hex = kPairs.hex_lo;
+    WriteOffset(dst, offset);
+    if (len >= 16)
+    {
+        for (int i = 0; i < 16; i++)
+        {
+            char *p = dst + 10 + i * 3 + (i >= 8 ? 1 : 0);
+            memcpy(p, hex + data[i] * 2, 2);
+            p[2] = ' ';
+        }
+        dst[34] = ' ';
+        dst[59] = ' ';
+        dst[60] = '|';
+        for (int i = 0; i < 16; i++)
+            dst[61 + i] = kPrintable.v[data[i]];
+        dst[77] = '|';
+        dst[78] = '\n';
+        return kHexDumpLineSize;
+    }
+
+    // 最后不满一行  hex 区补空格 保持 ASCII 列对齐, ASCII 列不补
+    memset(dst + 10, ' ', 50);
+    for (size_t i = 0; i < len; i++)
+        memcpy(dst + 10 + i * 3 + (i >= 8 ? 1 : 0), hex + data[i] * 2, 2);
+    dst[60] = '|';
+    for (size_t i = 0; i < len; i++)
+        dst[61 + i] = kPrintable.v[data[i]];
+    dst[61 + len] = '|';
+    dst[62 + len] = '\n';
+    return 63 + len;
+}
+
+void Utils_Format::HexDump(std::string & dst, const void * data, size_t len, size_t base_offset)
+{
+    if (data == nullptr || len == 0)
+        return;
+    const uchar *p = static_cast<const uchar *>(data);
+    size_t rows = (len + 15) / 16;
+    size_t old = dst.size();
+    dst.resize(old + rows * kHexDumpLineSize + 9);
+
+    char *out = &dst[old];
+    for (size_t i = 0; i < len; i += 16)
+        out += HexDumpLine(out, p + i, len - i, base_offset + i);
+
+    // 结尾 输出总长度的偏移, 与 hexdump -C 一致
+    WriteOffset(out, base_offset + len);
+    out[8] = '\n';
+    out += 9;
+    dst.resize(static_cast<size_t>(out - dst.data()));
+}
+
+void Utils_Format::HexDump(const Sink & sink, const void * data, size_t len, size_t base_offset)
+{
+    if (data == nullptr || len == 0)
+        return;
+    const uchar *p = static_cast<const uchar *>(data);
+
+    // 每次 51 行 约 4KB 写一次
+    char buf[51 * kHexDumpLineSize + 9];
+    size_t n = 0;
+    for (size_t i = 0; i < len; i += 16)
+    {
+        if (n + kHexDumpLineSize > sizeof(buf) - 9)
+        {
+            sink(buf, n);
+            n = 0;
+        }
+        n += HexDumpLine(buf + n, p + i, len - i, base_offset + i);
+    }
+    WriteOffset(buf + n, base_offset + len);
+    buf[n + 8] = '\n';
+    sink(buf, n + 9);
+}
@@ -0,0 +1,563 @@
+/**
+ * @file    Code\utils\utils_format.h.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   数字格式化组件 两位查表 + std::to_chars, 写入栈上缓冲区 或者 追加到字符串
+ *          * 全部不分配内存 (追加到 std::string 时 只有字符串自身扩容)
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#pragma once
+#ifndef UTILS_FORMAT_H_
+#define UTILS_FORMAT_H_
+
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <sstream>
+#include <iterator>
+#include <type_traits>
+
+/**
+ * @class   Utils_Format utils_format.h Code\utils\utils_format.h
+ *
+ * @brief   The utilities format.
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+class Utils_Format
+{
+    public:
+
+    /**
+     * @brief   整数格式化需要的最大缓冲区  64 位 2 进制 + 符号位
+     */
+    static constexpr size_t kIntBufSize = 66;
+
+    /**
+     * @brief   浮点数格式化建议的缓冲区大小  超过的数值使用 AppendFloat
+     */
+    static constexpr size_t kFloatBufSize = 64;
+
+    /**
+     * @fn  static size_t Utils_Format::FormatInt(char *buf, size_t cap, long long num, int width = 0, int base = 10, bool upper = true);
+     *
+     * @brief   整数写入缓冲区 前补 0 到 width 位 (包含负号, 与 %0*d 一致), 进制 2-36
+     *          * 10 进制 和 16 进制 使用两位查表, 其他进制使用 std::to_chars
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param [in,out]  buf     写入的缓冲区 不添加 \0
+     * @param           cap     缓冲区大小
+     * @param           num     Number of
+     * @param           width   (Optional) 最小宽度 不足补 0, 超过原样输出
+     * @param           base    (Optional) 进制 2-36
+     * @param           upper   (Optional) 字母大写
+     *
+     * @return  写入的字符数, 进制非法或缓冲区不足时返回 0
+     */
+    static size_t FormatInt(char *buf, size_t cap, long long num, int width = 0, int base = 10, bool upper = true);
+
+    /**
+     * @fn  static size_t Utils_Format::FormatUInt(char *buf, size_t cap, unsigned long long num, int width = 0, int base = 10, bool upper = true);
+     *
+     * @brief   无符号整数写入缓冲区, 规则同 FormatInt
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param [in,out]  buf     写入的缓冲区 不添加 \0
+     * @param           cap     缓冲区大小
+     * @param           num     Number of
+     * @param           width   (Optional) 最小宽度
+     * @param           base    (Optional) 进制 2-36
+     * @param           upper   (Optional) 字母大写
+     *
+     * @return  写入的字符数, 失败返回 0
+     */
+    static size_t FormatUInt(char *buf, size_t cap, unsigned long long num, int width = 0, int base = 10, bool upper = true);
+
+    /**
+     * @fn  static size_t Utils_Format::FormatFloat(char *buf, size_t cap, double num, int precision = -1);
+     *
+     * @brief   浮点数写入缓冲区 precision 表示小数点后位数, 小于 0 时输出最短可还原表示
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param [in,out]  buf         写入的缓冲区 不添加 \0
+     * @param           cap         缓冲区大小
+     * @param           num         Number of
+     * @param           precision   (Optional) 小数位数
+     *
+     * @return  写入的字符数, 缓冲区不足返回 0
+     */
+    static size_t FormatFloat(char *buf, size_t cap, double num, int precision = -1);
+
+    /**
+     * @fn  static void Utils_Format::AppendInt(std::string &dst, long long num, int width = 0, int base = 10, bool upper = true);
+     *
+     * @brief   整数追加到字符串尾部
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param [in,out]  dst     Destination string
+     * @param           num     Number of
+     * @param           width   (Optional) 最小宽度
+     * @param           base    (Optional) 进制 2-36
+     * @param           upper   (Optional) 字母大写
+     */
+    static void AppendInt(std::string &dst, long long num, int width = 0, int base = 10, bool upper = true);
+
+    /**
+     * @fn  static void Utils_Format::AppendUInt(std::string &dst, unsigned long long num, int width = 0, int base = 10, bool upper = true);
+     *
+     * @brief   无符号整数追加到字符串尾部
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param [in,out]  dst     Destination string
+     * @param           num     Number of
+     * @param           width   (Optional) 最小宽度
+     * @param           base    (Optional) 进制 2-36
+     * @param           upper   (Optional) 字母大写
+     */
+    static void AppendUInt(std::string &dst, unsigned long long num, int width = 0, int base = 10, bool upper = true);
+
+    /**
+     * @fn  static void Utils_Format::AppendFloat(std::string &dst, double num, int precision = -1);
+     *
+     * @brief   浮点数追加到字符串尾部
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param [in,out]  dst         Destination string
+     * @param           num         Number of
+     * @param           precision   (Optional) 小数位数
+     */
+    static void AppendFloat(std::string &dst, double num, int precision = -1);
+
+    /**
+     * @fn  static const char *Utils_Format::DigitPairs(void);
+     *
+     * @brief   "00" "01" ... "99" 两位数字表 共 200 字节
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @return  表的首地址
+     */
+    static const char *DigitPairs(void);
+
+    /**
+     * @fn  static const char *Utils_Format::HexPairs(bool upper = true);
+     *
+     * @brief   "00" "01" ... "FF" 两位 16 进制表 共 512 字节
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param   upper   (Optional) 字母大写
+     *
+     * @return  表的首地址
+     */
+    static const char *HexPairs(bool upper = true);
+
+    /**
+     * @struct  Sink
+     *
+     * @brief   输出目标  函数指针 + 上下文, 拷贝无开销, 不使用 std::function 避免分配
+     */
+    struct Sink
+    {
+        void (*write)(void *ctx, const char *data, size_t len) = nullptr;
+        void *ctx = nullptr;
+
+        void operator()(const char *data, size_t len) const
+        {
+            if (write != nullptr && len > 0)
+                write(ctx, data, len);
+        }
+    };
+
+    /**
+     * @fn  static Sink Utils_Format::StdoutSink(void);
+     *
+     * @brief   输出到 stdout
+     *
+     * @return  A Sink
+     */
+    static Sink StdoutSink(void);
+
+    /**
+     * @fn  static Sink Utils_Format::FileSink(FILE *file);
+     *
+     * @brief   输出到打开的文件
+     *
+     * @param [in,out]  file    If non-null, the file
+     *
+     * @return  A Sink
+     */
+    static Sink FileSink(FILE *file);
+
+    /**
+     * @fn  static Sink Utils_Format::StringSink(std::string *str);
+     *
+     * @brief   追加到字符串
+     *
+     * @param [in,out]  str If non-null, the string
+     *
+     * @return  A Sink
+     */
+    static Sink StringSink(std::string *str);
+
+    /**
+     * @brief   hexdump -C 一行的长度  偏移 + 16 个 hex + ASCII + 换行
+     */
+    static constexpr size_t kHexDumpLineSize = 79;
+
+    /**
+     * @fn  static size_t Utils_Format::HexDumpLine(char *dst, const uchar *data, size_t len, size_t offset);
+     *
+     * @brief   格式化一行 hexdump -C 格式  len == 16 时走无分支的快速路径
+     *          * 00000010  61 62 63 64 65 66 67 68  69 6a 6b 6c 6d 6e 6f 70  |abcdefghijklmnop|
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param [in,out]  dst     至少 kHexDumpLineSize 字节
+     * @param           data    本行数据
+     * @param           len     本行字节数 1-16
+     * @param           offset  本行的偏移
+     *
+     * @return  写入的字符数 含换行
+     */
+    static size_t HexDumpLine(char *dst, const uchar *data, size_t len, size_t offset);
+
+    /**
+     * @fn  static void Utils_Format::HexDump(std::string &dst, const void *data, size_t len, size_t base_offset = 0);
+     *
+     * @brief   hexdump -C 格式 追加到可复用的字符串  一次性扩容
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param [in,out]  dst         Destination string
+     * @param           data        The data
+     * @param           len         The length
+     * @param           base_offset (Optional) 显示的起始偏移
+     */
+    static void HexDump(std::string &dst, const void *data, size_t len, size_t base_offset = 0);
+
+    /**
+     * @fn  static void Utils_Format::HexDump(const Sink &sink, const void *data, size_t len, size_t base_offset = 0);
+     *
+     * @brief   hexdump -C 格式 经过栈上 4KB 缓冲区 分块写到 sink
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param   sink        输出目标
+     * @param   data        The data
+     * @param   len         The length
+     * @param   base_offset (Optional) 显示的起始偏移
+     */
+    static void HexDump(const Sink &sink, const void *data, size_t len, size_t base_offset = 0);
+
+    /**
+     * @class   Writer
+     *
+     * @brief   栈上固定 4KB 缓冲区 写满或析构时分块写到 sink, 数字直接格式化到缓冲区
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     */
+    class Writer
+    {
+        public:
+
+        static constexpr size_t kBufSize = 4096;
+
+        explicit Writer(const Sink &sink) : sink_(sink) {}
+        ~Writer()
+        {
+            Flush();
+        }
+
+        Writer(const Writer &) = delete;
+        Writer &operator=(const Writer &) = delete;
+
+        void Put(const char *data, size_t len)
+        {
+            if (len > kBufSize - used_)
+            {
+                Flush();
+                // 超过缓冲区的数据 直接写出
+                if (len >= kBufSize)
+                {
+                    sink_(data, len);
+                    total_ += len;
+                    return;
+                }
+            }
+            memcpy(buf_ + used_, data, len);
+            used_ += len;
+        }
+
+        void Put(std::string_view str)
+        {
+            Put(str.data(), str.size());
+        }
+
+        void Put(char c)
+        {
+            if (used_ == kBufSize)
+                Flush();
+            buf_[used_++] = c;
+        }
+
+        void PutInt(long long num, int width = 0)
+        {
+            if (width <= static_cast<int>(kIntBufSize))
+            {
+                used_ += FormatInt(Reserve(kIntBufSize), kIntBufSize, num, width);
+                return;
+            }
+            // 宽度超过缓冲区 符号 补零 数字分开写
+            char tmp[kIntBufSize];
+            size_t n = FormatInt(tmp, sizeof(tmp), num);
+            size_t sign = (num < 0) ? 1 : 0;
+            Put(tmp, sign);
+            PutZeros(static_cast<size_t>(width) - n);
+            Put(tmp + sign, n - sign);
+        }
+
+        void PutUInt(unsigned long long num, int width = 0)
+        {
+            if (width <= static_cast<int>(kIntBufSize))
+            {
+                used_ += FormatUInt(Reserve(kIntBufSize), kIntBufSize, num, width);
+                return;
+            }
+            char tmp[kIntBufSize];
+            size_t n = FormatUInt(tmp, sizeof(tmp), num);
+            PutZeros(static_cast<size_t>(width) - n);
+            Put(tmp, n);
+        }
+
+        void PutFloat(double num, int precision = -1)
+        {
+            size_t n = FormatFloat(Reserve(kFloatBufSize), kFloatBufSize, num, precision);
+            if (n == 0)
+            {
+                // 超长的定点输出 走字符串
+                std::string tmp;
+                AppendFloat(tmp, num, precision);
+                Put(tmp);
+                return;
+            }
+            used_ += n;
+        }
+
+        /**
+         * @fn  void Utils_Format::Writer::Flush(void)
+         *
+         * @brief   缓冲区内容写到 sink
+         */
+        void Flush(void)
+        {
+            if (used_ > 0)
+            {
+                sink_(buf_, used_);
+                total_ += used_;
+                used_ = 0;
+            }
+        }
+
+        /**
+         * @fn  size_t Utils_Format::Writer::Written(void) const
+         *
+         * @brief   已经写出和缓冲中的总字节数
+         */
+        size_t Written(void) const
+        {
+            return total_ + used_;
+        }
+
+        private:
+
+        void PutZeros(size_t n)
+        {
+            while (n > 0)
+            {
+                if (used_ == kBufSize)
+                    Flush();
+                size_t m = std::min(n, kBufSize - used_);
+                memset(buf_ + used_, '0', m);
+                used_ += m;
+                n -= m;
+            }
+        }
+
+        char *Reserve(size_t n)
+        {
+            if (kBufSize - used_ < n)
+                Flush();
+            return buf_ + used_;
+        }
+
+        Sink sink_;
+        size_t used_ = 0;
+        size_t total_ = 0;
+        char buf_[kBufSize];
+    };
+
+    /**
+     * @struct  PrintOptions
+     *
+     * @brief   容器打印的格式  head / tail 都为 0 时全部输出,
+     *          否则元素个数超过 head + tail 时 只输出前 head 个和后 tail 个, 中间输出省略提示
+     */
+    struct PrintOptions
+    {
+        const char *sep = " ";              ///< 元素之间的分隔符
+        const char *end = "\n";             ///< 结尾
+        bool index = false;                 ///< 输出下标
+        const char *index_prefix = "[";     ///< 下标前缀
+        const char *index_suffix = "] ";    ///< 下标后缀
+        size_t head = 0;                    ///< 超长时输出的前部元素个数
+        size_t tail = 0;                    ///< 超长时输出的尾部元素个数
+        int precision = -1;                 ///< 浮点数小数位数 小于 0 为最短表示
+        const char *empty = "Vector is Null";   ///< 空容器的输出
+    };
+
+    /**
+     * @fn  template<typename T> static void Utils_Format::PutValue(Writer &out, const T &val, int precision = -1)
+     *
+     * @brief   输出单个元素  整数 浮点走 to_chars, 字符串直接拷贝, 其余类型退回 operator<<
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @tparam  T   Generic type parameter.
+     * @param [in,out]  out         The writer
+     * @param           val         The value
+     * @param           precision   (Optional) 浮点数小数位数
+     */
+    template<typename T>
+    static void PutValue(Writer &out, const T &val, int precision = -1)
+    {
+        if constexpr (std::is_same_v<T, bool>)
+            out.Put(val ? '1' : '0');
+        else if constexpr (std::is_same_v<T, char> || std::is_same_v<T, signed char> || std::is_same_v<T, unsigned char>)
+            out.Put(static_cast<char>(val));     // 与 ostream 一致 按字符输出
+        else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>)
+            out.PutInt(static_cast<long long>(val));
+        else if constexpr (std::is_integral_v<T>)
+            out.PutUInt(static_cast<unsigned long long>(val));
+        else if constexpr (std::is_floating_point_v<T>)
+            out.PutFloat(static_cast<double>(val), precision);
+        else if constexpr (std::is_convertible_v<const T &, std::string_view>)
+            out.Put(std::string_view(val));
+        else
+        {
+            std::ostringstream os;
+            os << val;
+            out.Put(os.str());
+        }
+    }
+
+    /**
+     * @fn  template<typename T> static size_t Utils_Format::PrintRange(const Sink &sink, const T *data, size_t n, const PrintOptions &opt = PrintOptions())
+     *
+     * @brief   流式输出连续区间  内存占用固定为一个 Writer 缓冲区, 与元素个数无关
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @tparam  T   Generic type parameter.
+     * @param   sink    输出目标
+     * @param   data    区间首地址
+     * @param   n       元素个数
+     * @param   opt     (Optional) 格式
+     *
+     * @return  输出的字节数
+     */
+    template<typename T>
+    static size_t PrintRange(const Sink &sink, const T *data, size_t n, const PrintOptions &opt = PrintOptions())
+    {
+        Writer out(sink);
+        if (data == nullptr || n == 0)
+        {
+            out.Put(std::string_view(opt.empty));
+            out.Put(std::string_view(opt.end));
+            out.Flush();
+            return out.Written();
+        }
+
+        // 省略区间 [skip_begin, skip_end)
+        size_t skip_begin = n, skip_end = n;
+        if ((opt.head > 0 || opt.tail > 0) && n > opt.head + opt.tail)
+        {
+            skip_begin = opt.head;
+            skip_end = n - opt.tail;
+        }
+
+        const std::string_view sep(opt.sep);
+        for (size_t i = 0; i < n; i++)
+        {
+            if (i > 0)
+                out.Put(sep);
+            if (i == skip_begin)
+            {
+                out.Put(std::string_view("... ("));
+                out.PutUInt(skip_end - skip_begin);
+                out.Put(std::string_view(" omitted)"));
+                i = skip_end;
+                if (i == n)
+                    break;
+                out.Put(sep);
+            }
+            if (opt.index)
+            {
+                out.Put(std::string_view(opt.index_prefix));
+                out.PutUInt(i);
+                out.Put(std::string_view(opt.index_suffix));
+            }
+            PutValue(out, data[i], opt.precision);
+        }
+        out.Put(std::string_view(opt.end));
+        out.Flush();
+        return out.Written();
+    }
+
+    /**
+     * @fn  template<typename C> static size_t Utils_Format::Print(const Sink &sink, const C &range, const PrintOptions &opt = PrintOptions())
+     *
+     * @brief   输出连续容器 vector array string 以及 C 数组
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @tparam  C   容器类型
+     * @param   sink    输出目标
+     * @param   range   容器
+     * @param   opt     (Optional) 格式
+     *
+     * @return  输出的字节数
+     */
+    template<typename C>
+    static size_t Print(const Sink &sink, const C &range, const PrintOptions &opt = PrintOptions())
+    {
+        return PrintRange(sink, std::data(range), std::size(range), opt);
+    }
+};
+
+#endif  // UTILS_FORMAT_H_
@@ -0,0 +1,255 @@
+/**
+ * @file    Code\utils\utils_frame.cc.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   串口帧解析组件的实现
+ *          * 环形缓冲区后面多分配 max_len 字节的镜像区, 写入前 max_len 字节时同时写入镜像区,
+ *          * 这样任意位置开始的一帧在内存中都是连续的, 可以直接输出指针
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#include "./utils_frame.h"
+
+#include <string.h>
+#include <algorithm>
+
+Utils_FrameDecoder::Utils_FrameDecoder(const Config & cfg, size_t capacity)
+    : cfg_(cfg)
+{
+    cfg_.header_len = std::max(1, std::min(cfg_.header_len, 4));
+    cfg_.max_len = std::max(cfg_.max_len, cfg_.header_len + 1);
+    check_size_ = CheckSize(cfg_.check);
+
+    // 容量至少两帧, 保证缓冲区里等待的半帧不会堵住写入
+    size_t need = std::max(capacity, static_cast<size_t>(cfg_.max_len) * 2);
+    cap_ = 1;
+    while (cap_ < need)
+        cap_ <<= 1;
+    mask_ = cap_ - 1;
+    mirror_ = static_cast<size_t>(cfg_.max_len);
+    buf_.assign(cap_ + mirror_, 0);
+}
+
+int Utils_FrameDecoder::CheckSize(CheckType type)
+{
+    switch (type)
+    {
+        case Check_XOR:
+        case Check_Sum:
+            return 1;
+        case Check_CRC16:
+            return 2;
+        default:
+            return 0;
+    }
+}
+
+void Utils_FrameDecoder::Reset(void)
+{
+    read_pos_ = write_pos_ = 0;
+    pending_ = 0;
+    stats_ = Stats();
+}
+
+/**
+ * @fn  size_t Utils_FrameDecoder::Push(const uchar *data, size_t len)
+ *
+ * @brief   写入数据 最多两段 memcpy, 落在前 mirror_ 字节的部分同步写入镜像区
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ *
+ * @param   data    The data
+ * @param   len     The length
+ *
+ * @return  实际写入的字节数
+ */
+size_t Utils_FrameDecoder::Push(const uchar * data, size_t len)
+{
+    if (data == nullptr || len == 0)
+        return 0;
+    size_t free_bytes = cap_ - static_cast<size_t>(write_pos_ - read_pos_);
+    size_t n = std::min(len, free_bytes);
+    size_t done = 0;
+    while (done < n)
+    {
+        size_t pos = static_cast<size_t>(write_pos_ + done) & mask_;
+        size_t k = std::min(n - done, cap_ - pos);
+        uchar *dst = buf_.data();
+        memcpy(dst + pos, data + done, k);
+        if (pos < mirror_)
+            memcpy(dst + cap_ + pos, data + done, std::min(k, mirror_ - pos));
+        done += k;
+    }
+    write_pos_ += n;
+    stats_.bytes_in += n;
+    return n;
+}
+
+void Utils_FrameDecoder::Drop(size_t n)
+{
+    read_pos_ += n;
+    stats_.dropped_bytes += n;
+}
+
+/**
+ * @fn  bool Utils_FrameDecoder::Verify(const uchar *frame, size_t total) const
+ *
+ * @brief   根据配置计算校验 与帧尾的校验字段比较
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ *
+ * @param   frame   帧起始
+ * @param   total   帧总长
+ *
+ * @return  True if it succeeds, false if it fails
+ */
+bool Utils_FrameDecoder::Verify(const uchar * frame, size_t total) const
+{
+    if (cfg_.check == Check_None)
+        return true;
+    const uchar *begin = frame + cfg_.check_begin;
+    int len = static_cast<int>(total) - check_size_ - cfg_.check_begin;
+    const uchar *tail = frame + total - check_size_;
+    switch (cfg_.check)
+    {
+        case Check_XOR:
+            return Utils_String::Commu_CheckXOR(begin, len) == tail[0];
+        case Check_Sum:
+            return Utils_String::Commu_CheckSum(const_cast<uchar *>(begin), len) == tail[0];
+        case Check_CRC16:
+        {
+            unsigned short crc = Utils_String::Commu_CheckCRC16(begin, len);
+            return (crc & 0xFF) == tail[0] && (crc >> 8) == tail[1];
+        }
+        default:
+            return false;
+    }
+}
+
+/**
+ * @fn  bool Utils_FrameDecoder::Next(Frame &frame)
+ *
+ * @brief   查找帧头 -> 读取长度 -> 校验, 任意一步出错 丢弃一个字节 继续查找帧头
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ *
+ * @param [in,out]  frame   The frame
+ *
+ * @return  True if a frame is ready, false if more data is needed
+ */
+bool Utils_FrameDecoder::Next(Frame & frame)
+{
+    // 释放上一次输出的帧
+    read_pos_ += pending_;
+    pending_ = 0;
+
+    const uchar *base = buf_.data();
+    const size_t head_len = static_cast<size_t>(cfg_.header_len);
+    const size_t check_len = static_cast<size_t>(check_size_);
+
+    for (;;)
+    {
+        size_t avail = static_cast<size_t>(write_pos_ - read_pos_);
+        if (avail == 0)
+            return false;
+
+        // 1. memchr 查找帧头第一个字节 只在物理连续的部分查找
+        size_t pos = static_cast<size_t>(read_pos_) & mask_;
+        size_t span = std::min(avail, cap_ - pos);
+        const uchar *hit = static_cast<const uchar *>(memchr(base + pos, cfg_.header[0], span));
+        if (hit == nullptr)
+        {
+            Drop(span);
+            continue;
+        }
+        if (hit != base + pos)
+        {
+            Drop(static_cast<size_t>(hit - (base + pos)));
+            continue;
+        }
+
+        // 2. 比较完整帧头  借助镜像区连续访问
+        const uchar *p = base + pos;
+        if (avail < head_len)
+            return false;
+        if (memcmp(p, cfg_.header, head_len) != 0)
+        {
+            Drop(1);
+            continue;
+        }
+
+        // 3. 计算帧总长
+        size_t total = 0;
+        if (cfg_.len_size <= 0)
+        {
+            total = static_cast<size_t>(cfg_.fixed_len);
+        }
+        else
+        {
+            size_t field_end = static_cast<size_t>(cfg_.len_offset + cfg_.len_size);
+            if (avail < field_end)
+                return false;
+            unsigned long long v = 0;
+            for (int i = 0; i < cfg_.len_size; i++)
+            {
+                int idx = cfg_.len_big_endian ? i : cfg_.len_size - 1 - i;
+                v = (v << 8) | p[cfg_.len_offset + idx];
+            }
+            long long t = static_cast<long long>(v) + cfg_.len_adjust;
+            total = t > 0 ? static_cast<size_t>(t) : 0;
+        }
+        size_t min_total = std::max(head_len, static_cast<size_t>(cfg_.payload_offset)) + check_len;
+        if (total < min_total || total > static_cast<size_t>(cfg_.max_len))
+        {
+            stats_.bad_length++;
+            Drop(1);
+            continue;
+        }
+        if (avail < total)
+            return false;
+
+        // 4. 校验
+        if (!Verify(p, total))
+        {
+            stats_.bad_check++;
+            Drop(1);
+            continue;
+        }
+
+        frame.data = p;
+        frame.size = total;
+        frame.payload = p + cfg_.payload_offset;
+        frame.payload_size = total - check_len - static_cast<size_t>(cfg_.payload_offset);
+        pending_ = total;
+        stats_.frames++;
+        return true;
+    }
+}
+
+size_t Utils_FrameDecoder::AppendCheck(const Config & cfg, uchar * frame, size_t len_without_check)
+{
+    const uchar *begin = frame + cfg.check_begin;
+    int len = static_cast<int>(len_without_check) - cfg.check_begin;
+    uchar *tail = frame + len_without_check;
+    switch (cfg.check)
+    {
+        case Check_XOR:
+            tail[0] = Utils_String::Commu_CheckXOR(begin, len);
+            return len_without_check + 1;
+        case Check_Sum:
+            tail[0] = Utils_String::Commu_CheckSum(const_cast<uchar *>(begin), len);
+            return len_without_check + 1;
+        case Check_CRC16:
+        {
+            unsigned short crc = Utils_String::Commu_CheckCRC16(begin, len);
+            tail[0] = static_cast<uchar>(crc & 0xFF);
+            tail[1] = static_cast<uchar>(crc >> 8);
+            return len_without_check + 2;
+        }
+        default:
+            return len_without_check;
+    }
+}
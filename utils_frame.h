@@ -0,0 +1,254 @@
+/**
+ * @file    Code\utils\utils_frame.h.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   串口二进制帧 流式解析组件  罗盘 传感器等串口协议通用
+ *          * 帧格式: [帧头][... 长度字段 ...][数据][校验]  帧头 长度字段 校验方式可配置
+ *          * 内部为环形缓冲区, 构造时一次性分配, 之后解析过程不再分配内存
+ *          * 输出的帧直接指向环形缓冲区 (零拷贝), 出错时逐字节后移重新同步帧头
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#pragma once
+#ifndef UTILS_FRAME_H_
+#define UTILS_FRAME_H_
+
+#include <vector>
+#include <string>
+
+#include "./utils_string.h"
+
+/**
+ * @class   Utils_FrameDecoder utils_frame.h Code\utils\utils_frame.h
+ *
+ * @brief   串口帧解析器, 使用方法:
+ *          *   decoder.Feed(buf, len, [](const Utils_FrameDecoder::Frame &f){ ... });
+ *          * 或者
+ *          *   decoder.Push(buf, len);  while (decoder.Next(frame)) { ... }
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+class Utils_FrameDecoder
+{
+    public:
+
+    /**
+     * @enum    CheckType
+     *
+     * @brief   帧尾校验方式 对应 Utils_String::Commu_Check* 函数
+     */
+    enum CheckType
+    {
+        Check_None = 0,     // 无校验
+        Check_XOR = 1,      // 异或校验 1 字节   Commu_CheckXOR
+        Check_Sum = 2,      // 累加和 1 字节     Commu_CheckSum
+        Check_CRC16 = 3,    // CRC16 Modbus 2 字节 低字节在前  Commu_CheckCRC16
+    };
+
+    /**
+     * @struct  Config
+     *
+     * @brief   帧格式配置  所有偏移均相对于帧头第一个字节
+     */
+    struct Config
+    {
+        uchar header[4] = { 0xAA, 0x55, 0, 0 };  ///< 帧头字节
+        int header_len = 2;         ///< 帧头长度 1-4
+
+        int len_offset = 2;         ///< 长度字段偏移
+        int len_size = 1;           ///< 长度字段字节数 0 表示定长帧, 1 2 4
+        bool len_big_endian = false;    ///< 长度字段 大端
+        int len_adjust = 0;         ///< 帧总长 = 长度字段值 + len_adjust
+
+        int fixed_len = 0;          ///< 定长帧的总长度 (len_size == 0 时使用)
+        int payload_offset = 3;     ///< 数据部分偏移
+
+        CheckType check = Check_XOR;    ///< 校验方式
+        int check_begin = 0;        ///< 参与校验的起始偏移, 校验范围到校验字段之前
+
+        int max_len = 256;          ///< 帧最大长度, 超过视为长度字段出错
+    };
+
+    /**
+     * @struct  Frame
+     *
+     * @brief   解析得到的一帧, 指针指向解析器内部缓冲区 在下一次 Next 之前有效
+     */
+    struct Frame
+    {
+        const uchar *data = nullptr;    ///< 整帧 含帧头和校验
+        size_t size = 0;
+        const uchar *payload = nullptr; ///< 数据部分
+        size_t payload_size = 0;
+    };
+
+    /**
+     * @struct  Stats
+     *
+     * @brief   解析统计信息
+     */
+    struct Stats
+    {
+        size_t bytes_in = 0;        ///< 输入字节数
+        size_t frames = 0;          ///< 正确的帧数
+        size_t dropped_bytes = 0;   ///< 重新同步丢弃的字节数
+        size_t bad_length = 0;      ///< 长度字段不合法的次数
+        size_t bad_check = 0;       ///< 校验失败的次数
+    };
+
+    /**
+     * @fn  Utils_FrameDecoder::Utils_FrameDecoder(const Config &cfg, size_t capacity = 4096);
+     *
+     * @brief   构造解析器 一次性分配缓冲区, 容量向上取 2 的幂 且不小于 2 倍 max_len
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param   cfg         帧格式
+     * @param   capacity    (Optional) 环形缓冲区容量
+     */
+    explicit Utils_FrameDecoder(const Config &cfg, size_t capacity = 4096);
+
+    /**
+     * @fn  size_t Utils_FrameDecoder::Push(const uchar *data, size_t len);
+     *
+     * @brief   写入串口收到的数据, 缓冲区满时只写入一部分
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param   data    The data
+     * @param   len     The length
+     *
+     * @return  实际写入的字节数
+     */
+    size_t Push(const uchar *data, size_t len);
+
+    /**
+     * @fn  bool Utils_FrameDecoder::Next(Frame &frame);
+     *
+     * @brief   取出下一帧, 上一次取出的帧在此时才从缓冲区释放
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param [in,out]  frame   The frame
+     *
+     * @return  True if a frame is ready, false if more data is needed
+     */
+    bool Next(Frame &frame);
+
+    /**
+     * @fn  template<typename Fn> size_t Utils_FrameDecoder::Feed(const uchar *data, size_t len, Fn &&fn)
+     *
+     * @brief   写入任意长度的数据 并对每一帧调用 fn(const Frame &)
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @tparam  Fn  回调类型
+     * @param   data    The data
+     * @param   len     The length
+     * @param   fn      回调
+     *
+     * @return  本次解析出来的帧数
+     */
+    template<typename Fn>
+    size_t Feed(const uchar *data, size_t len, Fn &&fn)
+    {
+        size_t cnt = 0;
+        Frame frame;
+        do
+        {
+            size_t n = Push(data, len);
+            data += n;
+            len -= n;
+            while (Next(frame))
+            {
+                fn(static_cast<const Frame &>(frame));
+                cnt++;
+            }
+        } while (len > 0);
+        return cnt;
+    }
+
+    /**
+     * @fn  void Utils_FrameDecoder::Reset(void);
+     *
+     * @brief   清空缓冲区和统计信息
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     */
+    void Reset(void);
+
+    /**
+     * @fn  size_t Utils_FrameDecoder::Buffered(void) const
+     *
+     * @brief   缓冲区中尚未解析的字节数
+     *
+     * @return  字节数
+     */
+    size_t Buffered(void) const
+    {
+        return static_cast<size_t>(write_pos_ - read_pos_);
+    }
+
+    /**
+     * @fn  const Stats &Utils_FrameDecoder::GetStats(void) const
+     *
+     * @brief   获取统计信息
+     *
+     * @return  The stats
+     */
+    const Stats &GetStats(void) const
+    {
+        return stats_;
+    }
+
+    /**
+     * @fn  static int Utils_FrameDecoder::CheckSize(CheckType type);
+     *
+     * @brief   校验字段的字节数
+     *
+     * @param   type    The type
+     *
+     * @return  字节数
+     */
+    static int CheckSize(CheckType type);
+
+    /**
+     * @fn  static size_t Utils_FrameDecoder::AppendCheck(const Config &cfg, uchar *frame, size_t len_without_check);
+     *
+     * @brief   组帧用 根据配置计算校验并写到 frame 尾部 (frame 需要预留校验字节)
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param           cfg                 The configuration
+     * @param [in,out]  frame               帧缓冲区
+     * @param           len_without_check   不含校验的帧长度
+     *
+     * @return  含校验的帧总长度
+     */
+    static size_t AppendCheck(const Config &cfg, uchar *frame, size_t len_without_check);
+
+    private:
+
+    bool Verify(const uchar *frame, size_t total) const;
+    void Drop(size_t n);
+
+    Config cfg_;
+    std::vector<uchar> buf_;     ///< 容量 cap_ + 镜像区 max_len
+    size_t cap_ = 0;
+    size_t mask_ = 0;
+    size_t mirror_ = 0;          ///< 镜像区长度 等于 max_len
+    unsigned long long read_pos_ = 0;    ///< 单调递增的读位置
+    unsigned long long write_pos_ = 0;   ///< 单调递增的写位置
+    size_t pending_ = 0;         ///< 上一次输出的帧长度 下次 Next 时释放
+    int check_size_ = 0;
+    Stats stats_;
+};
+
+#endif  // UTILS_FRAME_H_
@@ -0,0 +1,356 @@
+/**
+ * @file    Code\utils\utils_glob.cc.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   通配符匹配的实现
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#include "./utils_glob.h"
+#include "./utils_detail.h"
+
+#include <string.h>
+#include <algorithm>
+
+/**
+ * @fn  static size_t SkipBracket(std::string_view p, size_t i)
+ *
+ * @brief   跳过 p[i] 开始的 [...]  ']' 紧跟在 '[' '[!' 之后时为普通字符
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ *
+ * @param   p   The pattern
+ * @param   i   '[' 的位置
+ *
+ * @return  ']' 之后的位置, 没有配对时返回 i + 1 ('[' 为普通字符)
+ */
+static size_t SkipBracket(std::string_view p, size_t i)
+{
+    size_t j = i + 1;
+    if (j < p.size() && (p[j] == '!' || p[j] == '^'))
+        j++;
+    if (j < p.size() && p[j] == ']')
+        j++;
+    while (j < p.size() && p[j] != ']')
+        j++;
+    return j < p.size() ? j + 1 : i + 1;
+}
+
+// 与 p[open] 配对的 '}' 的位置, 没有时返回 npos
+static size_t MatchBrace(std::string_view p, size_t open)
+{
+    int depth = 0;
+    for (size_t i = open; i < p.size();)
+    {
+        if (p[i] == '[')
+        {
+            i = SkipBracket(p, i);
+            continue;
+        }
+        if (p[i] == '{')
+            depth++;
+        else if (p[i] == '}' && --depth == 0)
+            return i;
+        i++;
+    }
+    return std::string_view::npos;
+}
+
+/**
+ * @fn  static bool ExpandBraces(std::string_view p, std::vector<std::string> &out, size_t limit)
+ *
+ * @brief   展开第一个有配对的 {}, 每个选项拼上前后缀后递归展开
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ *
+ * @param           p       The pattern
+ * @param [in,out]  out     不含 {} 的候选
+ * @param           limit   候选个数上限
+ *
+ * @return  True if it succeeds, false 超过上限
+ */
+static bool ExpandBraces(std::string_view p, std::vector<std::string> &out, size_t limit)
+{
+    for (size_t i = 0; i < p.size();)
+    {
+        if (p[i] == '[')
+        {
+            i = SkipBracket(p, i);
+            continue;
+        }
+        size_t close = p[i] == '{' ? MatchBrace(p, i) : std::string_view::npos;
+        if (close == std::string_view::npos)
+        {
+            i++;
+            continue;
+        }
+
+        std::string_view prefix = p.substr(0, i);
+        std::string_view body = p.substr(i + 1, close - i - 1);
+        std::string_view suffix = p.substr(close + 1);
+        std::string alt;
+        int depth = 0;
+        size_t start = 0;
+        for (size_t k = 0; k <= body.size();)
+        {
+            if (k < body.size() && body[k] == '[')
+            {
+                k = SkipBracket(body, k);
+                continue;
+            }
+            if (k == body.size() || (body[k] == ',' && depth == 0))
+            {
+                alt.assign(prefix).append(body.substr(start, k - start)).append(suffix);
+                if (!ExpandBraces(alt, out, limit))
+                    return false;
+                start = k + 1;
+            }
+            else if (body[k] == '{')
+            {
+                depth++;
+            }
+            else if (body[k] == '}')
+            {
+                depth--;
+            }
+            k++;
+        }
+        return true;
+    }
+    if (out.size() >= limit)
+        return false;
+    out.emplace_back(p);
+    return true;
+}
+
+bool Utils_Glob::Compile(std::string_view pattern, bool ignore_case)
+{
+    valid_ = false;
+    ignore_case_ = ignore_case;
+    tokens_.clear();
+    sets_.clear();
+    alts_.clear();
+
+    std::vector<std::string> expanded;
+    if (!ExpandBraces(pattern, expanded, kMaxAlternatives))
+        return false;
+    for (const std::string &p : expanded)
+        Tokenize(p);
+    if (sets_.size() > 0xFFFF)
+        return false;
+    valid_ = true;
+    return true;
+}
+
+/**
+ * @fn  void Utils_Glob::Tokenize(std::string_view p)
+ *
+ * @brief   一个不含 {} 的候选转换成记号  连续的 * 合并, [] 转换成 256 位的集合
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ *
+ * @param   p   The pattern
+ */
+void Utils_Glob::Tokenize(std::string_view p)
+{
+    Alternative alt;
+    alt.begin = static_cast<uint32_t>(tokens_.size());
+    for (size_t i = 0; i < p.size();)
+    {
+        uint8_t c = static_cast<uint8_t>(p[i]);
+        Token t = { kLiteral, c, 0 };
+        size_t end = c == '[' ? SkipBracket(p, i) : i + 1;
+        if (c == '*')
+        {
+            t.kind = kStar;
+            if (tokens_.size() > alt.begin && tokens_.back().kind == kStar)
+            {
+                i++;
+                continue;
+            }
+        }
+        else if (c == '?')
+        {
+            t.kind = kAny;
+        }
+        else if (c == '[' && end != i + 1)
+        {
+            Set set = {};
+            size_t j = i + 1;
+            bool negate = p[j] == '!' || p[j] == '^';
+            if (negate)
+                j++;
+            const size_t close = end - 1;
+            for (; j < close; j++)
+            {
+                uint8_t lo = static_cast<uint8_t>(p[j]), hi = lo;
+                if (j + 2 < close && p[j + 1] == '-')
+                {
+                    hi = static_cast<uint8_t>(p[j + 2]);
+                    j += 2;
+                }
+                for (unsigned x = lo; x <= hi; x++)
+                    set.bits[x >> 6] |= 1ULL << (x & 63);
+            }
+            if (ignore_case_)
+            {
+                for (unsigned x = 'a'; x <= 'z'; x++)
+                {
+                    unsigned y = x - 0x20;
+                    if ((set.bits[x >> 6] >> (x & 63) & 1) || (set.bits[y >> 6] >> (y & 63) & 1))
+                    {
+                        set.bits[x >> 6] |= 1ULL << (x & 63);
+                        set.bits[y >> 6] |= 1ULL << (y & 63);
+                    }
+                }
+            }
+            if (negate)
+            {
+                for (uint64_t &b : set.bits)
+                    b = ~b;
+            }
+            t.kind = kSet;
+            t.set = static_cast<uint16_t>(sets_.size());
+            sets_.push_back(set);
+        }
+        else if (ignore_case_)
+        {
+            t.ch = Utils_Detail::FoldCase(c);
+        }
+        tokens_.push_back(t);
+        i = end;
+    }
+    alt.end = static_cast<uint32_t>(tokens_.size());
+    alt.last_star = alt.end;
+    alt.min_len = 0;
+    for (uint32_t k = alt.begin; k < alt.end; k++)
+    {
+        if (tokens_[k].kind == kStar)
+            alt.last_star = k;
+        else
+            alt.min_len++;
+    }
+    alts_.push_back(alt);
+}
+
+inline bool Utils_Glob::MatchOne(const Token & t, uint8_t c) const
+{
+    switch (t.kind)
+    {
+        case kLiteral:
+            return (ignore_case_ ? Utils_Detail::FoldCase(c) : c) == t.ch;
+        case kSet:
+            return (sets_[t.set].bits[c >> 6] >> (c & 63)) & 1;
+        default:
+            return true;
+    }
+}
+
+// 不含 * 的一段 从 s 开始逐个比较, 调用者保证长度足够
+inline bool Utils_Glob::MatchSegment(const Token * t, const Token * te, const uint8_t * s) const
+{
+    for (; t < te; t++, s++)
+    {
+        if (!MatchOne(*t, *s))
+            return false;
+    }
+    return true;
+}
+
+/**
+ * @fn  bool Utils_Glob::MatchAlternative(const Alternative &alt, const uint8_t *s, const uint8_t *se) const
+ *
+ * @brief   一个候选的匹配
+ *          * 第一个 * 之前的段必须在开头, 最后一个 * 之后的段必须在结尾 (*.jpg 只比较最后 4 个字符)
+ *          * 中间的段依次找最左的位置; 某一段的最左位置之后能成功, 任何更靠右的位置也一样能成功, 所以不需要回溯
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ *
+ * @param   alt 候选
+ * @param   s   字符串起点
+ * @param   se  字符串终点
+ *
+ * @return  True if it matches, false if not
+ */
+bool Utils_Glob::MatchAlternative(const Alternative & alt, const uint8_t * s, const uint8_t * se) const
+{
+    const size_t n = static_cast<size_t>(se - s);
+    if (n < alt.min_len)
+        return false;
+    const Token *t = tokens_.data() + alt.begin;
+    const Token *te = tokens_.data() + alt.end;
+    if (alt.last_star == alt.end)
+        return n == alt.min_len && MatchSegment(t, te, s);
+
+    // 末段
+    const Token *last = tokens_.data() + alt.last_star;
+    se -= te - last - 1;
+    if (!MatchSegment(last + 1, te, se))
+        return false;
+
+    // 首段
+    for (; t->kind != kStar; t++, s++)
+    {
+        if (!MatchOne(*t, *s))
+            return false;
+    }
+
+    // 中间段
+    while (t < last)
+    {
+        t++;    // 跳过 *
+        const Token *seg = t;
+        while (t->kind != kStar)
+            t++;
+        size_t len = static_cast<size_t>(t - seg);
+        for (;; s++)
+        {
+            if (static_cast<size_t>(se - s) < len)
+                return false;
+            if (seg->kind == kLiteral && !ignore_case_)
+            {
+                const void *hit = memchr(s, seg->ch, static_cast<size_t>(se - s) - len + 1);
+                if (hit == nullptr)
+                    return false;
+                s = static_cast<const uint8_t *>(hit);
+            }
+            if (MatchSegment(seg, t, s))
+                break;
+        }
+        s += len;
+    }
+    return true;
+}
+
+bool Utils_Glob::Match(std::string_view str) const
+{
+    if (!valid_)
+        return false;
+    const uint8_t *s = reinterpret_cast<const uint8_t *>(str.data());
+    for (const Alternative &alt : alts_)
+    {
+        if (MatchAlternative(alt, s, s + str.size()))
+            return true;
+    }
+    return false;
+}
+
+bool Utils_Glob::MatchFileName(std::string_view path) const
+{
+    size_t pos = path.size();
+    while (pos > 0 && path[pos - 1] != '/' && path[pos - 1] != '\\')
+        pos--;
+    return Match(path.substr(pos));
+}
+
+size_t Utils_Glob::Filter(std::vector<std::string>& files) const
+{
+    files.erase(std::remove_if(files.begin(), files.end(),
+                               [this](const std::string &f) { return !MatchFileName(f); }),
+                files.end());
+    return files.size();
+}
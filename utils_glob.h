@@ -0,0 +1,153 @@
+/**
+ * @file    Code\utils\utils_glob.h.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   通配符匹配  用于过滤文件列表, 代替 substr / find 判断扩展名
+ *          * 支持 * ? [a-z] [!a-z] {jpg,png} (可嵌套), 可忽略大小写
+ *          * 编译时展开 {} 得到若干候选, 每个候选按 * 分段: 首段 末段固定位置比较, 中间段依次取最左匹配
+ *          * 匹配时间与 字符串长度 x 模式长度 成正比, 不会出现回溯爆炸, 不分配内存
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#pragma once
+#ifndef UTILS_GLOB_H_
+#define UTILS_GLOB_H_
+
+#include <stdint.h>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @class   Utils_Glob utils_glob.h Code\utils\utils_glob.h
+ *
+ * @brief   编译好的通配符  编译之后只读, 可以多个线程同时使用
+ *          *   Utils_Glob glob("*.{jpg,png,bmp}", true);
+ *          *   if (glob.MatchFileName("D:\\data\\IMG_0001.JPG")) ...
+ *          * '*' 匹配任意个字符 (包括路径分隔符), '?' 匹配一个字符, 没有转义字符, 特殊字符写成 [*] [?] [[] [{]
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+class Utils_Glob
+{
+    public:
+
+    Utils_Glob() = default;
+
+    explicit Utils_Glob(std::string_view pattern, bool ignore_case = false)
+    {
+        Compile(pattern, ignore_case);
+    }
+
+    /**
+     * @fn  bool Utils_Glob::Compile(std::string_view pattern, bool ignore_case = false);
+     *
+     * @brief   编译通配符  没有配对的 [ { 按普通字符处理
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param   pattern     通配符
+     * @param   ignore_case (Optional) True 忽略 ASCII 字母大小写
+     *
+     * @return  True if it succeeds, false {} 展开之后超过 kMaxAlternatives 个候选
+     */
+    bool Compile(std::string_view pattern, bool ignore_case = false);
+
+    bool IsValid(void) const
+    {
+        return valid_;
+    }
+
+    /**
+     * @fn  bool Utils_Glob::Match(std::string_view str) const;
+     *
+     * @brief   整个字符串是否匹配
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param   str The string
+     *
+     * @return  True if it matches, false if not
+     */
+    bool Match(std::string_view str) const;
+
+    /**
+     * @fn  bool Utils_Glob::MatchFileName(std::string_view path) const;
+     *
+     * @brief   只匹配最后一个 '/' 或 '\\' 之后的文件名
+     */
+    bool MatchFileName(std::string_view path) const;
+
+    /**
+     * @fn  bool Utils_Glob::operator()(std::string_view path) const
+     *
+     * @brief   作为过滤条件使用 同 MatchFileName
+     */
+    bool operator()(std::string_view path) const
+    {
+        return MatchFileName(path);
+    }
+
+    /**
+     * @fn  size_t Utils_Glob::Filter(std::vector<std::string> &files) const;
+     *
+     * @brief   原地删除文件名不匹配的项, 保持原有顺序
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param [in,out]  files   文件列表
+     *
+     * @return  剩余的个数
+     */
+    size_t Filter(std::vector<std::string> &files) const;
+
+    static constexpr size_t kMaxAlternatives = 256;
+
+    private:
+
+    enum TokenKind : uint8_t
+    {
+        kLiteral,
+        kAny,
+        kSet,
+        kStar,
+    };
+
+    struct Token
+    {
+        TokenKind kind;
+        uint8_t ch;         ///< kLiteral 忽略大小写时为小写
+        uint16_t set;       ///< kSet 在 sets_ 中的下标
+    };
+
+    struct Set
+    {
+        uint64_t bits[4];
+    };
+
+    // 一个 {} 展开之后的候选  tokens_[begin, end)
+    struct Alternative
+    {
+        uint32_t begin;
+        uint32_t end;
+        uint32_t last_star;     ///< 最后一个 * 的下标, 没有 * 时为 end
+        uint32_t min_len;       ///< 能匹配的最短长度 (除 * 之外的记号个数)
+    };
+
+    bool MatchOne(const Token &t, uint8_t c) const;
+    bool MatchSegment(const Token *t, const Token *te, const uint8_t *s) const;
+    bool MatchAlternative(const Alternative &alt, const uint8_t *s, const uint8_t *se) const;
+    void Tokenize(std::string_view pattern);
+
+    bool valid_ = false;
+    bool ignore_case_ = false;
+    std::vector<Token> tokens_;
+    std::vector<Set> sets_;
+    std::vector<Alternative> alts_;
+};
+
+#endif  // UTILS_GLOB_H_
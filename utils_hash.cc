@@ -0,0 +1,717 @@
+/**
+ * @file    Code\utils\utils_hash.cc.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   哈希与重复文件查找的实现
+ *          * 累加: 每个 64 位通道 acc[i] += lo32(d ^ k) * hi32(d ^ k), 相邻通道 acc[i ^ 1] += d;
+ *            AVX2 一次 4 个通道, SSE2 一次 2 个
+ *          * 一次计算处理 (len - 1) / 64 组后, 再用最后 64 字节作为一组 (可能与前面重叠),
+ *            流式计算保留最后 64 字节得到相同的结果
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#include "./utils_hash.h"
+#include "./utils_mmap.h"
+
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <mutex>
+#include <system_error>
+#include <thread>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define UTILS_HASH_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define UTILS_HASH_SSE2 1
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#include <stdlib.h>
+#endif
+
+namespace
+{
+
+constexpr uint32_t kPrime32_1 = 0x9E3779B1U;
+constexpr uint32_t kPrime32_2 = 0x85EBCA77U;
+constexpr uint32_t kPrime32_3 = 0xC2B2AE3DU;
+constexpr uint64_t kPrime64_1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t kPrime64_2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t kPrime64_3 = 0x165667B19E3779F9ULL;
+constexpr uint64_t kPrime64_4 = 0x85EBCA77C2B2AE63ULL;
+constexpr uint64_t kPrime64_5 = 0x27D4EB2F165667C5ULL;
+
+constexpr size_t kSecretSize = 192;
+constexpr size_t kStripe = 64;
+constexpr size_t kStripesPerBlock = (kSecretSize - kStripe) / 8;
+constexpr size_t kMidSizeMax = 240;
+
+// 密钥  splitmix64 生成, 编译期计算
+struct Secret
+{
+    uint8_t b[kSecretSize];
+
+    constexpr Secret() : b()
+    {
+        uint64_t state = 0;
+        for (size_t i = 0; i < kSecretSize / 8; i++)
+        {
+            state += 0x9E3779B97F4A7C15ULL;
+            uint64_t z = state;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            z ^= z >> 31;
+            for (size_t k = 0; k < 8; k++)
+                b[i * 8 + k] = static_cast<uint8_t>(z >> (8 * k));
+        }
+    }
+};
+
+constexpr Secret kSecret;
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+constexpr bool kBigEndian = true;
+#else
+constexpr bool kBigEndian = false;
+#endif
+
+inline uint32_t Swap32(uint32_t v)
+{
+#ifdef _MSC_VER
+    return _byteswap_ulong(v);
+#else
+    return __builtin_bswap32(v);
+#endif
+}
+
+inline uint64_t Swap64(uint64_t v)
+{
+#ifdef _MSC_VER
+    return _byteswap_uint64(v);
+#else
+    return __builtin_bswap64(v);
+#endif
+}
+
+inline uint32_t Read32(const uint8_t *p)
+{
+    uint32_t v;
+    memcpy(&v, p, 4);
+    return kBigEndian ? Swap32(v) : v;
+}
+
+inline uint64_t Read64(const uint8_t *p)
+{
+    uint64_t v;
+    memcpy(&v, p, 8);
+    return kBigEndian ? Swap64(v) : v;
+}
+
+inline uint64_t Rotl64(uint64_t v, int r)
+{
+    return (v << r) | (v >> (64 - r));
+}
+
+// 64x64->128 乘法 高低两半异或
+inline uint64_t Mul128Fold64(uint64_t a, uint64_t b)
+{
+#if defined(__SIZEOF_INT128__)
+    const __uint128_t p = static_cast<__uint128_t>(a) * b;
+    return static_cast<uint64_t>(p) ^ static_cast<uint64_t>(p >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    uint64_t hi;
+    const uint64_t lo = _umul128(a, b, &hi);
+    return lo ^ hi;
+#else
+    const uint64_t lo_lo = (a & 0xFFFFFFFF) * (b & 0xFFFFFFFF);
+    const uint64_t hi_lo = (a >> 32) * (b & 0xFFFFFFFF);
+    const uint64_t lo_hi = (a & 0xFFFFFFFF) * (b >> 32);
+    const uint64_t hi_hi = (a >> 32) * (b >> 32);
+    const uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xFFFFFFFF) + lo_hi;
+    const uint64_t upper = (hi_lo >> 32) + (cross >> 32) + hi_hi;
+    const uint64_t lower = (cross << 32) | (lo_lo & 0xFFFFFFFF);
+    return lower ^ upper;
+#endif
+}
+
+inline uint64_t Avalanche(uint64_t h)
+{
+    h ^= h >> 37;
+    h *= 0x165667919E3779F9ULL;
+    return h ^ (h >> 32);
+}
+
+inline uint64_t Avalanche64(uint64_t h)
+{
+    h ^= h >> 33;
+    h *= kPrime64_2;
+    h ^= h >> 29;
+    h *= kPrime64_3;
+    return h ^ (h >> 32);
+}
+
+inline uint64_t Rrmxmx(uint64_t h, uint64_t len)
+{
+    h ^= Rotl64(h, 49) ^ Rotl64(h, 24);
+    h *= 0x9FB21C651E98DF25ULL;
+    h ^= (h >> 35) + len;
+    h *= 0x9FB21C651E98DF25ULL;
+    return h ^ (h >> 28);
+}
+
+inline uint64_t Mix16(const uint8_t *p, const uint8_t *s, uint64_t seed)
+{
+    return Mul128Fold64(Read64(p) ^ (Read64(s) + seed), Read64(p + 8) ^ (Read64(s + 8) - seed));
+}
+
+// 0 - 240 字节
+uint64_t HashShort(const uint8_t *p, size_t len, uint64_t seed)
+{
+    const uint8_t *s = kSecret.b;
+    if (len <= 16)
+    {
+        if (len > 8)
+        {
+            const uint64_t lo = Read64(p) ^ ((Read64(s + 24) ^ Read64(s + 32)) + seed);
+            const uint64_t hi = Read64(p + len - 8) ^ ((Read64(s + 40) ^ Read64(s + 48)) - seed);
+            return Avalanche(len + Swap64(lo) + hi + Mul128Fold64(lo, hi));
+        }
+        if (len >= 4)
+        {
+            seed ^= static_cast<uint64_t>(Swap32(static_cast<uint32_t>(seed))) << 32;
+            const uint64_t in = Read32(p + len - 4) + (static_cast<uint64_t>(Read32(p)) << 32);
+            return Rrmxmx(in ^ ((Read64(s + 8) ^ Read64(s + 16)) - seed), len);
+        }
+        if (len > 0)
+        {
+            const uint32_t combined = (static_cast<uint32_t>(p[0]) << 16) | (static_cast<uint32_t>(p[len >> 1]) << 24) |
+                static_cast<uint32_t>(p[len - 1]) | (static_cast<uint32_t>(len) << 8);
+            const uint64_t bitflip = (Read32(s) ^ Read32(s + 4)) + seed;
+            return Avalanche64(combined ^ bitflip);
+        }
+        return Avalanche64(seed ^ (Read64(s + 56) ^ Read64(s + 64)));
+    }
+
+    uint64_t acc = len * kPrime64_1;
+    if (len <= 128)
+    {
+        if (len > 32)
+        {
+            if (len > 64)
+            {
+                if (len > 96)
+                {
+                    acc += Mix16(p + 48, s + 96, seed);
+                    acc += Mix16(p + len - 64, s + 112, seed);
+                }
+                acc += Mix16(p + 32, s + 64, seed);
+                acc += Mix16(p + len - 48, s + 80, seed);
+            }
+            acc += Mix16(p + 16, s + 32, seed);
+            acc += Mix16(p + len - 32, s + 48, seed);
+        }
+        acc += Mix16(p, s, seed);
+        acc += Mix16(p + len - 16, s + 16, seed);
+        return Avalanche(acc);
+    }
+
+    const size_t rounds = len / 16;
+    for (size_t i = 0; i < 8; i++)
+        acc += Mix16(p + 16 * i, s + 16 * i, seed);
+    acc = Avalanche(acc);
+    for (size_t i = 8; i < rounds; i++)
+        acc += Mix16(p + 16 * i, s + 16 * (i - 8) + 3, seed);
+    acc += Mix16(p + len - 16, s + 119, seed);
+    return Avalanche(acc);
+}
+
+// n 组 64 字节  第 k 组使用 s + 8k 开始的密钥
+void Accumulate(uint64_t *acc, const uint8_t *p, size_t n, const uint8_t *s)
+{
+#if defined(UTILS_HASH_AVX2)
+    __m256i a[2] = { _mm256_load_si256(reinterpret_cast<const __m256i *>(acc)),
+                     _mm256_load_si256(reinterpret_cast<const __m256i *>(acc + 4)) };
+    for (size_t k = 0; k < n; k++, p += kStripe, s += 8)
+    {
+        for (int j = 0; j < 2; j++)
+        {
+            const __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + 32 * j));
+            const __m256i key = _mm256_xor_si256(d, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s + 32 * j)));
+            const __m256i prod = _mm256_mul_epu32(key, _mm256_srli_epi64(key, 32));
+            a[j] = _mm256_add_epi64(a[j], _mm256_add_epi64(prod, _mm256_shuffle_epi32(d, _MM_SHUFFLE(1, 0, 3, 2))));
+        }
+    }
+    _mm256_store_si256(reinterpret_cast<__m256i *>(acc), a[0]);
+    _mm256_store_si256(reinterpret_cast<__m256i *>(acc + 4), a[1]);
+#elif defined(UTILS_HASH_SSE2)
+    __m128i a[4];
+    for (int j = 0; j < 4; j++)
+        a[j] = _mm_load_si128(reinterpret_cast<const __m128i *>(acc + 2 * j));
+    for (size_t k = 0; k < n; k++, p += kStripe, s += 8)
+    {
+        for (int j = 0; j < 4; j++)
+        {
+            const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 16 * j));
+            const __m128i key = _mm_xor_si128(d, _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + 16 * j)));
+            const __m128i prod = _mm_mul_epu32(key, _mm_srli_epi64(key, 32));
+            a[j] = _mm_add_epi64(a[j], _mm_add_epi64(prod, _mm_shuffle_epi32(d, _MM_SHUFFLE(1, 0, 3, 2))));
+        }
+    }
+    for (int j = 0; j < 4; j++)
+        _mm_store_si128(reinterpret_cast<__m128i *>(acc + 2 * j), a[j]);
+#else
+    for (size_t k = 0; k < n; k++, p += kStripe, s += 8)
+    {
+        for (size_t i = 0; i < 8; i++)
+        {
+            const uint64_t d = Read64(p + 8 * i);
+            const uint64_t key = d ^ Read64(s + 8 * i);
+            acc[i ^ 1] += d;
+            acc[i] += (key & 0xFFFFFFFF) * (key >> 32);
+        }
+    }
+#endif
+}
+
+// 每个块之后打乱  acc = (acc ^ acc >> 47 ^ key) * kPrime32_1
+void Scramble(uint64_t *acc, const uint8_t *s)
+{
+#if defined(UTILS_HASH_AVX2)
+    const __m256i prime = _mm256_set1_epi32(static_cast<int>(kPrime32_1));
+    for (int j = 0; j < 2; j++)
+    {
+        __m256i a = _mm256_load_si256(reinterpret_cast<const __m256i *>(acc + 4 * j));
+        a = _mm256_xor_si256(a, _mm256_srli_epi64(a, 47));
+        a = _mm256_xor_si256(a, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s + 32 * j)));
+        const __m256i lo = _mm256_mul_epu32(a, prime);
+        const __m256i hi = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), prime);
+        _mm256_store_si256(reinterpret_cast<__m256i *>(acc + 4 * j), _mm256_add_epi64(lo, _mm256_slli_epi64(hi, 32)));
+    }
+#elif defined(UTILS_HASH_SSE2)
+    const __m128i prime = _mm_set1_epi32(static_cast<int>(kPrime32_1));
+    for (int j = 0; j < 4; j++)
+    {
+        __m128i a = _mm_load_si128(reinterpret_cast<const __m128i *>(acc + 2 * j));
+        a = _mm_xor_si128(a, _mm_srli_epi64(a, 47));
+        a = _mm_xor_si128(a, _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + 16 * j)));
+        const __m128i lo = _mm_mul_epu32(a, prime);
+        const __m128i hi = _mm_mul_epu32(_mm_srli_epi64(a, 32), prime);
+        _mm_store_si128(reinterpret_cast<__m128i *>(acc + 2 * j), _mm_add_epi64(lo, _mm_slli_epi64(hi, 32)));
+    }
+#else
+    for (size_t i = 0; i < 8; i++)
+    {
+        uint64_t a = acc[i];
+        a ^= a >> 47;
+        a ^= Read64(s + 8 * i);
+        acc[i] = a * kPrime32_1;
+    }
+#endif
+}
+
+// 处理 n 组  in_block 为当前块中已处理的组数, 块满时打乱
+void Consume(uint64_t *acc, size_t &in_block, const uint8_t *p, size_t n)
+{
+    while (n > 0)
+    {
+        const size_t m = std::min(n, kStripesPerBlock - in_block);
+        Accumulate(acc, p, m, kSecret.b + 8 * in_block);
+        p += m * kStripe;
+        n -= m;
+        in_block += m;
+        if (in_block == kStripesPerBlock)
+        {
+            Scramble(acc, kSecret.b + kSecretSize - kStripe);
+            in_block = 0;
+        }
+    }
+}
+
+void InitAcc(uint64_t *acc, uint64_t seed)
+{
+    const uint64_t init[8] = { kPrime32_3, kPrime64_1, kPrime64_2, kPrime64_3,
+                               kPrime64_4, kPrime32_2, kPrime64_5, kPrime32_1 };
+    for (size_t i = 0; i < 8; i++)
+        acc[i] = (i & 1) ? init[i] - seed : init[i] + seed;
+}
+
+void LastStripe(uint64_t *acc, const uint8_t *last)
+{
+    Accumulate(acc, last, 1, kSecret.b + kSecretSize - kStripe - 7);
+}
+
+uint64_t Merge(const uint64_t *acc, const uint8_t *s, uint64_t start)
+{
+    uint64_t result = start;
+    for (size_t i = 0; i < 4; i++)
+        result += Mul128Fold64(acc[2 * i] ^ Read64(s + 16 * i), acc[2 * i + 1] ^ Read64(s + 16 * i + 8));
+    return Avalanche(result);
+}
+
+uint64_t Merge64(const uint64_t *acc, uint64_t len)
+{
+    return Merge(acc, kSecret.b + 11, len * kPrime64_1);
+}
+
+Utils_Hash128 Merge128(const uint64_t *acc, uint64_t len)
+{
+    Utils_Hash128 h;
+    h.low = Merge(acc, kSecret.b + 11, len * kPrime64_1);
+    h.high = Merge(acc, kSecret.b + kSecretSize - kStripe - 11, ~(len * kPrime64_2));
+    return h;
+}
+
+Utils_Hash128 HashShort128(const uint8_t *p, size_t len, uint64_t seed)
+{
+    Utils_Hash128 h;
+    h.low = HashShort(p, len, seed);
+    h.high = HashShort(p, len, seed ^ kPrime64_5);
+    return h;
+}
+
+void HashLong(uint64_t *acc, const uint8_t *p, size_t len, uint64_t seed)
+{
+    InitAcc(acc, seed);
+    size_t in_block = 0;
+    Consume(acc, in_block, p, (len - 1) / kStripe);
+    LastStripe(acc, p + len - kStripe);
+}
+
+// 在 [0, n) 上并行执行 fn(i)  调用线程也参与
+template<typename Fn>
+void ParallelFor(size_t n, int threads, Fn &&fn)
+{
+    if (threads <= 0)
+        threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    threads = static_cast<int>(std::min<size_t>(static_cast<size_t>(threads), n));
+    std::atomic<size_t> next(0);
+    auto run = [&]() {
+        for (size_t i; (i = next.fetch_add(1, std::memory_order_relaxed)) < n;)
+            fn(i);
+    };
+    std::vector<std::thread> workers;
+    for (int t = 1; t < threads; t++)
+        workers.emplace_back(run);
+    run();
+    for (auto &w : workers)
+        w.join();
+}
+
+}  // namespace
+
+uint64_t Utils_Hash::Hash64(const void * data, size_t size, uint64_t seed)
+{
+    const uint8_t *p = static_cast<const uint8_t *>(data);
+    if (size <= kMidSizeMax)
+        return HashShort(p, size, seed);
+    alignas(32) uint64_t acc[8];
+    HashLong(acc, p, size, seed);
+    return Merge64(acc, size);
+}
+
+Utils_Hash128 Utils_Hash::Hash128(const void * data, size_t size, uint64_t seed)
+{
+    const uint8_t *p = static_cast<const uint8_t *>(data);
+    if (size <= kMidSizeMax)
+        return HashShort128(p, size, seed);
+    alignas(32) uint64_t acc[8];
+    HashLong(acc, p, size, seed);
+    return Merge128(acc, size);
+}
+
+bool Utils_Hash::HashFile(const std::string & file, Utils_Hash128 & out)
+{
+    Utils_MappedFile mapped;
+    if (!mapped.Open(file))
+        return false;
+    mapped.Advise(Utils_MappedFile::kSequential, 0, mapped.size());
+    out = Hash128(mapped.data(), mapped.size());
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------
+
+void Utils_Hasher::Reset(uint64_t seed)
+{
+    InitAcc(acc_, seed);
+    buffered_ = 0;
+    in_block_ = 0;
+    total_ = 0;
+    seed_ = seed;
+}
+
+void Utils_Hasher::Update(const void * data, size_t size)
+{
+    const uint8_t *p = static_cast<const uint8_t *>(data);
+    total_ += size;
+    while (size > 0)
+    {
+        // 还有数据时才处理缓冲区, 保证结束时缓冲区不为空
+        if (buffered_ == kBuffer)
+        {
+            Consume(acc_, in_block_, buf_, kBuffer / kStripe);
+            memcpy(last_, buf_ + kBuffer - kStripe, kStripe);
+            buffered_ = 0;
+        }
+        if (buffered_ == 0 && size > kBuffer)
+        {
+            // 大块数据直接处理  留下至少 1 字节
+            const size_t stripes = (size - 1) / kStripe;
+            Consume(acc_, in_block_, p, stripes);
+            memcpy(last_, p + stripes * kStripe - kStripe, kStripe);
+            p += stripes * kStripe;
+            size -= stripes * kStripe;
+        }
+        const size_t n = std::min(size, kBuffer - buffered_);
+        memcpy(buf_ + buffered_, p, n);
+        buffered_ += n;
+        p += n;
+        size -= n;
+    }
+}
+
+void Utils_Hasher::Finish(uint64_t * acc) const
+{
+    memcpy(acc, acc_, sizeof(acc_));
+    size_t in_block = in_block_;
+    Consume(acc, in_block, buf_, (buffered_ - 1) / kStripe);
+    if (buffered_ >= kStripe)
+    {
+        LastStripe(acc, buf_ + buffered_ - kStripe);
+    }
+    else
+    {
+        uint8_t last[kStripe];
+        memcpy(last, last_ + buffered_, kStripe - buffered_);
+        memcpy(last + kStripe - buffered_, buf_, buffered_);
+        LastStripe(acc, last);
+    }
+}
+
+uint64_t Utils_Hasher::Digest64(void) const
+{
+    if (total_ <= kMidSizeMax)
+        return HashShort(buf_, static_cast<size_t>(total_), seed_);
+    alignas(32) uint64_t acc[8];
+    Finish(acc);
+    return Merge64(acc, total_);
+}
+
+Utils_Hash128 Utils_Hasher::Digest128(void) const
+{
+    if (total_ <= kMidSizeMax)
+        return HashShort128(buf_, static_cast<size_t>(total_), seed_);
+    alignas(32) uint64_t acc[8];
+    Finish(acc);
+    return Merge128(acc, total_);
+}
+
+// ---------------------------------------------------------------------------------------------
+
+namespace
+{
+
+struct DedupFile
+{
+    std::string path;
+    uint64_t size = 0;
+    Utils_Hash128 hash;
+    bool full = false;      ///< hash 为整个文件的哈希
+    bool ok = true;
+};
+
+// 开头和结尾各 edge 字节  小文件整个哈希
+bool EdgeHash(DedupFile &f, size_t edge)
+{
+    Utils_MappedFile mapped;
+    if (!mapped.Open(f.path) || mapped.size() != f.size)
+        return false;
+    if (f.size <= 2 * static_cast<uint64_t>(edge))
+    {
+        f.hash = Utils_Hash::Hash128(mapped.data(), mapped.size());
+        f.full = true;
+        return true;
+    }
+    Utils_Hasher hasher;
+    hasher.Update(mapped.data(), edge);
+    hasher.Update(mapped.data() + mapped.size() - edge, edge);
+    f.hash = hasher.Digest128();
+    return true;
+}
+
+bool FullHash(DedupFile &f)
+{
+    Utils_MappedFile mapped;
+    if (!mapped.Open(f.path) || mapped.size() != f.size)
+        return false;
+    mapped.Advise(Utils_MappedFile::kSequential, 0, mapped.size());
+    f.hash = Utils_Hash::Hash128(mapped.data(), mapped.size());
+    f.full = true;
+    return true;
+}
+
+bool SameKey(const DedupFile &a, const DedupFile &b)
+{
+    return a.size == b.size && a.hash == b.hash;
+}
+
+bool KeyLess(const DedupFile *a, const DedupFile *b)
+{
+    if (a->size != b->size)
+        return a->size < b->size;
+    return a->hash < b->hash;
+}
+
+// 按 (大小, 哈希) 排序后 相同的连续段中 至少两个的 保留
+std::vector<DedupFile *> KeepCollisions(std::vector<DedupFile *> files)
+{
+    std::sort(files.begin(), files.end(), KeyLess);
+    std::vector<DedupFile *> out;
+    for (size_t i = 0; i < files.size();)
+    {
+        size_t j = i + 1;
+        while (j < files.size() && SameKey(*files[i], *files[j]))
+            j++;
+        if (j - i >= 2)
+            out.insert(out.end(), files.begin() + static_cast<std::ptrdiff_t>(i), files.begin() + static_cast<std::ptrdiff_t>(j));
+        i = j;
+    }
+    return out;
+}
+
+std::vector<Utils_DuplicateGroup> Group(std::vector<DedupFile> &files, const Utils_Dedup::Options &opt,
+                                        Utils_Dedup::Stats &stats)
+{
+    // 1. 大小相同的
+    std::vector<DedupFile *> cand;
+    for (DedupFile &f : files)
+        if (f.ok && f.size >= opt.min_size)
+            cand.push_back(&f);
+    stats.files = cand.size();
+    cand = KeepCollisions(std::move(cand));
+
+    // 2. 开头和结尾
+    const size_t edge = std::max<size_t>(opt.edge_bytes, 1);
+    std::atomic<size_t> errors(0);
+    ParallelFor(cand.size(), opt.threads, [&](size_t i) {
+        if (!EdgeHash(*cand[i], edge))
+        {
+            cand[i]->ok = false;
+            errors.fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+    stats.edge_hashed = cand.size();
+    cand.erase(std::remove_if(cand.begin(), cand.end(), [](const DedupFile *f) { return !f->ok; }), cand.end());
+    cand = KeepCollisions(std::move(cand));
+
+    // 3. 整个文件
+    std::vector<DedupFile *> full;
+    for (DedupFile *f : cand)
+        if (!f->full)
+            full.push_back(f);
+    ParallelFor(full.size(), opt.threads, [&](size_t i) {
+        if (!FullHash(*full[i]))
+        {
+            full[i]->ok = false;
+            errors.fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+    stats.full_hashed = full.size();
+    stats.errors += errors.load();
+    cand.erase(std::remove_if(cand.begin(), cand.end(), [](const DedupFile *f) { return !f->ok; }), cand.end());
+    cand = KeepCollisions(std::move(cand));
+
+    std::vector<Utils_DuplicateGroup> groups;
+    for (size_t i = 0; i < cand.size();)
+    {
+        Utils_DuplicateGroup g;
+        g.size = cand[i]->size;
+        g.hash = cand[i]->hash;
+        for (; i < cand.size() && cand[i]->size == g.size && cand[i]->hash == g.hash; i++)
+            g.files.push_back(std::move(cand[i]->path));
+        std::sort(g.files.begin(), g.files.end());
+        groups.push_back(std::move(g));
+    }
+    std::sort(groups.begin(), groups.end(), [](const Utils_DuplicateGroup &a, const Utils_DuplicateGroup &b) {
+        return a.size != b.size ? a.size > b.size : a.files.front() < b.files.front();
+    });
+    return groups;
+}
+
+}  // namespace
+
+std::vector<Utils_DuplicateGroup> Utils_Dedup::Find(const std::vector<std::string> & roots, const Options & opt,
+                                                    Stats * stats)
+{
+    Utils_Walker::Options wopt = opt.walk;
+    wopt.threads = opt.threads;
+    wopt.report_dirs = false;
+    const int workers = Utils_Walker::WorkerCount(wopt);
+
+    // 遍历线程中 stat, 每个线程写自己的数组
+    std::vector<std::vector<DedupFile>> found(static_cast<size_t>(workers));
+    std::atomic<size_t> errors(0);
+    for (const std::string &root : roots)
+    {
+        Utils_Walker::Walk(root, wopt, [&](const Utils_WalkEntry &entry, int worker) {
+            if (entry.type != Utils_WalkEntry::kFile)
+                return;
+            DedupFile f;
+            f.path.assign(entry.path.data(), entry.path.size());
+            std::error_code ec;
+            f.size = std::filesystem::file_size(f.path, ec);
+            if (ec)
+            {
+                errors.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            found[static_cast<size_t>(worker)].push_back(std::move(f));
+        });
+    }
+
+    std::vector<DedupFile> files;
+    for (auto &part : found)
+        std::move(part.begin(), part.end(), std::back_inserter(files));
+    std::sort(files.begin(), files.end(), [](const DedupFile &a, const DedupFile &b) { return a.path < b.path; });
+    files.erase(std::unique(files.begin(), files.end(), [](const DedupFile &a, const DedupFile &b) {
+        return a.path == b.path;
+    }), files.end());
+
+    Stats local;
+    local.errors = errors.load();
+    std::vector<Utils_DuplicateGroup> groups = Group(files, opt, local);
+    if (stats != nullptr)
+        *stats = local;
+    return groups;
+}
+
+std::vector<Utils_DuplicateGroup> Utils_Dedup::FindInFiles(std::vector<std::string> paths, const Options & opt,
+                                                           Stats * stats)
+{
+    std::sort(paths.begin(), paths.end());
+    paths.erase(std::unique(paths.begin(), paths.end()), paths.end());
+    std::vector<DedupFile> files(paths.size());
+    std::atomic<size_t> errors(0);
+    ParallelFor(paths.size(), opt.threads, [&](size_t i) {
+        files[i].path = std::move(paths[i]);
+        std::error_code ec;
+        files[i].size = std::filesystem::file_size(files[i].path, ec);
+        if (ec)
+        {
+            files[i].ok = false;
+            errors.fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+
+    Stats local;
+    local.errors = errors.load();
+    std::vector<Utils_DuplicateGroup> groups = Group(files, opt, local);
+    if (stats != nullptr)
+        *stats = local;
+    return groups;
+}
@@ -0,0 +1,204 @@
+/**
+ * @file    Code\utils\utils_hash.h.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   快速非加密哈希 (64 / 128 位) 与 并行重复文件查找
+ *          * 哈希结构与 XXH3 相同: 8 个 64 位累加器, 每 64 字节一次 32x32->64 乘法累加, 每 1KB 打乱一次;
+ *            AVX2 / SSE2 / 标量 三种实现结果相同, 只用于比较, 常量不同, 结果与 xxhash 库不兼容
+ *          * 不超过 240 字节的输入走短路径, 不经过累加器
+ *          * 所有读取按小端, 不同平台结果相同, 可以保存后比较
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#pragma once
+#ifndef UTILS_HASH_H_
+#define UTILS_HASH_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "./utils_walker.h"
+
+/**
+ * @struct  Utils_Hash128
+ *
+ * @brief   128 位哈希值
+ */
+struct Utils_Hash128
+{
+    uint64_t low = 0;
+    uint64_t high = 0;
+
+    bool operator==(const Utils_Hash128 &other) const
+    {
+        return low == other.low && high == other.high;
+    }
+
+    bool operator!=(const Utils_Hash128 &other) const
+    {
+        return !(*this == other);
+    }
+
+    bool operator<(const Utils_Hash128 &other) const
+    {
+        return high != other.high ? high < other.high : low < other.low;
+    }
+};
+
+/**
+ * @class   Utils_Hash utils_hash.h Code\utils\utils_hash.h
+ *
+ * @brief   一次计算的哈希
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+class Utils_Hash
+{
+    public:
+
+    static uint64_t Hash64(const void *data, size_t size, uint64_t seed = 0);
+
+    static uint64_t Hash64(std::string_view data, uint64_t seed = 0)
+    {
+        return Hash64(data.data(), data.size(), seed);
+    }
+
+    static Utils_Hash128 Hash128(const void *data, size_t size, uint64_t seed = 0);
+
+    static Utils_Hash128 Hash128(std::string_view data, uint64_t seed = 0)
+    {
+        return Hash128(data.data(), data.size(), seed);
+    }
+
+    /**
+     * @fn  static bool Utils_Hash::HashFile(const std::string &file, Utils_Hash128 &out);
+     *
+     * @brief   映射整个文件计算 Hash128
+     */
+    static bool HashFile(const std::string &file, Utils_Hash128 &out);
+};
+
+/**
+ * @class   Utils_Hasher utils_hash.h Code\utils\utils_hash.h
+ *
+ * @brief   流式哈希  分段 Update 的结果与对整块数据调用 Utils_Hash 相同
+ *          *   Utils_Hasher hasher;
+ *          *   while (read(buf)) hasher.Update(buf, n);
+ *          *   uint64_t h = hasher.Digest64();
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+class Utils_Hasher
+{
+    public:
+
+    explicit Utils_Hasher(uint64_t seed = 0)
+    {
+        Reset(seed);
+    }
+
+    void Reset(uint64_t seed = 0);
+
+    void Update(const void *data, size_t size);
+
+    void Update(std::string_view data)
+    {
+        Update(data.data(), data.size());
+    }
+
+    /**
+     * @fn  uint64_t Utils_Hasher::Digest64(void) const;
+     *
+     * @brief   到目前为止的哈希  不改变状态, 可以继续 Update
+     */
+    uint64_t Digest64(void) const;
+
+    Utils_Hash128 Digest128(void) const;
+
+    uint64_t size(void) const
+    {
+        return total_;
+    }
+
+    private:
+
+    static constexpr size_t kBuffer = 256;  ///< 超过 240 字节之前不处理, 之后按 64 字节一组处理
+
+    void Finish(uint64_t *acc) const;
+
+    alignas(32) uint64_t acc_[8];
+    uint8_t buf_[kBuffer];
+    uint8_t last_[64];                      ///< 已处理数据的最后 64 字节
+    size_t buffered_ = 0;
+    size_t in_block_ = 0;
+    uint64_t total_ = 0;
+    uint64_t seed_ = 0;
+};
+
+/**
+ * @struct  Utils_DuplicateGroup
+ *
+ * @brief   内容相同的一组文件  files 按路径排序
+ */
+struct Utils_DuplicateGroup
+{
+    uint64_t size = 0;
+    Utils_Hash128 hash;
+    std::vector<std::string> files;
+};
+
+/**
+ * @class   Utils_Dedup utils_hash.h Code\utils\utils_hash.h
+ *
+ * @brief   并行查找重复文件  逐步缩小候选, 尽量少读文件:
+ *          * 1. 遍历目录 (Utils_Walker) 按文件大小分组, 大小唯一的文件不再读取
+ *          * 2. 同大小的文件只哈希 开头和结尾 edge_bytes 字节, 不超过 2 x edge_bytes 的文件直接整个哈希
+ *          * 3. 仍然相同的文件 整个哈希, 相同的为一组
+ *          * 硬链接 (同一个文件的多个路径) 也作为重复输出
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+class Utils_Dedup
+{
+    public:
+
+    struct Options
+    {
+        int threads = 0;                    ///< 遍历和哈希的线程数 小于等于 0 时使用 CPU 核数
+        size_t edge_bytes = 4096;           ///< 第 2 步哈希的开头 / 结尾字节数
+        uint64_t min_size = 1;              ///< 小于的文件不参与 (默认跳过空文件)
+        Utils_Walker::Options walk;         ///< 遍历选项 (过滤 扩展名 符号链接), threads 使用上面的
+    };
+
+    struct Stats
+    {
+        size_t files = 0;                   ///< 参与比较的文件数
+        size_t edge_hashed = 0;             ///< 第 2 步哈希的文件数
+        size_t full_hashed = 0;             ///< 第 3 步整个哈希的文件数
+        size_t errors = 0;                  ///< 无法读取的文件数
+    };
+
+    /**
+     * @fn  static std::vector<Utils_DuplicateGroup> Utils_Dedup::Find(const std::vector<std::string> &roots, const Options &opt, Stats *stats = nullptr);
+     *
+     * @brief   查找多个目录下的重复文件  结果按文件大小从大到小排序
+     */
+    static std::vector<Utils_DuplicateGroup> Find(const std::vector<std::string> &roots, const Options &opt,
+                                                  Stats *stats = nullptr);
+
+    /**
+     * @fn  static std::vector<Utils_DuplicateGroup> Utils_Dedup::FindInFiles(std::vector<std::string> files, const Options &opt, Stats *stats = nullptr);
+     *
+     * @brief   在给定的文件列表中查找  重复的路径只算一次
+     */
+    static std::vector<Utils_DuplicateGroup> FindInFiles(std::vector<std::string> files, const Options &opt,
+                                                         Stats *stats = nullptr);
+};
+
+#endif  // UTILS_HASH_H_
@@ -0,0 +1,803 @@
+/**
+ * @file    Code\utils\utils_index.cc.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   目录文件索引的实现
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#include "./utils_index.h"
+#include "./utils_glob.h"
+#include "./utils_path.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <unordered_map>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <sys/stat.h>
+#else
+#include <errno.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#if defined(__linux__)
+#include <sys/inotify.h>
+#endif
+#endif
+
+#ifdef _WIN32
+static constexpr char kSep = '\\';
+#else
+static constexpr char kSep = '/';
+#endif
+
+namespace
+{
+
+constexpr uint32_t kMagic = 0x58494655;     // "UFIX"
+constexpr uint32_t kVersion = 1;
+
+#if defined(__linux__)
+constexpr uint32_t kWatchMask = IN_CREATE | IN_CLOSE_WRITE | IN_ATTRIB | IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE |
+    IN_ONLYDIR | IN_EXCL_UNLINK;
+#endif
+
+bool IsSep(char c)
+{
+#ifdef _WIN32
+    return c == '\\' || c == '/';
+#else
+    return c == '/';
+#endif
+}
+
+// 普通文件的 大小 修改时间 inode  不跟随符号链接, 与遍历一致
+bool StatFile(const std::string &path, Utils_FileIndex::Entry &e)
+{
+#ifdef _WIN32
+    struct _stat64 sb;
+    if (_stat64(path.c_str(), &sb) != 0 || (sb.st_mode & _S_IFMT) != _S_IFREG)
+        return false;
+    e.size = static_cast<uint64_t>(sb.st_size);
+    e.mtime = static_cast<int64_t>(sb.st_mtime) * 1000000000;
+    e.inode = 0;
+#else
+    struct stat sb;
+    if (lstat(path.c_str(), &sb) != 0 || !S_ISREG(sb.st_mode))
+        return false;
+    e.size = static_cast<uint64_t>(sb.st_size);
+#if defined(__APPLE__)
+    e.mtime = static_cast<int64_t>(sb.st_mtimespec.tv_sec) * 1000000000 + sb.st_mtimespec.tv_nsec;
+#else
+    e.mtime = static_cast<int64_t>(sb.st_mtim.tv_sec) * 1000000000 + sb.st_mtim.tv_nsec;
+#endif
+    e.inode = static_cast<uint64_t>(sb.st_ino);
+#endif
+    return true;
+}
+
+bool SameFile(const Utils_FileIndex::Entry &a, const Utils_FileIndex::Entry &b)
+{
+    return a.size == b.size && a.mtime == b.mtime && a.inode == b.inode;
+}
+
+// 相对路径中目录的层数  "a" 为 0, "a/b" 为 1
+int Depth(std::string_view rel)
+{
+    int d = 0;
+    for (char c : rel)
+        d += IsSep(c);
+    return d;
+}
+
+uint64_t Fnv1a(const char *p, size_t n)
+{
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < n; i++)
+        h = (h ^ static_cast<uint8_t>(p[i])) * 0x100000001b3ULL;
+    return h;
+}
+
+template<typename T>
+void Put(std::string &buf, T v)
+{
+    buf.append(reinterpret_cast<const char *>(&v), sizeof(v));
+}
+
+void PutStr(std::string &buf, const std::string &s)
+{
+    Put(buf, static_cast<uint32_t>(s.size()));
+    buf += s;
+}
+
+// 快照读取  越界时 ok 置为 false, 之后的读取都返回 0
+struct Reader
+{
+    const char *p;
+    const char *end;
+    bool ok = true;
+
+    template<typename T>
+    T Get(void)
+    {
+        T v = T();
+        if (!ok || static_cast<size_t>(end - p) < sizeof(T))
+        {
+            ok = false;
+            return v;
+        }
+        memcpy(&v, p, sizeof(T));
+        p += sizeof(T);
+        return v;
+    }
+
+    std::string GetStr(void)
+    {
+        uint32_t n = Get<uint32_t>();
+        if (!ok || static_cast<size_t>(end - p) < n)
+        {
+            ok = false;
+            return std::string();
+        }
+        std::string s(p, n);
+        p += n;
+        return s;
+    }
+};
+
+}  // namespace
+
+Utils_FileIndex::Utils_FileIndex(std::string root, const Utils_Walker::Options &opt)
+    : root_(std::move(root)), opt_(opt)
+{
+    while (root_.size() > 1 && IsSep(root_.back()))
+        root_.pop_back();
+    prefix_ = (!root_.empty() && IsSep(root_.back())) ? root_.size() : root_.size() + 1;
+    opt_.report_dirs = false;
+    opt_.follow_symlinks = false;
+}
+
+Utils_FileIndex::~Utils_FileIndex()
+{
+    StopWatch();
+}
+
+std::string Utils_FileIndex::FullPath(std::string_view path) const
+{
+    if (path.empty())
+        return root_;
+    std::string full;
+    full.reserve(prefix_ + path.size());
+    full = root_;
+    if (prefix_ > root_.size())
+        full += kSep;
+    full.append(path.data(), path.size());
+    return full;
+}
+
+/**
+ * @fn  bool Utils_FileIndex::Accept(std::string_view rel, bool dir) const
+ *
+ * @brief   与 Utils_Walker 相同的过滤条件  文件检查 深度 隐藏 通配符 扩展名; 目录检查是否会进入
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+bool Utils_FileIndex::Accept(std::string_view rel, bool dir) const
+{
+    const int depth = Depth(rel);
+    if (opt_.max_depth >= 0 && (dir ? depth >= opt_.max_depth : depth > opt_.max_depth))
+        return false;
+    size_t start = 0;
+    for (size_t i = 0; i <= rel.size(); i++)
+    {
+        if (i == rel.size() || IsSep(rel[i]))
+        {
+            if (opt_.skip_hidden && i > start && rel[start] == '.')
+                return false;
+            if (i < rel.size())
+                start = i + 1;
+        }
+    }
+    if (dir)
+        return true;
+
+    const std::string_view name = rel.substr(start);
+    if (opt_.filter != nullptr && !opt_.filter->Match(name))
+        return false;
+    return opt_.extensions.empty() || Utils_Path::HasExtension(name, opt_.extensions);
+}
+
+/**
+ * @fn  void Utils_FileIndex::ScanTree(const std::string &rel, std::vector<std::pair<std::string, Entry>> &out) const
+ *
+ * @brief   遍历 rel 目录 ("" 为根目录) 并 stat 每个文件, 结果按路径排序  不访问索引, 可以不加锁
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+void Utils_FileIndex::ScanTree(const std::string &rel, std::vector<std::pair<std::string, Entry>> &out) const
+{
+    Utils_Walker::Options opt = opt_;
+    if (!rel.empty() && opt_.max_depth >= 0)
+    {
+        opt.max_depth = opt_.max_depth - Depth(rel) - 1;
+        if (opt.max_depth < 0)
+            return;
+    }
+
+    // stat 在遍历线程中进行  每个线程单独的结果
+    std::vector<std::vector<std::pair<std::string, Entry>>> parts(static_cast<size_t>(Utils_Walker::WorkerCount(opt)));
+    const size_t prefix = prefix_;
+    Utils_Walker::Walk(FullPath(rel), opt, [&parts, prefix](const Utils_WalkEntry &e, int worker) {
+        if (e.type != Utils_WalkEntry::kFile)
+            return;
+        std::string full(e.path);
+        Entry entry;
+        if (StatFile(full, entry))
+            parts[worker].emplace_back(full.substr(prefix), entry);
+    });
+
+    size_t total = out.size();
+    for (const auto &p : parts)
+        total += p.size();
+    out.reserve(total);
+    for (auto &p : parts)
+        std::move(p.begin(), p.end(), std::back_inserter(out));
+    std::sort(out.begin(), out.end(), [](const auto &a, const auto &b) { return a.first < b.first; });
+}
+
+void Utils_FileIndex::Apply(const std::string &rel, const Entry *now, size_t &changes)
+{
+    auto it = files_.find(rel);
+    if (now == nullptr)
+    {
+        if (it == files_.end())
+            return;
+        files_.erase(it);
+        log_.push_back({ gen_ + 1, kRemoved, rel });
+    }
+    else if (it == files_.end())
+    {
+        Entry &e = files_[rel];
+        e = *now;
+        e.gen = gen_ + 1;
+        log_.push_back({ gen_ + 1, kAdded, rel });
+    }
+    else
+    {
+        if (SameFile(it->second, *now))
+            return;
+        it->second = *now;
+        it->second.gen = gen_ + 1;
+        log_.push_back({ gen_ + 1, kModified, rel });
+    }
+    changes++;
+}
+
+/**
+ * @fn  size_t Utils_FileIndex::Diff(const std::vector<std::pair<std::string, Entry>> &now)
+ *
+ * @brief   用完整的扫描结果 (按路径排序) 更新索引  与索引同序归并, O(n)
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+size_t Utils_FileIndex::Diff(const std::vector<std::pair<std::string, Entry>> &now)
+{
+    size_t changes = 0;
+    const uint64_t gen = gen_ + 1;
+    auto it = files_.begin();
+    for (const auto &kv : now)
+    {
+        while (it != files_.end() && it->first < kv.first)
+        {
+            log_.push_back({ gen, kRemoved, it->first });
+            it = files_.erase(it);
+            changes++;
+        }
+        if (it != files_.end() && it->first == kv.first)
+        {
+            if (!SameFile(it->second, kv.second))
+            {
+                it->second = kv.second;
+                it->second.gen = gen;
+                log_.push_back({ gen, kModified, kv.first });
+                changes++;
+            }
+        }
+        else
+        {
+            it = files_.emplace_hint(it, kv.first, kv.second);
+            it->second.gen = gen;
+            log_.push_back({ gen, kAdded, kv.first });
+            changes++;
+        }
+        ++it;
+    }
+    while (it != files_.end())
+    {
+        log_.push_back({ gen, kRemoved, it->first });
+        it = files_.erase(it);
+        changes++;
+    }
+    return changes;
+}
+
+/**
+ * @fn  void Utils_FileIndex::Commit(size_t changes)
+ *
+ * @brief   有变化时版本号加 1, 日志超过上限时按整个版本丢弃最早的记录
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+void Utils_FileIndex::Commit(size_t changes)
+{
+    if (changes == 0)
+        return;
+    gen_++;
+    if (log_.size() <= log_limit_)
+        return;
+    size_t cut = log_.size() - log_limit_;
+    while (cut < log_.size() && log_[cut].gen == log_[cut - 1].gen)
+        cut++;
+    log_base_ = log_[cut - 1].gen;
+    log_.erase(log_.begin(), log_.begin() + static_cast<std::ptrdiff_t>(cut));
+}
+
+void Utils_FileIndex::SetLogLimit(size_t limit)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    log_limit_ = std::max<size_t>(limit, 1);
+}
+
+size_t Utils_FileIndex::Rescan(void)
+{
+    // 遍历不加锁, 期间可以查询
+    std::vector<std::pair<std::string, Entry>> now;
+    ScanTree(std::string(), now);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t changes = Diff(now);
+    Commit(changes);
+    return changes;
+}
+
+uint64_t Utils_FileIndex::Generation(void) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return gen_;
+}
+
+size_t Utils_FileIndex::size(void) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return files_.size();
+}
+
+bool Utils_FileIndex::Find(std::string_view path, Entry &entry) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = files_.find(std::string(path));
+    if (it == files_.end())
+        return false;
+    entry = it->second;
+    return true;
+}
+
+bool Utils_FileIndex::ChangesSince(uint64_t gen, std::vector<Change> &out) const
+{
+    out.clear();
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (gen < log_base_)
+        return false;
+
+    auto first = std::upper_bound(log_.begin(), log_.end(), gen,
+                                  [](uint64_t g, const LogItem &item) { return g < item.gen; });
+
+    // 每个路径的 第一次 和 最后一次 变化
+    struct Span
+    {
+        ChangeKind first;
+        ChangeKind last;
+        uint64_t gen;
+    };
+    std::unordered_map<std::string_view, Span> spans;
+    spans.reserve(static_cast<size_t>(std::distance(first, log_.end())));
+    for (auto it = first; it != log_.end(); ++it)
+    {
+        auto r = spans.try_emplace(it->path, Span{ it->kind, it->kind, it->gen });
+        if (!r.second)
+        {
+            r.first->second.last = it->kind;
+            r.first->second.gen = it->gen;
+        }
+    }
+
+    out.reserve(spans.size());
+    for (const auto &kv : spans)
+    {
+        const Span &s = kv.second;
+        ChangeKind kind;
+        if (s.first == kAdded)
+        {
+            if (s.last == kRemoved)
+                continue;
+            kind = kAdded;
+        }
+        else if (s.last == kRemoved)
+        {
+            kind = kRemoved;
+        }
+        else
+        {
+            kind = kModified;
+        }
+        out.push_back({ std::string(kv.first), kind, s.gen });
+    }
+    std::sort(out.begin(), out.end(), [](const Change &a, const Change &b) { return a.path < b.path; });
+    return true;
+}
+
+/**
+ * @fn  bool Utils_FileIndex::Save(const std::string &file) const
+ *
+ * @brief   快照格式  magic version gen log_base root 文件数 {path size mtime inode gen} 日志数 {gen kind path} fnv1a
+ *          * 本机字节序, 只用于同一台机器上的重启
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+bool Utils_FileIndex::Save(const std::string &file) const
+{
+    std::string buf;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        size_t bytes = 64 + root_.size() + files_.size() * 48 + log_.size() * 32;
+        for (const auto &kv : files_)
+            bytes += kv.first.size();
+        buf.reserve(bytes);
+        Put(buf, kMagic);
+        Put(buf, kVersion);
+        Put(buf, gen_);
+        Put(buf, log_base_);
+        PutStr(buf, root_);
+        Put(buf, static_cast<uint64_t>(files_.size()));
+        for (const auto &kv : files_)
+        {
+            PutStr(buf, kv.first);
+            Put(buf, kv.second.size);
+            Put(buf, kv.second.mtime);
+            Put(buf, kv.second.inode);
+            Put(buf, kv.second.gen);
+        }
+        Put(buf, static_cast<uint64_t>(log_.size()));
+        for (const LogItem &item : log_)
+        {
+            Put(buf, item.gen);
+            Put(buf, static_cast<uint8_t>(item.kind));
+            PutStr(buf, item.path);
+        }
+    }
+    Put(buf, Fnv1a(buf.data(), buf.size()));
+
+    const std::string tmp = file + ".tmp";
+    FILE *fp = fopen(tmp.c_str(), "wb");
+    if (fp == nullptr)
+        return false;
+    bool ok = fwrite(buf.data(), 1, buf.size(), fp) == buf.size() && fflush(fp) == 0;
+#ifndef _WIN32
+    ok = ok && fsync(fileno(fp)) == 0;
+#endif
+    ok = (fclose(fp) == 0) && ok;
+#ifdef _WIN32
+    ok = ok && MoveFileExA(tmp.c_str(), file.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+    ok = ok && rename(tmp.c_str(), file.c_str()) == 0;
+#endif
+    if (!ok)
+        remove(tmp.c_str());
+    return ok;
+}
+
+bool Utils_FileIndex::Load(const std::string &file)
+{
+    std::ifstream in(file, std::ios::binary);
+    if (!in.is_open())
+        return false;
+    std::string buf((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    if (buf.size() < sizeof(uint64_t))
+        return false;
+    const size_t body = buf.size() - sizeof(uint64_t);
+    uint64_t sum = 0;
+    memcpy(&sum, buf.data() + body, sizeof(sum));
+    if (sum != Fnv1a(buf.data(), body))
+        return false;
+
+    Reader r{ buf.data(), buf.data() + body };
+    if (r.Get<uint32_t>() != kMagic || r.Get<uint32_t>() != kVersion)
+        return false;
+    const uint64_t gen = r.Get<uint64_t>();
+    const uint64_t log_base = r.Get<uint64_t>();
+    if (r.GetStr() != root_ || !r.ok)
+        return false;
+
+    std::map<std::string, Entry> files;
+    uint64_t n = r.Get<uint64_t>();
+    for (uint64_t i = 0; i < n && r.ok; i++)
+    {
+        std::string path = r.GetStr();
+        Entry e;
+        e.size = r.Get<uint64_t>();
+        e.mtime = r.Get<int64_t>();
+        e.inode = r.Get<uint64_t>();
+        e.gen = r.Get<uint64_t>();
+        files.emplace_hint(files.end(), std::move(path), e);
+    }
+    std::vector<LogItem> log;
+    n = r.Get<uint64_t>();
+    for (uint64_t i = 0; i < n && r.ok; i++)
+    {
+        LogItem item;
+        item.gen = r.Get<uint64_t>();
+        item.kind = static_cast<ChangeKind>(r.Get<uint8_t>());
+        item.path = r.GetStr();
+        log.push_back(std::move(item));
+    }
+    if (!r.ok || r.p != r.end)
+        return false;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    files_.swap(files);
+    log_.swap(log);
+    gen_ = gen;
+    log_base_ = log_base;
+    return true;
+}
+
+#if defined(__linux__)
+
+/**
+ * @fn  bool Utils_FileIndex::WatchTree(const std::string &rel)
+ *
+ * @brief   给 rel 目录及其下会进入的子目录添加监视
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ *
+ * @return  false 添加失败 (通常是超过 max_user_watches)
+ */
+bool Utils_FileIndex::WatchTree(const std::string &rel)
+{
+    std::vector<std::string> dirs(1, rel);
+    Utils_Walker::Options opt;
+    opt.threads = 1;
+    opt.report_dirs = true;
+    opt.skip_hidden = opt_.skip_hidden;
+    // 子目录的深度小于 max_depth 时才会进入
+    bool walk = true;
+    if (opt_.max_depth >= 0)
+    {
+        opt.max_depth = opt_.max_depth - (rel.empty() ? 0 : Depth(rel) + 1) - 1;
+        walk = opt.max_depth >= 0;
+    }
+    if (walk)
+    {
+        const size_t prefix = prefix_;
+        Utils_Walker::Walk(FullPath(rel), opt, [&dirs, prefix](const Utils_WalkEntry &e) {
+            if (e.type == Utils_WalkEntry::kDir)
+                dirs.emplace_back(e.path.substr(prefix));
+        });
+    }
+
+    for (const std::string &dir : dirs)
+    {
+        if (!dir.empty() && !Accept(dir, true))
+            continue;
+        int wd = inotify_add_watch(inotify_fd_, FullPath(dir).c_str(), kWatchMask);
+        if (wd < 0)
+        {
+            if (errno == ENOENT || errno == ENOTDIR)
+                continue;   // 已经删除
+            return false;
+        }
+        watches_[wd] = dir;
+    }
+    return true;
+}
+
+void Utils_FileIndex::UnwatchTree(const std::string &rel)
+{
+    for (auto it = watches_.begin(); it != watches_.end();)
+    {
+        const std::string &dir = it->second;
+        if (dir == rel || (dir.size() > rel.size() && dir.compare(0, rel.size(), rel) == 0 && dir[rel.size()] == kSep))
+        {
+            inotify_rm_watch(inotify_fd_, it->first);
+            it = watches_.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+/**
+ * @fn  bool Utils_FileIndex::ReadEvents(std::vector<std::string> &dirty)
+ *
+ * @brief   读取全部已发生的事件, 收集需要重新 stat 的相对路径
+ *          * 文件只在 写关闭 / 属性 / 移动 / 删除 时处理, 正在写入的文件等写完后才出现在索引中
+ *          * 新目录添加监视并扫描 (添加监视之前创建的文件没有事件); 删除或移出的目录 其下的文件全部重新检查
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ *
+ * @return  false 事件队列溢出 或 无法添加监视, 需要重新扫描
+ */
+bool Utils_FileIndex::ReadEvents(std::vector<std::string> &dirty)
+{
+    alignas(struct inotify_event) char buf[64 * 1024];
+    bool ok = true;
+    for (;;)
+    {
+        ssize_t n = read(inotify_fd_, buf, sizeof(buf));
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            break;
+        for (const char *p = buf; p < buf + n;)
+        {
+            const struct inotify_event *ev = reinterpret_cast<const struct inotify_event *>(p);
+            p += sizeof(struct inotify_event) + ev->len;
+            if (ev->mask & IN_Q_OVERFLOW)
+            {
+                ok = false;
+                continue;
+            }
+            auto w = watches_.find(ev->wd);
+            if (w == watches_.end())
+                continue;
+            if (ev->mask & IN_IGNORED)
+            {
+                watches_.erase(w);
+                continue;
+            }
+            if (ev->len == 0)
+                continue;   // 目录自身的事件 由父目录的事件处理
+
+            std::string rel = w->second;
+            if (!rel.empty())
+                rel += kSep;
+            rel += ev->name;
+            if (ev->mask & IN_ISDIR)
+            {
+                if (ev->mask & (IN_CREATE | IN_MOVED_TO))
+                {
+                    if (!Accept(rel, true))
+                        continue;
+                    if (!WatchTree(rel))
+                        ok = false;
+                    std::vector<std::pair<std::string, Entry>> found;
+                    ScanTree(rel, found);
+                    for (auto &f : found)
+                        dirty.push_back(std::move(f.first));
+                }
+                else if (ev->mask & (IN_DELETE | IN_MOVED_FROM))
+                {
+                    UnwatchTree(rel);
+                    const std::string prefix = rel + kSep;
+                    for (auto it = files_.lower_bound(prefix);
+                         it != files_.end() && it->first.compare(0, prefix.size(), prefix) == 0; ++it)
+                        dirty.push_back(it->first);
+                }
+            }
+            else if (ev->mask & (IN_CLOSE_WRITE | IN_ATTRIB | IN_MOVED_TO | IN_DELETE | IN_MOVED_FROM))
+            {
+                dirty.push_back(std::move(rel));
+            }
+        }
+    }
+    return ok;
+}
+
+bool Utils_FileIndex::StartWatch(void)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (inotify_fd_ >= 0)
+        return true;
+    inotify_fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotify_fd_ < 0)
+        return false;
+    if (!WatchTree(std::string()) || watches_.empty())
+    {
+        close(inotify_fd_);
+        inotify_fd_ = -1;
+        watches_.clear();
+        return false;
+    }
+    return true;
+}
+
+void Utils_FileIndex::StopWatch(void)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (inotify_fd_ >= 0)
+        close(inotify_fd_);
+    inotify_fd_ = -1;
+    watches_.clear();
+}
+
+#else
+
+// 没有 inotify 的平台  Poll 使用 Rescan
+bool Utils_FileIndex::WatchTree(const std::string &)
+{
+    return false;
+}
+
+void Utils_FileIndex::UnwatchTree(const std::string &)
+{
+}
+
+bool Utils_FileIndex::ReadEvents(std::vector<std::string> &)
+{
+    return false;
+}
+
+bool Utils_FileIndex::StartWatch(void)
+{
+    return false;
+}
+
+void Utils_FileIndex::StopWatch(void)
+{
+}
+
+#endif
+
+bool Utils_FileIndex::IsWatching(void) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return inotify_fd_ >= 0;
+}
+
+size_t Utils_FileIndex::Poll(void)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (inotify_fd_ < 0)
+    {
+        lock.unlock();
+        return Rescan();
+    }
+
+    std::vector<std::string> dirty;
+    size_t changes = 0;
+    if (ReadEvents(dirty))
+    {
+        std::sort(dirty.begin(), dirty.end());
+        dirty.erase(std::unique(dirty.begin(), dirty.end()), dirty.end());
+        for (const std::string &rel : dirty)
+        {
+            Entry e;
+            bool exists = Accept(rel, false) && StatFile(FullPath(rel), e);
+            Apply(rel, exists ? &e : nullptr, changes);
+        }
+    }
+    else
+    {
+        std::vector<std::pair<std::string, Entry>> now;
+        ScanTree(std::string(), now);
+        changes = Diff(now);
+    }
+    Commit(changes);
+    return changes;
+}
@@ -0,0 +1,215 @@
+/**
+ * @file    Code\utils\utils_index.h.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   目录文件索引  代替反复调用 ListAllFiles 查找新采集的文件
+ *          * 保存 相对路径 大小 修改时间 inode, 可保存到磁盘, 下次启动时加载后增量更新
+ *          * Linux 使用 inotify 只处理变化的文件; 其他平台 或 事件队列溢出时 重新扫描并按 大小 / 修改时间 / inode 比较
+ *          * 每次更新产生一个版本号, 变化日志按版本号排序, 查询某个版本之后的变化只与变化的数量有关
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#pragma once
+#ifndef UTILS_INDEX_H_
+#define UTILS_INDEX_H_
+
+#include <stdint.h>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "./utils_walker.h"
+
+/**
+ * @class   Utils_FileIndex utils_index.h Code\utils\utils_index.h
+ *
+ * @brief   文件索引  所有函数加锁, 可以一个线程 Poll 其他线程查询
+ *          *   Utils_FileIndex index("/data/capture");
+ *          *   index.Load("capture.idx");          // 不存在时为空
+ *          *   index.StartWatch();                 // 不支持时 Poll 退化为重新扫描
+ *          *   index.Rescan();                     // 与磁盘同步 (离线期间的变化)
+ *          *   uint64_t seen = index.Generation();
+ *          *   ... index.Poll(); index.ChangesSince(seen, changes); seen = index.Generation(); ...
+ *          *   index.Save("capture.idx");
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+class Utils_FileIndex
+{
+    public:
+
+    enum ChangeKind : uint8_t
+    {
+        kAdded,
+        kModified,
+        kRemoved,
+    };
+
+    struct Entry
+    {
+        uint64_t size = 0;
+        int64_t mtime = 0;      ///< 纳秒 (Windows 为秒 x 1e9)
+        uint64_t inode = 0;     ///< Windows 为 0
+        uint64_t gen = 0;       ///< 最后一次变化的版本号
+    };
+
+    struct Change
+    {
+        std::string path;       ///< 相对根目录的路径
+        ChangeKind kind;
+        uint64_t gen;
+    };
+
+    /**
+     * @fn  explicit Utils_FileIndex::Utils_FileIndex(std::string root, const Utils_Walker::Options &opt = Utils_Walker::Options());
+     *
+     * @brief   Constructor  opt 中的过滤条件 (扩展名 通配符 隐藏文件 深度) 同样作用于 inotify 事件
+     *          * opt.filter 指向的 Utils_Glob 需要在索引的生存期内有效; report_dirs 和 follow_symlinks 不使用
+     */
+    explicit Utils_FileIndex(std::string root, const Utils_Walker::Options &opt = Utils_Walker::Options());
+    ~Utils_FileIndex();
+
+    Utils_FileIndex(const Utils_FileIndex &) = delete;
+    Utils_FileIndex &operator=(const Utils_FileIndex &) = delete;
+
+    /**
+     * @fn  bool Utils_FileIndex::Load(const std::string &file);
+     *
+     * @brief   加载快照  根目录不同 或 文件损坏时返回 false, 索引保持不变
+     */
+    bool Load(const std::string &file);
+
+    /**
+     * @fn  bool Utils_FileIndex::Save(const std::string &file) const;
+     *
+     * @brief   保存快照 (含变化日志)  先写临时文件再重命名, 中途失败不会破坏原有快照
+     */
+    bool Save(const std::string &file) const;
+
+    /**
+     * @fn  size_t Utils_FileIndex::Rescan(void);
+     *
+     * @brief   重新扫描整个目录 并与索引比较  多线程遍历和 stat
+     *
+     * @return  变化的文件数, 大于 0 时版本号加 1
+     */
+    size_t Rescan(void);
+
+    /**
+     * @fn  bool Utils_FileIndex::StartWatch(void);
+     *
+     * @brief   开始监视目录变化 (Linux inotify, 每个目录一个监视)
+     *          * 开始之前的变化不会报告, 需要时在 StartWatch 之后调用一次 Rescan
+     *
+     * @return  True if it succeeds, false 不支持 或 监视数超过系统限制 (fs.inotify.max_user_watches)
+     */
+    bool StartWatch(void);
+
+    void StopWatch(void);
+
+    bool IsWatching(void) const;
+
+    /**
+     * @fn  size_t Utils_FileIndex::Poll(void);
+     *
+     * @brief   处理已经发生的事件, 不等待  没有监视 或 事件队列溢出时 Rescan
+     *
+     * @return  变化的文件数, 大于 0 时版本号加 1
+     */
+    size_t Poll(void);
+
+    uint64_t Generation(void) const;
+
+    /**
+     * @fn  bool Utils_FileIndex::ChangesSince(uint64_t gen, std::vector<Change> &out) const;
+     *
+     * @brief   版本 gen 之后的变化  同一个文件多次变化合并为一项
+     *          * gen 之后新增又删除的文件不报告; 删除后又新增的报告为 kModified
+     *
+     * @param           gen 上次查询时的 Generation()
+     * @param [in,out]  out 变化 按路径排序
+     *
+     * @return  True if it succeeds, false gen 早于保留的日志, 需要用 ForEach 全量同步
+     */
+    bool ChangesSince(uint64_t gen, std::vector<Change> &out) const;
+
+    /**
+     * @fn  bool Utils_FileIndex::Find(std::string_view path, Entry &entry) const;
+     *
+     * @brief   按相对路径查找
+     */
+    bool Find(std::string_view path, Entry &entry) const;
+
+    size_t size(void) const;
+
+    const std::string &Root(void) const
+    {
+        return root_;
+    }
+
+    /**
+     * @fn  std::string Utils_FileIndex::FullPath(std::string_view path) const;
+     *
+     * @brief   相对路径 转换为 完整路径
+     */
+    std::string FullPath(std::string_view path) const;
+
+    /**
+     * @fn  template<typename Fn> void Utils_FileIndex::ForEach(Fn &&fn) const
+     *
+     * @brief   按路径顺序遍历  fn(const std::string &path, const Entry &entry), 期间持有锁
+     */
+    template<typename Fn>
+    void ForEach(Fn &&fn) const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto &kv : files_)
+            fn(kv.first, kv.second);
+    }
+
+    /**
+     * @fn  void Utils_FileIndex::SetLogLimit(size_t limit);
+     *
+     * @brief   变化日志最多保留的条数 (默认 1M), 超过时丢弃最早的版本
+     */
+    void SetLogLimit(size_t limit);
+
+    private:
+
+    struct LogItem
+    {
+        uint64_t gen;
+        ChangeKind kind;
+        std::string path;
+    };
+
+    bool Accept(std::string_view rel, bool dir) const;
+    void ScanTree(const std::string &rel, std::vector<std::pair<std::string, Entry>> &out) const;
+    void Apply(const std::string &rel, const Entry *now, size_t &changes);
+    size_t Diff(const std::vector<std::pair<std::string, Entry>> &now);
+    void Commit(size_t changes);
+    bool WatchTree(const std::string &rel);
+    void UnwatchTree(const std::string &rel);
+    bool ReadEvents(std::vector<std::string> &dirty);
+
+    std::string root_;
+    size_t prefix_;                         ///< 完整路径中相对路径的起始位置
+    Utils_Walker::Options opt_;
+
+    mutable std::mutex mutex_;
+    std::map<std::string, Entry> files_;
+    std::vector<LogItem> log_;              ///< 按版本号递增
+    uint64_t gen_ = 0;
+    uint64_t log_base_ = 0;                 ///< 日志中最早版本之前的版本, 更早的查询无法回答
+    size_t log_limit_ = size_t(1) << 20;
+
+    int inotify_fd_ = -1;
+    std::unordered_map<int, std::string> watches_;     ///< 监视描述符 -> 相对目录 ("" 为根目录)
+};
+
+#endif  // UTILS_INDEX_H_
@@ -0,0 +1,190 @@
+/**
+ * @file    Code\utils\utils_intern.cc.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   字符串驻留池的实现
+ *          * 发布顺序: 条目内容 -> 条目块指针 -> count_ -> 哈希槽位 (release), 读端从槽位 acquire 开始,
+ *          * 所以无锁读到的句柄 对应的条目一定是完整的
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#include "./utils_intern.h"
+
+#include <string.h>
+
+Utils_InternPool::Utils_InternPool(size_t capacity)
+    : table_(nullptr),
+      chunks_(new std::atomic<Entry *>[kMaxChunks]),
+      count_(0),
+      arena_(16 * 1024)
+{
+    for (uint32_t i = 0; i < kMaxChunks; i++)
+        chunks_[i].store(nullptr, std::memory_order_relaxed);
+
+    // 负载不超过 1/2
+    size_t slots = 16;
+    while (slots < capacity * 2)
+        slots <<= 1;
+    table_.store(NewTable(slots), std::memory_order_release);
+
+    // 句柄 0 为空字符串
+    Intern(std::string_view());
+}
+
+Utils_InternPool::~Utils_InternPool()
+{
+    for (uint32_t i = 0; i < kMaxChunks; i++)
+        delete[] chunks_[i].load(std::memory_order_relaxed);
+}
+
+Utils_InternPool &Utils_InternPool::Global(void)
+{
+    static Utils_InternPool pool(4096);
+    return pool;
+}
+
+/**
+ * @fn  uint32_t Utils_InternPool::HashBytes(std::string_view str)
+ *
+ * @brief   8 字节一组 乘法混合, 结尾不足 8 字节的部分补 0
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ *
+ * @param   str The string
+ *
+ * @return  哈希值
+ */
+uint32_t Utils_InternPool::HashBytes(std::string_view str)
+{
+    const uint64_t kMul = 0x9E3779B97F4A7C15ull;
+    const char *p = str.data();
+    size_t n = str.size();
+    uint64_t h = n * kMul;
+    while (n >= 8)
+    {
+        uint64_t w;
+        memcpy(&w, p, 8);
+        h = (h ^ w) * kMul;
+        h ^= h >> 29;
+        p += 8;
+        n -= 8;
+    }
+    if (n > 0)
+    {
+        uint64_t w = 0;
+        memcpy(&w, p, n);
+        h = (h ^ w) * kMul;
+        h ^= h >> 29;
+    }
+    h *= kMul;
+    return static_cast<uint32_t>(h >> 32);
+}
+
+Utils_InternPool::Table *Utils_InternPool::NewTable(size_t slots)
+{
+    std::unique_ptr<Table> table(new Table);
+    table->mask = static_cast<uint32_t>(slots - 1);
+    table->slots.reset(new std::atomic<uint32_t>[slots]);
+    for (size_t i = 0; i < slots; i++)
+        table->slots[i].store(0, std::memory_order_relaxed);
+    tables_.push_back(std::move(table));
+    return tables_.back().get();
+}
+
+bool Utils_InternPool::FindIn(const Table * table, std::string_view str, uint32_t hash, uint32_t & id) const
+{
+    for (uint32_t i = hash & table->mask;; i = (i + 1) & table->mask)
+    {
+        uint32_t v = table->slots[i].load(std::memory_order_acquire);
+        if (v == 0)
+            return false;
+        const Entry &e = EntryAt(v - 1);
+        if (e.hash == hash && e.len == str.size() && (str.empty() || memcmp(e.data, str.data(), str.size()) == 0))
+        {
+            id = v - 1;
+            return true;
+        }
+    }
+}
+
+void Utils_InternPool::Insert(Table * table, uint32_t id, uint32_t hash)
+{
+    uint32_t i = hash & table->mask;
+    while (table->slots[i].load(std::memory_order_relaxed) != 0)
+        i = (i + 1) & table->mask;
+    table->slots[i].store(id + 1, std::memory_order_release);
+}
+
+bool Utils_InternPool::Find(std::string_view str, uint32_t & id) const
+{
+    return FindIn(table_.load(std::memory_order_acquire), str, HashBytes(str), id);
+}
+
+std::string_view Utils_InternPool::View(uint32_t id) const
+{
+    if (id >= count_.load(std::memory_order_acquire))
+        return std::string_view();
+    const Entry &e = EntryAt(id);
+    return std::string_view(e.data, e.len);
+}
+
+/**
+ * @fn  uint32_t Utils_InternPool::Intern(std::string_view str)
+ *
+ * @brief   先无锁查找, 未命中时加锁 再查一次当前表 (可能已被其他线程插入 或者表已扩容), 然后插入
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ *
+ * @param   str The string
+ *
+ * @return  句柄
+ */
+uint32_t Utils_InternPool::Intern(std::string_view str)
+{
+    uint32_t hash = HashBytes(str);
+    uint32_t id;
+    if (FindIn(table_.load(std::memory_order_acquire), str, hash, id))
+        return id;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    Table *table = table_.load(std::memory_order_relaxed);
+    if (FindIn(table, str, hash, id))
+        return id;
+
+    id = count_.load(std::memory_order_relaxed);
+    if (id >= kMaxChunks * kChunkSize || str.size() > 0xFFFFFFFFu)
+        return kInvalid;
+
+    // 1. 条目和内容
+    Entry *chunk = chunks_[id >> kChunkBits].load(std::memory_order_relaxed);
+    if (chunk == nullptr)
+    {
+        chunk = new Entry[kChunkSize];
+        chunks_[id >> kChunkBits].store(chunk, std::memory_order_release);
+    }
+    char *mem = static_cast<char *>(arena_.Allocate(str.size() + 1, 1));
+    if (!str.empty())
+        memcpy(mem, str.data(), str.size());
+    mem[str.size()] = '\0';
+    Entry &e = chunk[id & (kChunkSize - 1)];
+    e.data = mem;
+    e.len = static_cast<uint32_t>(str.size());
+    e.hash = hash;
+    count_.store(id + 1, std::memory_order_release);
+
+    // 2. 负载超过 1/2 时扩容  新表填满后再替换, 旧表留给正在读的线程
+    if (static_cast<size_t>(id + 1) * 2 > static_cast<size_t>(table->mask) + 1)
+    {
+        Table *bigger = NewTable((static_cast<size_t>(table->mask) + 1) * 2);
+        for (uint32_t i = 0; i < id; i++)
+            Insert(bigger, i, EntryAt(i).hash);
+        table_.store(bigger, std::memory_order_release);
+        table = bigger;
+    }
+
+    // 3. 发布槽位
+    Insert(table, id, hash);
+    return id;
+}
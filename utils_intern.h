@@ -0,0 +1,211 @@
+/**
+ * @file    Code\utils\utils_intern.h.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   字符串驻留池  相同内容的字符串只保存一份, 用 32 位句柄表示
+ *          * 句柄比较 和 哈希都是 O(1), string_view 在池的生命周期内一直有效
+ *          * 查找命中时不加锁 (原子槽位 + 分块的条目数组), 只有插入新字符串时加锁
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#pragma once
+#ifndef UTILS_INTERN_H_
+#define UTILS_INTERN_H_
+
+#include <stdint.h>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "./utils_builder.h"
+
+/**
+ * @class   Utils_InternPool utils_intern.h Code\utils\utils_intern.h
+ *
+ * @brief   线程安全的字符串驻留池  句柄 0 固定为空字符串
+ *          * 哈希表为开放寻址的原子槽位数组, 扩容时整体复制后原子替换, 旧表保留到析构, 保证并发读不失效
+ *          * 条目按 4096 个一块分配, 块地址不再移动, 字符串内容保存在 Utils_Arena 中 以 \0 结尾
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+class Utils_InternPool
+{
+    public:
+
+    /**
+     * @brief   池满时 Intern 返回的无效句柄
+     */
+    static constexpr uint32_t kInvalid = 0xFFFFFFFFu;
+
+    /**
+     * @fn  explicit Utils_InternPool::Utils_InternPool(size_t capacity = 1024);
+     *
+     * @brief   构造  capacity 为预计的字符串个数
+     *
+     * @param   capacity    (Optional) 预计的字符串个数
+     */
+    explicit Utils_InternPool(size_t capacity = 1024);
+    ~Utils_InternPool();
+
+    Utils_InternPool(const Utils_InternPool &) = delete;
+    Utils_InternPool &operator=(const Utils_InternPool &) = delete;
+
+    /**
+     * @fn  uint32_t Utils_InternPool::Intern(std::string_view str);
+     *
+     * @brief   驻留字符串 返回句柄  已存在时无锁返回
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param   str The string
+     *
+     * @return  句柄, 池满时返回 kInvalid
+     */
+    uint32_t Intern(std::string_view str);
+
+    /**
+     * @fn  bool Utils_InternPool::Find(std::string_view str, uint32_t &id) const;
+     *
+     * @brief   只查找 不插入, 无锁
+     *
+     * @param           str The string
+     * @param [in,out]  id  找到时的句柄
+     *
+     * @return  True if found, false if not
+     */
+    bool Find(std::string_view str, uint32_t &id) const;
+
+    /**
+     * @fn  std::string_view Utils_InternPool::View(uint32_t id) const;
+     *
+     * @brief   句柄对应的字符串  data() 以 \0 结尾, 无效句柄返回空
+     *
+     * @param   id  The identifier
+     *
+     * @return  A std::string_view
+     */
+    std::string_view View(uint32_t id) const;
+
+    /**
+     * @fn  size_t Utils_InternPool::Size(void) const
+     *
+     * @brief   驻留的字符串个数 (含空字符串)
+     */
+    size_t Size(void) const
+    {
+        return count_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @fn  static uint32_t Utils_InternPool::HashBytes(std::string_view str);
+     *
+     * @brief   池内部使用的字符串哈希  每次处理 8 字节
+     *
+     * @param   str The string
+     *
+     * @return  哈希值
+     */
+    static uint32_t HashBytes(std::string_view str);
+
+    /**
+     * @fn  static Utils_InternPool &Utils_InternPool::Global(void);
+     *
+     * @brief   全局驻留池 Utils_Interned 使用
+     *
+     * @return  A reference to an Utils_InternPool
+     */
+    static Utils_InternPool &Global(void);
+
+    private:
+
+    struct Entry
+    {
+        const char *data;
+        uint32_t len;
+        uint32_t hash;
+    };
+
+    struct Table
+    {
+        uint32_t mask;
+        std::unique_ptr<std::atomic<uint32_t>[]> slots;    ///< 句柄 + 1, 0 表示空
+    };
+
+    static constexpr uint32_t kChunkBits = 12;
+    static constexpr uint32_t kChunkSize = 1u << kChunkBits;
+    static constexpr uint32_t kMaxChunks = 1u << 14;
+
+    const Entry &EntryAt(uint32_t id) const
+    {
+        return chunks_[id >> kChunkBits].load(std::memory_order_acquire)[id & (kChunkSize - 1)];
+    }
+
+    bool FindIn(const Table *table, std::string_view str, uint32_t hash, uint32_t &id) const;
+    void Insert(Table *table, uint32_t id, uint32_t hash);
+    Table *NewTable(size_t slots);
+
+    std::atomic<Table *> table_;
+    std::unique_ptr<std::atomic<Entry *>[]> chunks_;
+    std::atomic<uint32_t> count_;
+
+    std::mutex mutex_;                              ///< 保护以下成员 以及插入过程
+    std::vector<std::unique_ptr<Table>> tables_;    ///< 当前表 以及已经替换掉的旧表
+    Utils_Arena arena_;                             ///< 字符串内容
+};
+
+/**
+ * @struct  Utils_Interned
+ *
+ * @brief   全局驻留池中的字符串句柄  4 字节, 按值传递, 比较和哈希只看句柄
+ *          * std::unordered_map<Utils_Interned, int, Utils_Interned::Hash>
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+struct Utils_Interned
+{
+    uint32_t id = 0;    ///< 0 为空字符串
+
+    Utils_Interned() = default;
+    explicit Utils_Interned(std::string_view str) : id(Utils_InternPool::Global().Intern(str)) {}
+
+    std::string_view view(void) const
+    {
+        return Utils_InternPool::Global().View(id);
+    }
+
+    // 无效句柄 (池满) 返回 "", 不返回 nullptr
+    const char *c_str(void) const
+    {
+        const char *data = view().data();
+        return data != nullptr ? data : "";
+    }
+
+    std::string str(void) const
+    {
+        return std::string(view());
+    }
+
+    bool empty(void) const
+    {
+        return id == 0;
+    }
+
+    friend bool operator==(Utils_Interned a, Utils_Interned b) { return a.id == b.id; }
+    friend bool operator!=(Utils_Interned a, Utils_Interned b) { return a.id != b.id; }
+
+    struct Hash
+    {
+        size_t operator()(Utils_Interned s) const
+        {
+            return static_cast<size_t>(s.id) * 0x9E3779B97F4A7C15ull;
+        }
+    };
+};
+
+#endif  // UTILS_INTERN_H_
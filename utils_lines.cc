@@ -0,0 +1,292 @@
+/**
+ * @file    Code\utils\utils_lines.cc.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   按行处理的实现
+ *          * 换行查找: 32 字节比较得到位图, 逐个取最低位; 不足 32 字节的结尾逐字节
+ *          * 行计数: 比较结果 (0 / -1) 累加到字节计数器, 最多 255 次后用 sad 汇总, 不需要 popcnt
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#include "./utils_lines.h"
+
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define UTILS_LINES_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define UTILS_LINES_SSE2 1
+#endif
+
+namespace
+{
+
+constexpr size_t kBlock = 32;
+
+// 32 字节中 '\n' 的位置
+inline uint32_t NewlineMask(const char *p)
+{
+#if defined(UTILS_LINES_AVX2)
+    const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+    return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n'))));
+#elif defined(UTILS_LINES_SSE2)
+    const __m128i nl = _mm_set1_epi8('\n');
+    const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+    const __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 16));
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(lo, nl))) |
+        (static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(hi, nl))) << 16);
+#else
+    uint32_t mask = 0;
+    for (size_t i = 0; i < kBlock; i++)
+        mask |= static_cast<uint32_t>(p[i] == '\n') << i;
+    return mask;
+#endif
+}
+
+inline uint32_t NewlineMaskTail(const char *p, size_t n)
+{
+    uint32_t mask = 0;
+    for (size_t i = 0; i < n; i++)
+        mask |= static_cast<uint32_t>(p[i] == '\n') << i;
+    return mask;
+}
+
+size_t CountNewlines(const char *p, size_t n)
+{
+    size_t count = 0;
+    size_t i = 0;
+#if defined(UTILS_LINES_AVX2)
+    const __m256i nl = _mm256_set1_epi8('\n');
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i total = zero;
+    while (n - i >= kBlock)
+    {
+        // 每个字节最多累加 255 次
+        const size_t rounds = std::min<size_t>((n - i) / kBlock, 255);
+        __m256i acc = zero;
+        for (size_t r = 0; r < rounds; r++, i += kBlock)
+        {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i));
+            acc = _mm256_sub_epi8(acc, _mm256_cmpeq_epi8(v, nl));
+        }
+        total = _mm256_add_epi64(total, _mm256_sad_epu8(acc, zero));
+    }
+    alignas(32) uint64_t lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), total);
+    count = static_cast<size_t>(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+#elif defined(UTILS_LINES_SSE2)
+    const __m128i nl = _mm_set1_epi8('\n');
+    const __m128i zero = _mm_setzero_si128();
+    __m128i total = zero;
+    while (n - i >= 16)
+    {
+        const size_t rounds = std::min<size_t>((n - i) / 16, 255);
+        __m128i acc = zero;
+        for (size_t r = 0; r < rounds; r++, i += 16)
+        {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i));
+            acc = _mm_sub_epi8(acc, _mm_cmpeq_epi8(v, nl));
+        }
+        total = _mm_add_epi64(total, _mm_sad_epu8(acc, zero));
+    }
+    alignas(16) uint64_t lanes[2];
+    _mm_store_si128(reinterpret_cast<__m128i *>(lanes), total);
+    count = static_cast<size_t>(lanes[0] + lanes[1]);
+#endif
+    for (; i < n; i++)
+        count += p[i] == '\n';
+    return count;
+}
+
+int ThreadCount(int threads, size_t size, size_t min_chunk)
+{
+    if (threads <= 0)
+        threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    return static_cast<int>(std::min<size_t>(static_cast<size_t>(threads), size / min_chunk + 1));
+}
+
+template<typename Job>
+void RunWorkers(int n, Job &&job)
+{
+    std::vector<std::thread> workers;
+    for (int i = 1; i < n; i++)
+        workers.emplace_back(job, i);
+    job(0);
+    for (std::thread &w : workers)
+        w.join();
+}
+
+}  // namespace
+
+void Utils_LineReader::Reset(std::string_view data)
+{
+    data_ = data.data();
+    size_ = data.size();
+    pos_ = 0;
+    next_ = 0;
+    block_ = 0;
+    bits_ = 0;
+    lines_ = 0;
+}
+
+bool Utils_LineReader::Open(const std::string & file)
+{
+    Close();
+    if (!file_.Open(file))
+        return false;
+    file_.AdviseSequential();
+    Reset(file_.view());
+    return true;
+}
+
+void Utils_LineReader::Close(void)
+{
+    file_.Close();
+    Reset(std::string_view());
+}
+
+// 下一个换行的偏移  没有时返回 size_
+size_t Utils_LineReader::NextNewline(void)
+{
+    while (bits_ == 0)
+    {
+        if (next_ >= size_)
+            return size_;
+        block_ = next_;
+        const size_t n = size_ - block_;
+        bits_ = n >= kBlock ? NewlineMask(data_ + block_) : NewlineMaskTail(data_ + block_, n);
+        next_ += kBlock;
+    }
+    const size_t nl = block_ + static_cast<size_t>(Utils_Detail::LowestBit(bits_));
+    bits_ &= bits_ - 1;
+    return nl;
+}
+
+bool Utils_LineReader::Next(std::string_view & line)
+{
+    if (pos_ >= size_)
+        return false;
+    const size_t nl = NextNewline();
+    size_t end = nl;
+    if (end > pos_ && data_[end - 1] == '\r')
+        end--;
+    line = std::string_view(data_ + pos_, end - pos_);
+    pos_ = nl + 1;
+    lines_++;
+    return true;
+}
+
+const char *Utils_Lines::FindNewline(const char * p, const char * end)
+{
+    while (end - p >= static_cast<std::ptrdiff_t>(kBlock))
+    {
+        const uint32_t mask = NewlineMask(p);
+        if (mask != 0)
+            return p + Utils_Detail::LowestBit(mask);
+        p += kBlock;
+    }
+    const void *nl = p < end ? memchr(p, '\n', static_cast<size_t>(end - p)) : nullptr;
+    return nl != nullptr ? static_cast<const char *>(nl) : end;
+}
+
+size_t Utils_Lines::Count(std::string_view data, int threads)
+{
+    if (data.empty())
+        return 0;
+    const int n = ThreadCount(threads, data.size(), size_t(4) << 20);
+    size_t count = 0;
+    if (n <= 1)
+    {
+        count = CountNewlines(data.data(), data.size());
+    }
+    else
+    {
+        std::vector<size_t> parts(static_cast<size_t>(n), 0);
+        const size_t chunk = data.size() / static_cast<size_t>(n);
+        RunWorkers(n, [&](int i) {
+            const size_t begin = chunk * static_cast<size_t>(i);
+            const size_t end = i + 1 == n ? data.size() : begin + chunk;
+            parts[static_cast<size_t>(i)] = CountNewlines(data.data() + begin, end - begin);
+        });
+        for (size_t c : parts)
+            count += c;
+    }
+    return count + (data.back() != '\n');
+}
+
+bool Utils_Lines::Open(const std::string & file, Utils_MappedFile & map)
+{
+    if (!map.Open(file))
+        return false;
+    map.AdviseSequential();
+    return true;
+}
+
+bool Utils_Lines::CountLines(const std::string & file, size_t & lines, int threads)
+{
+    Utils_MappedFile map;
+    if (!Open(file, map))
+        return false;
+    lines = Count(map.view(), threads);
+    return true;
+}
+
+/**
+ * @fn  size_t Utils_Lines::ForEach(std::string_view data, LineFn fn, void *ctx, int threads)
+ *
+ * @brief   按字节均分, 第 i 块的起点移到 bound[i] - 1 之后的第一个换行之后 (bound[i] 恰好是行首时不移动)
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ *
+ * @param           data    The data
+ * @param           fn      行回调
+ * @param [in,out]  ctx     回调上下文
+ * @param           threads 线程数 小于等于 0 时使用 CPU 核数
+ *
+ * @return  回调的次数
+ */
+size_t Utils_Lines::ForEach(std::string_view data, LineFn fn, void * ctx, int threads)
+{
+    if (fn == nullptr || data.empty())
+        return 0;
+    const int n = ThreadCount(threads, data.size(), size_t(1) << 20);
+    const char *base = data.data();
+    const char *end = base + data.size();
+
+    std::vector<size_t> start(static_cast<size_t>(n) + 1);
+    start[0] = 0;
+    start[static_cast<size_t>(n)] = data.size();
+    for (int i = 1; i < n; i++)
+    {
+        const size_t bound = data.size() / static_cast<size_t>(n) * static_cast<size_t>(i);
+        const char *nl = FindNewline(base + bound - 1, end);
+        start[static_cast<size_t>(i)] = std::max(static_cast<size_t>((nl < end ? nl + 1 : end) - base), start[static_cast<size_t>(i) - 1]);
+    }
+
+    std::vector<size_t> counts(static_cast<size_t>(n), 0);
+    std::atomic<bool> stop(false);
+    RunWorkers(n, [&](int i) {
+        const size_t begin = start[static_cast<size_t>(i)];
+        Utils_LineReader reader(data.substr(begin, start[static_cast<size_t>(i) + 1] - begin));
+        size_t count = 0;
+        for (std::string_view line; !stop.load(std::memory_order_relaxed) && reader.Next(line);)
+        {
+            count++;
+            if (!fn(ctx, line, i))
+                stop.store(true, std::memory_order_relaxed);
+        }
+        counts[static_cast<size_t>(i)] = count;
+    });
+
+    size_t total = 0;
+    for (size_t c : counts)
+        total += c;
+    return total;
+}
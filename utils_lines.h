@@ -0,0 +1,186 @@
+/**
+ * @file    Code\utils\utils_lines.h.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   大文本文件按行处理  代替 fstream + std::getline 逐行读取
+ *          * 文件内存映射, 每次比较 32 字节 (AVX2, 否则两次 SSE2) 得到换行位置的位图, 一个位图可以给出多行
+ *          * 行以 std::string_view 给出, 不拷贝; 行尾的 "\r" 去掉
+ *          * 多线程时文件按字节均分, 各块起点移到换行之后, 每个线程处理一段连续的行
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#pragma once
+#ifndef UTILS_LINES_H_
+#define UTILS_LINES_H_
+
+#include <stdint.h>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "./utils_mmap.h"
+#include "./utils_detail.h"
+
+/**
+ * @class   Utils_LineReader utils_lines.h Code\utils\utils_lines.h
+ *
+ * @brief   顺序读取行  与 std::getline 的划分相同: "a\nb\n" 和 "a\nb" 都是两行, 空数据没有行
+ *          *   Utils_LineReader reader;
+ *          *   reader.Open("run.log");
+ *          *   for (std::string_view line; reader.Next(line);) ...
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+class Utils_LineReader
+{
+    public:
+
+    Utils_LineReader() = default;
+
+    /**
+     * @fn  explicit Utils_LineReader::Utils_LineReader(std::string_view data)
+     *
+     * @brief   读取已有的内存  不拷贝, 调用者保证读取期间有效
+     */
+    explicit Utils_LineReader(std::string_view data)
+    {
+        Reset(data);
+    }
+
+    /**
+     * @fn  bool Utils_LineReader::Open(const std::string &file);
+     *
+     * @brief   映射文件并提示顺序读取
+     */
+    bool Open(const std::string &file);
+
+    void Close(void);
+
+    /**
+     * @fn  bool Utils_LineReader::Next(std::string_view &line);
+     *
+     * @brief   下一行 不含 "\n" 和 "\r"  返回的视图在 Close 之前有效
+     *
+     * @return  false 没有更多的行
+     */
+    bool Next(std::string_view &line);
+
+    /**
+     * @fn  size_t Utils_LineReader::LineNumber(void) const
+     *
+     * @brief   已经读取的行数
+     */
+    size_t LineNumber(void) const
+    {
+        return lines_;
+    }
+
+    std::string_view view(void) const
+    {
+        return std::string_view(data_, size_);
+    }
+
+    private:
+
+    void Reset(std::string_view data);
+    size_t NextNewline(void);
+
+    Utils_MappedFile file_;
+    const char *data_ = nullptr;
+    size_t size_ = 0;
+    size_t pos_ = 0;        ///< 下一行的起点
+    size_t next_ = 0;       ///< 下一个要比较的块
+    size_t block_ = 0;      ///< bits_ 对应的块
+    uint32_t bits_ = 0;     ///< block_ 中还没有用到的换行位置
+    size_t lines_ = 0;
+};
+
+/**
+ * @class   Utils_Lines utils_lines.h Code\utils\utils_lines.h
+ *
+ * @brief   行查找 行计数 多线程按行处理
+ *          *   Utils_Lines::ForEachLine("run.log", [&](std::string_view line, int worker) { ... }, 0);
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+class Utils_Lines
+{
+    public:
+
+    /**
+     * @brief   行回调  返回 false 停止; 多线程时被同时调用, worker 为线程序号
+     */
+    typedef bool (*LineFn)(void *ctx, std::string_view line, int worker);
+
+    /**
+     * @fn  static const char *Utils_Lines::FindNewline(const char *p, const char *end);
+     *
+     * @brief   [p, end) 中第一个 '\n'  没有时返回 end
+     */
+    static const char *FindNewline(const char *p, const char *end);
+
+    /**
+     * @fn  static size_t Utils_Lines::Count(std::string_view data, int threads = 1);
+     *
+     * @brief   行数  换行个数, 最后一行没有换行时加 1
+     *
+     * @param   data    The data
+     * @param   threads 线程数 小于等于 0 时使用 CPU 核数, 数据小于 4MB 时单线程
+     */
+    static size_t Count(std::string_view data, int threads = 1);
+
+    /**
+     * @fn  static bool Utils_Lines::CountLines(const std::string &file, size_t &lines, int threads = 0);
+     *
+     * @brief   文件的行数
+     *
+     * @return  false 文件无法打开
+     */
+    static bool CountLines(const std::string &file, size_t &lines, int threads = 0);
+
+    /**
+     * @fn  static size_t Utils_Lines::ForEach(std::string_view data, LineFn fn, void *ctx, int threads);
+     *
+     * @brief   对每一行调用 fn  第 i 个线程的行都在第 i+1 个之前, 同一个线程内按顺序; 数据小于 1MB 时单线程
+     *
+     * @return  回调的次数
+     */
+    static size_t ForEach(std::string_view data, LineFn fn, void *ctx, int threads);
+
+    /**
+     * @fn  template<typename Fn> static size_t Utils_Lines::ForEach(std::string_view data, Fn &&fn, int threads = 1)
+     *
+     * @brief   fn(std::string_view) 或 fn(std::string_view, int worker), 返回 void 或 bool; 多线程时需要线程安全
+     */
+    template<typename Fn>
+    static size_t ForEach(std::string_view data, Fn &&fn, int threads = 1)
+    {
+        return ForEach(data, &Utils_Detail::Invoke<std::remove_reference_t<Fn>, std::string_view>, const_cast<void *>(static_cast<const void *>(&fn)), threads);
+    }
+
+    /**
+     * @fn  template<typename Fn> static bool Utils_Lines::ForEachLine(const std::string &file, Fn &&fn, int threads = 0)
+     *
+     * @brief   映射文件 并多线程处理每一行
+     *
+     * @return  false 文件无法打开
+     */
+    template<typename Fn>
+    static bool ForEachLine(const std::string &file, Fn &&fn, int threads = 0)
+    {
+        Utils_MappedFile map;
+        if (!Open(file, map))
+            return false;
+        ForEach(map.view(), std::forward<Fn>(fn), threads);
+        return true;
+    }
+
+    private:
+
+    static bool Open(const std::string &file, Utils_MappedFile &map);
+};
+
+#endif  // UTILS_LINES_H_
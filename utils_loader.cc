@@ -0,0 +1,286 @@
+/**
+ * @file    Code\utils\utils_loader.cc.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   多线程图片加载的实现
+ *          * 每个解码线程一个读文件缓冲区, 整个文件读入后 cv::imdecode 到池中取出的 cv::Mat
+ *          * 取到第 i 个文件的线程 预读第 i + prefetch 个文件, 每个文件只预读一次
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#include "./utils_loader.h"
+#include "./utils_walker.h"
+
+#include <stdio.h>
+#include <algorithm>
+#include <climits>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#endif
+
+namespace
+{
+
+bool ReadFile(const std::string &path, std::vector<uchar> &buf)
+{
+#ifdef _WIN32
+    FILE *fp = fopen(path.c_str(), "rb");
+    if (fp == nullptr)
+        return false;
+    bool ok = _fseeki64(fp, 0, SEEK_END) == 0;
+    const long long size = ok ? _ftelli64(fp) : -1;
+    ok = size >= 0 && size <= INT_MAX && _fseeki64(fp, 0, SEEK_SET) == 0;
+    if (ok)
+    {
+        buf.resize(static_cast<size_t>(size));
+        ok = fread(buf.data(), 1, buf.size(), fp) == buf.size();
+    }
+    fclose(fp);
+    return ok;
+#else
+    const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        return false;
+    struct stat st;
+    bool ok = fstat(fd, &st) == 0 && st.st_size <= INT_MAX;
+    if (ok)
+    {
+        buf.resize(static_cast<size_t>(st.st_size));
+        size_t done = 0;
+        while (done < buf.size())
+        {
+            const ssize_t n = read(fd, buf.data() + done, buf.size() - done);
+            if (n <= 0)
+                break;
+            done += static_cast<size_t>(n);
+        }
+        ok = done == buf.size();
+    }
+    close(fd);
+    return ok;
+#endif
+}
+
+}  // namespace
+
+Utils_ImageLoader::~Utils_ImageLoader()
+{
+    Stop();
+}
+
+bool Utils_ImageLoader::Start(std::vector<std::string> files, const Options & opt)
+{
+    Stop();
+    files_ = std::move(files);
+    opt_ = opt;
+    opt_.read_ahead = std::max<size_t>(opt_.read_ahead, 1);
+    const int hw = static_cast<int>(std::thread::hardware_concurrency());
+    int threads = opt_.threads > 0 ? opt_.threads : std::max(hw, 1);
+    threads = static_cast<int>(std::min<size_t>(static_cast<size_t>(threads), std::max<size_t>(files_.size(), 1)));
+
+    claim_.store(0);
+    failed_.store(0);
+    stop_.store(false);
+    next_out_ = 0;
+    {
+        std::lock_guard<std::mutex> lock(pool_mutex_);
+        pool_limit_ = opt_.read_ahead + static_cast<size_t>(threads);
+    }
+    if (files_.empty())
+        return false;
+
+    if (opt_.ordered)
+    {
+        slots_.assign(opt_.read_ahead, Item());
+        ready_.assign(opt_.read_ahead, 0);
+    }
+    else
+    {
+        channel_.reset(new Utils_BoundedChannel<Item>(opt_.read_ahead));
+    }
+    active_.store(threads);
+    for (int i = 0; i < threads; i++)
+        threads_.emplace_back(opt_.ordered ? &Utils_ImageLoader::RunOrdered : &Utils_ImageLoader::RunUnordered, this);
+    return true;
+}
+
+bool Utils_ImageLoader::StartDir(const std::string & dir, const std::vector<std::string> & exts, const Options & opt)
+{
+    return Start(ListImages(dir, exts), opt);
+}
+
+std::vector<std::string> Utils_ImageLoader::ListImages(const std::string & dir, const std::vector<std::string> & exts)
+{
+    static const std::vector<std::string> images = { ".jpg", ".jpeg", ".png", ".bmp", ".tif", ".tiff" };
+    // 扩展名由 Utils_Walker 按 Utils_Path::HasExtension 过滤  ".png" 或 "png" 都可以
+    Utils_Walker::Options opt;
+    opt.extensions = exts.empty() ? images : exts;
+    std::vector<std::string> files = Utils_Walker::List(dir, opt);
+    std::sort(files.begin(), files.end());
+    return files;
+}
+
+void Utils_ImageLoader::Stop(void)
+{
+    stop_.store(true);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+    }
+    claim_cv_.notify_all();
+    ready_cv_.notify_all();
+    if (channel_)
+        channel_->Close();
+    for (auto &t : threads_)
+        t.join();
+    threads_.clear();
+    channel_.reset();
+    slots_.clear();
+    ready_.clear();
+}
+
+bool Utils_ImageLoader::Next(Item & item)
+{
+    if (channel_)
+        return channel_->Pop(item);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (slots_.empty() || next_out_ >= files_.size())
+        return false;
+    const size_t slot = next_out_ % slots_.size();
+    ready_cv_.wait(lock, [&]() { return ready_[slot] != 0 || stop_.load(); });
+    if (ready_[slot] == 0)
+        return false;
+    item = std::move(slots_[slot]);
+    ready_[slot] = 0;
+    next_out_++;
+    lock.unlock();
+    claim_cv_.notify_all();
+    return true;
+}
+
+void Utils_ImageLoader::Recycle(Item & item)
+{
+    // 只有这一个 cv::Mat 引用数据时才能复用, 否则调用者保留的副本会被下一张图片覆盖
+    if (!item.image.empty() && item.image.u != nullptr && item.image.u->refcount == 1)
+        GiveMat(std::move(item.image));
+    item.image = cv::Mat();
+    item.ok = false;
+}
+
+cv::Mat Utils_ImageLoader::TakeMat(void)
+{
+    std::lock_guard<std::mutex> lock(pool_mutex_);
+    if (pool_.empty())
+        return cv::Mat();
+    cv::Mat mat = std::move(pool_.back());
+    pool_.pop_back();
+    return mat;
+}
+
+void Utils_ImageLoader::GiveMat(cv::Mat && mat)
+{
+    std::lock_guard<std::mutex> lock(pool_mutex_);
+    if (pool_.size() < pool_limit_)
+        pool_.push_back(std::move(mat));
+}
+
+void Utils_ImageLoader::Prefetch(size_t index) const
+{
+#if !defined(_WIN32) && defined(POSIX_FADV_WILLNEED)
+    if (index >= files_.size())
+        return;
+    const int fd = open(files_[index].c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        return;
+    // 异步预读到系统缓存, 不等待
+    posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+    close(fd);
+#else
+    (void)index;
+#endif
+}
+
+void Utils_ImageLoader::Load(size_t index, std::vector<uchar> & buf, Item & item)
+{
+    item.index = index;
+    item.ok = false;
+    item.image = TakeMat();
+    if (ReadFile(files_[index], buf) && !buf.empty())
+    {
+        try
+        {
+            // 传入 dst 时尺寸和类型相同的图片直接解码到已有的内存
+            const cv::Mat encoded(1, static_cast<int>(buf.size()), CV_8UC1, buf.data());
+            item.ok = !cv::imdecode(encoded, opt_.flags, &item.image).empty();
+        }
+        catch (const cv::Exception &)
+        {
+            item.ok = false;
+        }
+    }
+    if (!item.ok)
+    {
+        if (!item.image.empty())
+            GiveMat(std::move(item.image));
+        item.image = cv::Mat();
+        failed_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void Utils_ImageLoader::RunOrdered(void)
+{
+    std::vector<uchar> buf;
+    const size_t n = files_.size();
+    const size_t window = slots_.size();
+    for (;;)
+    {
+        size_t index;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            claim_cv_.wait(lock, [&]() {
+                return stop_.load() || claim_.load() >= n || claim_.load() < next_out_ + window;
+            });
+            index = claim_.load();
+            if (stop_.load() || index >= n)
+                break;
+            claim_.store(index + 1);
+        }
+        if (opt_.prefetch > 0)
+            Prefetch(index + opt_.prefetch);
+
+        Item item;
+        Load(index, buf, item);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            slots_[index % window] = std::move(item);
+            ready_[index % window] = 1;
+        }
+        ready_cv_.notify_one();
+    }
+    active_.fetch_sub(1);
+}
+
+void Utils_ImageLoader::RunUnordered(void)
+{
+    std::vector<uchar> buf;
+    const size_t n = files_.size();
+    for (;;)
+    {
+        const size_t index = claim_.fetch_add(1);
+        if (index >= n || stop_.load(std::memory_order_relaxed))
+            break;
+        if (opt_.prefetch > 0)
+            Prefetch(index + opt_.prefetch);
+
+        Item item;
+        Load(index, buf, item);
+        if (!channel_->Push(std::move(item)))
+            break;
+    }
+    // 最后一个线程结束后关闭通道, Next 取完剩余的图片后返回 false
+    if (active_.fetch_sub(1) == 1)
+        channel_->Close();
+}
@@ -0,0 +1,189 @@
+/**
+ * @file    Code\utils\utils_loader.h.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   多线程预读图片加载  代替 ListAllFiles 之后逐个 cv::imread
+ *          * N 个线程 读文件 + cv::imdecode, 解码完成但还没有取走的图片最多 read_ahead 张 (有界)
+ *          * ordered 时按文件列表顺序输出, 否则按完成顺序输出
+ *          * 解码线程提前 prefetch 个文件 posix_fadvise(WILLNEED), 读文件时数据已经在系统缓存中
+ *          * 解码的 cv::Mat 来自可复用的池, Recycle 之后下一张同尺寸的图片不再分配内存
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#pragma once
+#ifndef UTILS_LOADER_H_
+#define UTILS_LOADER_H_
+
+#include <stddef.h>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "opencv2/core.hpp"
+#include "opencv2/imgcodecs.hpp"
+
+#include "./utils_concurrent.h"
+
+/**
+ * @class   Utils_ImageLoader utils_loader.h Code\utils\utils_loader.h
+ *
+ * @brief   图片加载器  Next 只能在一个线程中调用
+ *          *   Utils_ImageLoader loader;
+ *          *   loader.StartDir("dataset", {});
+ *          *   for (Utils_ImageLoader::Item item; loader.Next(item);)
+ *          *   {
+ *          *       if (item.ok) Process(loader.Path(item.index), item.image);
+ *          *       loader.Recycle(item);
+ *          *   }
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+class Utils_ImageLoader
+{
+    public:
+
+    struct Options
+    {
+        int threads = 0;                    ///< 解码线程数 小于等于 0 时使用 CPU 核数
+        size_t read_ahead = 32;             ///< 解码完成但还没有取走的最多图片数
+        bool ordered = true;                ///< 按文件列表顺序输出
+        size_t prefetch = 64;               ///< 提前预读的文件数, 0 不预读
+        int flags = cv::IMREAD_COLOR;       ///< cv::imdecode 的 flags
+    };
+
+    /**
+     * @struct  Item
+     *
+     * @brief   一张图片  ok 为 false 时读取 或 解码失败, image 为空
+     */
+    struct Item
+    {
+        size_t index = 0;                   ///< 在文件列表中的位置
+        cv::Mat image;
+        bool ok = false;
+    };
+
+    Utils_ImageLoader() = default;
+    ~Utils_ImageLoader();
+
+    Utils_ImageLoader(const Utils_ImageLoader &) = delete;
+    Utils_ImageLoader &operator=(const Utils_ImageLoader &) = delete;
+
+    /**
+     * @fn  bool Utils_ImageLoader::Start(std::vector<std::string> files, const Options &opt);
+     *
+     * @brief   开始加载文件列表  正在加载的先 Stop
+     *
+     * @return  false 文件列表为空
+     */
+    bool Start(std::vector<std::string> files, const Options &opt);
+
+    bool Start(std::vector<std::string> files)
+    {
+        return Start(std::move(files), Options());
+    }
+
+    /**
+     * @fn  bool Utils_ImageLoader::StartDir(const std::string &dir, const std::vector<std::string> &exts, const Options &opt);
+     *
+     * @brief   用 Utils_Walker 多线程遍历目录, 按路径排序后加载
+     *
+     * @param   exts    扩展名 (例如 ".png", 不区分大小写), 为空时使用常见图片格式
+     */
+    bool StartDir(const std::string &dir, const std::vector<std::string> &exts, const Options &opt);
+
+    bool StartDir(const std::string &dir, const std::vector<std::string> &exts)
+    {
+        return StartDir(dir, exts, Options());
+    }
+
+    /**
+     * @fn  bool Utils_ImageLoader::Next(Item &item);
+     *
+     * @brief   取出下一张图片  等待解码完成
+     *
+     * @return  false 所有文件都已取出 或 已经 Stop
+     */
+    bool Next(Item &item);
+
+    /**
+     * @fn  void Utils_ImageLoader::Recycle(Item &item);
+     *
+     * @brief   用完的图片放回池中  图片的数据没有被其他 cv::Mat 引用时才复用, item.image 清空
+     */
+    void Recycle(Item &item);
+
+    /**
+     * @fn  void Utils_ImageLoader::Stop(void);
+     *
+     * @brief   停止解码线程  没有取出的图片丢弃
+     */
+    void Stop(void);
+
+    size_t size(void) const
+    {
+        return files_.size();
+    }
+
+    const std::string &Path(size_t index) const
+    {
+        return files_[index];
+    }
+
+    /**
+     * @fn  size_t Utils_ImageLoader::Failed(void) const
+     *
+     * @brief   读取 或 解码失败的文件数
+     */
+    size_t Failed(void) const
+    {
+        return failed_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @fn  static std::vector<std::string> Utils_ImageLoader::ListImages(const std::string &dir, const std::vector<std::string> &exts);
+     *
+     * @brief   目录下 (递归) 指定扩展名的文件, 按路径排序
+     *          * exts 为 ".png" 或 "png", 不区分大小写, 为空时为常见图像格式
+     */
+    static std::vector<std::string> ListImages(const std::string &dir, const std::vector<std::string> &exts);
+
+    private:
+
+    void RunOrdered(void);
+    void RunUnordered(void);
+    void Load(size_t index, std::vector<uchar> &buf, Item &item);
+    void Prefetch(size_t index) const;
+    cv::Mat TakeMat(void);
+    void GiveMat(cv::Mat &&mat);
+
+    std::vector<std::string> files_;
+    Options opt_;
+    std::vector<std::thread> threads_;
+    std::atomic<size_t> claim_{ 0 };        ///< 下一个要解码的文件
+    std::atomic<size_t> failed_{ 0 };
+    std::atomic<int> active_{ 0 };
+    std::atomic<bool> stop_{ false };
+
+    // ordered: 环形窗口 第 i 个文件放在 slots_[i % read_ahead]
+    std::mutex mutex_;
+    std::condition_variable claim_cv_;      ///< 窗口有空位
+    std::condition_variable ready_cv_;      ///< 下一张解码完成
+    std::vector<Item> slots_;
+    std::vector<char> ready_;
+    size_t next_out_ = 0;
+
+    // 无序: 解码线程放入通道
+    std::unique_ptr<Utils_BoundedChannel<Item>> channel_;
+
+    std::mutex pool_mutex_;
+    std::vector<cv::Mat> pool_;
+    size_t pool_limit_ = 0;
+};
+
+#endif  // UTILS_LOADER_H_
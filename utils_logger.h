@@ -89,7 +89,8 @@ static bool check_dir(const char *dir)
 #define FILENAME_ (strrchr(__FILE__, '/') ? (strrchr(__FILE__, '/') + 1) : __FILE__)
 #endif
 
-// 定义一个在日志后添加 文件名 函数名 行号 的宏定义
+// 定义一个在日志后添加 文件名 函数名 行号 的宏定义  栈上拼接 不分配内存
+#include "./utils_builder.h"
 #ifndef suffix_
 /**
  * @def suffix_(msg)
@@ -102,14 +103,15 @@ static bool check_dir(const char *dir)
  * @param   msg The message
  */
 
-#define suffix_(msg) std::string(msg)\
-                .append("  <")\
-                .append(FILENAME_)\
-                .append(":")\
-                .append(std::to_string(__LINE__))\
-                .append("> <")\
-                .append(__func__)\
-                .append(">").c_str()
+#define suffix_(msg) Utils_StringBuilder<256>()\
+                .Append(msg)\
+                .Append("  <")\
+                .Append(FILENAME_)\
+                .Append(':')\
+                .Append(__LINE__)\
+                .Append("> <")\
+                .Append(__func__)\
+                .Append('>').c_str()
 
 #if 0
 #define suffix_(msg) std::string()\
@@ -142,10 +144,13 @@ static bool check_dir(const char *dir)
 
 #define LOG2FILE_ 1
 #include <ctime>  // 引入时间 便于生成文件
+#include <algorithm>
 #include <vector>
 #include <string>
 #include <memory>
 
+#include "./utils_format.h"
+
 // spd log 参数
 #include "spdlog/spdlog.h"
 #include "spdlog/async.h"
@@ -255,8 +260,8 @@ private:
         std::string str;
 
         std::string format_ = "%04d%02d%02d-%02d%02d";
-        char *buf = new char[20];
-        sprintf(buf, format_.c_str(), \
+        char buf[32];
+        snprintf(buf, sizeof(buf), format_.c_str(), \
                 ltm.tm_year + 1900,
                 ltm.tm_mon + 1,
                 ltm.tm_mday,
@@ -390,4 +395,139 @@ private:
         }                                                                \
     } while (0)
 
+/**
+ * @class   Utils_LogSink
+ *
+ * @brief   输出到日志的 sink  按行缓冲, 每个完整的行作为一条 info 日志, 行不会被 Writer 的分块截断
+ *          * 一行超过 max_line 时在最后一个空白处断开 (没有空白时直接断开), 缓冲不超过 max_line,
+ *            CoutVector(vec, false, ...) 这样没有换行的输出也分成多条日志
+ *          * 析构时输出最后不完整的一行, 作为临时对象使用时在整个表达式结束后输出:
+ *          *   Utils_String::CoutVector(vec, false, LogSink());
+ *          * 转换得到的 Utils_Format::Sink 只在这个对象存在期间有效
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+class Utils_LogSink
+{
+    public:
+
+    static constexpr size_t kMaxLine = 4096;
+
+    /**
+     * @brief   输出一行  默认 LInfo
+     */
+    typedef void (*LineFn)(void *ctx, std::string_view line);
+
+    explicit Utils_LogSink(size_t max_line = kMaxLine, LineFn fn = nullptr, void *ctx = nullptr)
+        : max_line_(max_line > 0 ? max_line : 1), fn_(fn), ctx_(ctx)
+    {
+    }
+
+    ~Utils_LogSink()
+    {
+        Flush();
+    }
+
+    Utils_LogSink(const Utils_LogSink &) = delete;
+    Utils_LogSink &operator=(const Utils_LogSink &) = delete;
+
+    operator Utils_Format::Sink(void) const
+    {
+        Utils_Format::Sink sink;
+        sink.write = &Utils_LogSink::Write;
+        sink.ctx = const_cast<Utils_LogSink *>(this);
+        return sink;
+    }
+
+    /**
+     * @fn  void Utils_LogSink::Flush(void)
+     *
+     * @brief   输出缓冲中没有换行结尾的部分
+     */
+    void Flush(void)
+    {
+        Emit(pending_.data(), pending_.size());
+        pending_.clear();
+    }
+
+    private:
+
+    static void Write(void *ctx, const char *data, size_t len)
+    {
+        Utils_LogSink &self = *static_cast<Utils_LogSink *>(ctx);
+        const char *end = data + len;
+        for (const char *nl; (nl = static_cast<const char *>(memchr(data, '\n', end - data))) != nullptr; data = nl + 1)
+        {
+            const size_t n = static_cast<size_t>(nl - data);
+            if (self.pending_.empty() && n <= self.max_line_)
+            {
+                self.Emit(data, n);
+            }
+            else
+            {
+                self.Append(data, n);
+                self.Flush();
+            }
+        }
+        self.Append(data, static_cast<size_t>(end - data));
+    }
+
+    // 追加到缓冲  满 max_line 时输出到最后一个空白为止
+    void Append(const char *data, size_t len)
+    {
+        while (len > 0)
+        {
+            const size_t n = std::min(len, max_line_ - pending_.size());
+            pending_.append(data, n);
+            data += n;
+            len -= n;
+            if (pending_.size() < max_line_)
+                break;
+            const size_t sep = pending_.find_last_of(" \t");
+            if (sep == std::string::npos)
+            {
+                Flush();
+            }
+            else
+            {
+                Emit(pending_.data(), sep);
+                pending_.erase(0, sep + 1);
+            }
+        }
+    }
+
+    void Emit(const char *data, size_t len)
+    {
+        while (len > 0 && (data[len - 1] == '\n' || data[len - 1] == '\r'))
+            len--;
+        if (len == 0)
+            return;
+        if (fn_ != nullptr)
+            fn_(ctx_, std::string_view(data, len));
+        else
+            LInfo("{}", std::string(data, len));
+    }
+
+    size_t max_line_;
+    LineFn fn_;
+    void *ctx_;
+    std::string pending_;
+};
+
+/**
+ * @fn  inline Utils_LogSink LogSink(void)
+ *
+ * @brief   输出到日志的 sink, 例如 Utils_String::CoutVector(vec, false, LogSink())
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ *
+ * @return  A Utils_LogSink
+ */
+inline Utils_LogSink LogSink(void)
+{
+    return Utils_LogSink();
+}
+
 #endif  // SPDLOGGER_H_
@@ -0,0 +1,281 @@
+/**
+ * @file    Code\utils\utils_mmap.cc.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   只读内存映射文件的实现
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#include "./utils_mmap.h"
+
+#include <string.h>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+Utils_MappedFile::~Utils_MappedFile()
+{
+    Close();
+}
+
+Utils_MappedFile::Utils_MappedFile(Utils_MappedFile && other) noexcept
+{
+    Swap(other);
+}
+
+Utils_MappedFile &Utils_MappedFile::operator=(Utils_MappedFile && other) noexcept
+{
+    if (this != &other)
+    {
+        Close();
+        Swap(other);
+    }
+    return *this;
+}
+
+void Utils_MappedFile::Swap(Utils_MappedFile & other) noexcept
+{
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+    std::swap(open_, other.open_);
+#ifdef _WIN32
+    std::swap(file_, other.file_);
+    std::swap(mapping_, other.mapping_);
+#else
+    std::swap(fd_, other.fd_);
+#endif
+}
+
+#ifdef _WIN32
+
+bool Utils_MappedFile::Open(const std::string & file)
+{
+    Close();
+    HANDLE h = CreateFileA(file.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+                           OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (h == INVALID_HANDLE_VALUE)
+        return false;
+    LARGE_INTEGER len;
+    if (!GetFileSizeEx(h, &len))
+    {
+        CloseHandle(h);
+        return false;
+    }
+    file_ = h;
+    size_ = static_cast<size_t>(len.QuadPart);
+    open_ = true;
+    if (size_ == 0)
+        return true;
+
+    mapping_ = CreateFileMappingA(h, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping_ != nullptr)
+        data_ = static_cast<const char *>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+    if (data_ == nullptr)
+    {
+        Close();
+        return false;
+    }
+    return true;
+}
+
+void Utils_MappedFile::Close(void)
+{
+    if (data_ != nullptr)
+        UnmapViewOfFile(data_);
+    if (mapping_ != nullptr)
+        CloseHandle(mapping_);
+    if (file_ != nullptr)
+        CloseHandle(file_);
+    data_ = nullptr;
+    mapping_ = nullptr;
+    file_ = nullptr;
+    size_ = 0;
+    open_ = false;
+}
+
+void Utils_MappedFile::AdviseSequential(void) const
+{
+    // FILE_FLAG_SEQUENTIAL_SCAN 已在打开时指定
+}
+
+void Utils_MappedFile::Advise(Advice advice, size_t offset, size_t len) const
+{
+#if defined(_WIN32_WINNT) && _WIN32_WINNT >= 0x0602
+    if (advice != kWillNeed || data_ == nullptr || offset >= size_)
+        return;
+    WIN32_MEMORY_RANGE_ENTRY range;
+    range.VirtualAddress = const_cast<char *>(data_ + offset);
+    range.NumberOfBytes = len < size_ - offset ? len : size_ - offset;
+    PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+#else
+    (void)advice;
+    (void)offset;
+    (void)len;
+#endif
+}
+
+bool Utils_MappedFile::AdviseHugePages(void) const
+{
+    return false;
+}
+
+#else
+
+bool Utils_MappedFile::Open(const std::string & file)
+{
+    Close();
+    int fd = ::open(file.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0)
+    {
+        ::close(fd);
+        return false;
+    }
+    fd_ = fd;
+    size_ = static_cast<size_t>(st.st_size);
+    open_ = true;
+    if (size_ == 0)
+        return true;
+
+    void *p = mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+    if (p == MAP_FAILED)
+    {
+        Close();
+        return false;
+    }
+    data_ = static_cast<const char *>(p);
+    return true;
+}
+
+void Utils_MappedFile::Close(void)
+{
+    if (data_ != nullptr)
+        munmap(const_cast<char *>(data_), size_);
+    if (fd_ >= 0)
+        ::close(fd_);
+    data_ = nullptr;
+    fd_ = -1;
+    size_ = 0;
+    open_ = false;
+}
+
+void Utils_MappedFile::AdviseSequential(void) const
+{
+    Advise(kSequential);
+}
+
+void Utils_MappedFile::Advise(Advice advice, size_t offset, size_t len) const
+{
+    if (data_ == nullptr || offset >= size_)
+        return;
+    if (len > size_ - offset)
+        len = size_ - offset;
+    // madvise 要求起始地址按页对齐, 映射起始地址是对齐的
+    const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const size_t begin = offset / page * page;
+    len += offset - begin;
+
+    int flag = MADV_NORMAL;
+    switch (advice)
+    {
+        case kSequential:
+            flag = MADV_SEQUENTIAL;
+            break;
+        case kRandom:
+            flag = MADV_RANDOM;
+            break;
+        case kWillNeed:
+            flag = MADV_WILLNEED;
+            break;
+        case kDontNeed:
+            flag = MADV_DONTNEED;
+            break;
+        default:
+            break;
+    }
+    madvise(const_cast<char *>(data_ + begin), len, flag);
+}
+
+bool Utils_MappedFile::AdviseHugePages(void) const
+{
+#ifdef MADV_HUGEPAGE
+    return data_ != nullptr && madvise(const_cast<char *>(data_), size_, MADV_HUGEPAGE) == 0;
+#else
+    return false;
+#endif
+}
+
+#endif
+
+bool Utils_MappedReader::Open(const std::string & file, const Options & opt)
+{
+    Close();
+    if (!file_.Open(file))
+        return false;
+    data_ = file_.data();
+    size_ = file_.size();
+    if (opt.huge_pages && size_ >= opt.huge_pages_min)
+        file_.AdviseHugePages();
+    if (opt.advice != Utils_MappedFile::kNormal)
+        file_.Advise(opt.advice);
+    return true;
+}
+
+void Utils_MappedReader::Close(void)
+{
+    file_.Close();
+    data_ = nullptr;
+    size_ = 0;
+    pos_ = 0;
+}
+
+bool Utils_MappedReader::ReadView(size_t len, std::string_view & out)
+{
+    if (len > Remaining())
+        return false;
+    out = std::string_view(data_ + pos_, len);
+    pos_ += len;
+    return true;
+}
+
+bool Utils_MappedReader::ReadFixedView(size_t len, std::string_view & out)
+{
+    if (!ReadView(len, out))
+        return false;
+    const void *nul = len != 0 ? memchr(out.data(), '\0', len) : nullptr;
+    if (nul != nullptr)
+        out = out.substr(0, static_cast<size_t>(static_cast<const char *>(nul) - out.data()));
+    return true;
+}
+
+bool Utils_MappedReader::ReadString(size_t len, std::string & out)
+{
+    std::string_view v;
+    if (!ReadFixedView(len, v))
+        return false;
+    out.assign(v.data(), v.size());
+    return true;
+}
+
+bool Utils_MappedReader::ReadCString(std::string_view & out)
+{
+    const void *nul = Remaining() != 0 ? memchr(data_ + pos_, '\0', Remaining()) : nullptr;
+    if (nul == nullptr)
+        return false;
+    const size_t len = static_cast<size_t>(static_cast<const char *>(nul) - (data_ + pos_));
+    out = std::string_view(data_ + pos_, len);
+    pos_ += len + 1;
+    return true;
+}
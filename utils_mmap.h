@@ -0,0 +1,432 @@
+/**
+ * @file    Code\utils\utils_mmap.h.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   只读内存映射文件  Windows 使用 CreateFileMapping, 其他平台使用 mmap
+ *          * 映射之后直接以 const char* 访问文件内容, 由系统按需分页读入, 不经过 fstream 拷贝
+ *          * Utils_MappedReader 在映射上按游标顺序读取 基本类型 / 数组 / 定长字符串, 全部做边界检查
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#pragma once
+#ifndef UTILS_MMAP_H_
+#define UTILS_MMAP_H_
+
+#include <stdint.h>
+#include <string.h>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @class   Utils_MappedFile utils_mmap.h Code\utils\utils_mmap.h
+ *
+ * @brief   只读映射整个文件  不可拷贝 可移动, 析构时解除映射
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+class Utils_MappedFile
+{
+    public:
+
+    /**
+     * @brief   访问方式提示  对应 madvise, Windows 上只有 kWillNeed 有效 (PrefetchVirtualMemory)
+     */
+    enum Advice
+    {
+        kNormal,
+        kSequential,    ///< 顺序读取 加大预读, 读过的页可以尽快回收
+        kRandom,        ///< 随机读取 关闭预读
+        kWillNeed,      ///< 立即开始异步读入
+        kDontNeed,      ///< 不再需要 可以回收
+    };
+
+    Utils_MappedFile() = default;
+    ~Utils_MappedFile();
+
+    Utils_MappedFile(const Utils_MappedFile &) = delete;
+    Utils_MappedFile &operator=(const Utils_MappedFile &) = delete;
+    Utils_MappedFile(Utils_MappedFile &&other) noexcept;
+    Utils_MappedFile &operator=(Utils_MappedFile &&other) noexcept;
+
+    /**
+     * @fn  bool Utils_MappedFile::Open(const std::string &file);
+     *
+     * @brief   打开并映射文件  已打开的文件先关闭, 空文件打开成功但 data() 为 nullptr
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param   file    The file
+     *
+     * @return  True if it succeeds, false if it fails
+     */
+    bool Open(const std::string &file);
+
+    /**
+     * @fn  void Utils_MappedFile::Close(void);
+     *
+     * @brief   解除映射 关闭文件
+     */
+    void Close(void);
+
+    /**
+     * @fn  void Utils_MappedFile::AdviseSequential(void) const;
+     *
+     * @brief   提示系统顺序读取 加大预读, Windows 上无操作
+     */
+    void AdviseSequential(void) const;
+
+    /**
+     * @fn  void Utils_MappedFile::Advise(Advice advice, size_t offset = 0, size_t len = SIZE_MAX) const;
+     *
+     * @brief   对 [offset, offset + len) 给出访问方式提示  offset 向下对齐到页, 超出文件的部分忽略
+     */
+    void Advise(Advice advice, size_t offset = 0, size_t len = SIZE_MAX) const;
+
+    /**
+     * @fn  bool Utils_MappedFile::AdviseHugePages(void) const;
+     *
+     * @brief   请求使用透明大页 (MADV_HUGEPAGE) 减少大文件的 TLB 缺失
+     *          * 文件映射需要内核支持只读文件大页 (CONFIG_READ_ONLY_THP_FOR_FS), 不支持时没有效果
+     *
+     * @return  false 平台不支持 或 内核拒绝
+     */
+    bool AdviseHugePages(void) const;
+
+    bool IsOpen(void) const
+    {
+        return open_;
+    }
+
+    const char *data(void) const
+    {
+        return data_;
+    }
+
+    size_t size(void) const
+    {
+        return size_;
+    }
+
+    std::string_view view(void) const
+    {
+        return std::string_view(data_, size_);
+    }
+
+    private:
+
+    void Swap(Utils_MappedFile &other) noexcept;
+
+    const char *data_ = nullptr;
+    size_t size_ = 0;
+    bool open_ = false;
+#ifdef _WIN32
+    void *file_ = nullptr;      ///< HANDLE
+    void *mapping_ = nullptr;   ///< HANDLE
+#else
+    int fd_ = -1;
+#endif
+};
+
+/**
+ * @class   Utils_MappedSpan utils_mmap.h Code\utils\utils_mmap.h
+ *
+ * @brief   映射内存上的只读数组视图  不拥有数据, 在 Utils_MappedReader 关闭之前有效
+ *          * operator[] 不检查, at() 越界时抛出 std::out_of_range
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+template<typename T>
+class Utils_MappedSpan
+{
+    public:
+
+    Utils_MappedSpan() = default;
+
+    Utils_MappedSpan(const T *data, size_t size) : data_(data), size_(size)
+    {
+    }
+
+    const T *data(void) const
+    {
+        return data_;
+    }
+
+    size_t size(void) const
+    {
+        return size_;
+    }
+
+    bool empty(void) const
+    {
+        return size_ == 0;
+    }
+
+    const T *begin(void) const
+    {
+        return data_;
+    }
+
+    const T *end(void) const
+    {
+        return data_ + size_;
+    }
+
+    const T &operator[](size_t i) const
+    {
+        return data_[i];
+    }
+
+    const T &at(size_t i) const
+    {
+        if (i >= size_)
+            throw std::out_of_range("Utils_MappedSpan::at");
+        return data_[i];
+    }
+
+    /**
+     * @fn  Utils_MappedSpan Utils_MappedSpan::subspan(size_t offset, size_t count = SIZE_MAX) const
+     *
+     * @brief   子视图  超出范围的部分截断
+     */
+    Utils_MappedSpan subspan(size_t offset, size_t count = SIZE_MAX) const
+    {
+        if (offset > size_)
+            offset = size_;
+        if (count > size_ - offset)
+            count = size_ - offset;
+        return Utils_MappedSpan(data_ + offset, count);
+    }
+
+    private:
+
+    const T *data_ = nullptr;
+    size_t size_ = 0;
+};
+
+/**
+ * @class   Utils_MappedReader utils_mmap.h Code\utils\utils_mmap.h
+ *
+ * @brief   基于内存映射的二进制读取  代替 Utils_Files::ReadData / ReadStringBinary 逐个 fstream::read
+ *          * 读取失败 (剩余长度不够) 时返回 false, 游标不移动
+ *          * 数值按本机字节序 memcpy 读取, 不要求对齐; ReadSpan 直接返回映射中的数组, 要求按 alignof(T) 对齐
+ *          *   Utils_MappedReader reader;
+ *          *   reader.Open("frame.bin");
+ *          *   uint32_t count = 0;
+ *          *   Utils_MappedSpan<float> points;
+ *          *   if (reader.Read(count) && reader.ReadSpan(count, points)) ...
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+class Utils_MappedReader
+{
+    public:
+
+    struct Options
+    {
+        Utils_MappedFile::Advice advice = Utils_MappedFile::kSequential;
+        bool huge_pages = false;        ///< 大于 huge_pages_min 的文件请求透明大页
+        size_t huge_pages_min = size_t(64) << 20;
+    };
+
+    Utils_MappedReader() = default;
+
+    /**
+     * @fn  explicit Utils_MappedReader::Utils_MappedReader(std::string_view data)
+     *
+     * @brief   读取已有的内存  不拷贝, 调用者保证读取期间有效
+     */
+    explicit Utils_MappedReader(std::string_view data) : data_(data.data()), size_(data.size())
+    {
+    }
+
+    /**
+     * @fn  bool Utils_MappedReader::Open(const std::string &file, const Options &opt);
+     *
+     * @brief   映射文件并给出访问方式提示  游标回到开头
+     */
+    bool Open(const std::string &file, const Options &opt);
+
+    bool Open(const std::string &file)
+    {
+        return Open(file, Options());
+    }
+
+    void Close(void);
+
+    bool IsOpen(void) const
+    {
+        return data_ != nullptr || file_.IsOpen();
+    }
+
+    const char *data(void) const
+    {
+        return data_;
+    }
+
+    size_t size(void) const
+    {
+        return size_;
+    }
+
+    std::string_view view(void) const
+    {
+        return std::string_view(data_, size_);
+    }
+
+    const Utils_MappedFile &file(void) const
+    {
+        return file_;
+    }
+
+    size_t Tell(void) const
+    {
+        return pos_;
+    }
+
+    size_t Remaining(void) const
+    {
+        return size_ - pos_;
+    }
+
+    bool eof(void) const
+    {
+        return pos_ >= size_;
+    }
+
+    bool Seek(size_t pos)
+    {
+        if (pos > size_)
+            return false;
+        pos_ = pos;
+        return true;
+    }
+
+    bool Skip(size_t n)
+    {
+        if (n > Remaining())
+            return false;
+        pos_ += n;
+        return true;
+    }
+
+    /**
+     * @fn  template<typename T> bool Utils_MappedReader::ReadAt(size_t pos, T &value) const
+     *
+     * @brief   读取 pos 处的基本数据类型 或 POD 结构体, 不移动游标
+     */
+    template<typename T>
+    bool ReadAt(size_t pos, T &value) const
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+        if (pos > size_ || sizeof(T) > size_ - pos)
+            return false;
+        memcpy(&value, data_ + pos, sizeof(T));
+        return true;
+    }
+
+    template<typename T>
+    bool Read(T &value)
+    {
+        if (!ReadAt(pos_, value))
+            return false;
+        pos_ += sizeof(T);
+        return true;
+    }
+
+    /**
+     * @fn  template<typename T> bool Utils_MappedReader::ReadArray(T *out, size_t count)
+     *
+     * @brief   拷贝 count 个元素到 out
+     */
+    template<typename T>
+    bool ReadArray(T *out, size_t count)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+        if (count > Remaining() / sizeof(T))
+            return false;
+        if (count != 0)
+            memcpy(out, data_ + pos_, count * sizeof(T));
+        pos_ += count * sizeof(T);
+        return true;
+    }
+
+    template<typename T>
+    bool ReadArray(std::vector<T> &out, size_t count)
+    {
+        if (count > Remaining() / sizeof(T))
+            return false;
+        out.resize(count);
+        return ReadArray(out.data(), count);
+    }
+
+    /**
+     * @fn  template<typename T> bool Utils_MappedReader::SpanAt(size_t pos, size_t count, Utils_MappedSpan<T> &out) const
+     *
+     * @brief   pos 处 count 个元素的视图, 不拷贝  越界 或 地址没有按 alignof(T) 对齐时返回 false (改用 ReadArray)
+     */
+    template<typename T>
+    bool SpanAt(size_t pos, size_t count, Utils_MappedSpan<T> &out) const
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+        if (pos > size_ || count > (size_ - pos) / sizeof(T))
+            return false;
+        const char *p = data_ + pos;
+        if (reinterpret_cast<uintptr_t>(p) % alignof(T) != 0)
+            return false;
+        out = Utils_MappedSpan<T>(reinterpret_cast<const T *>(p), count);
+        return true;
+    }
+
+    template<typename T>
+    bool ReadSpan(size_t count, Utils_MappedSpan<T> &out)
+    {
+        if (!SpanAt(pos_, count, out))
+            return false;
+        pos_ += count * sizeof(T);
+        return true;
+    }
+
+    /**
+     * @fn  bool Utils_MappedReader::ReadView(size_t len, std::string_view &out);
+     *
+     * @brief   len 个字节的视图, 不拷贝
+     */
+    bool ReadView(size_t len, std::string_view &out);
+
+    /**
+     * @fn  bool Utils_MappedReader::ReadString(size_t len, std::string &out);
+     *
+     * @brief   定长字符串字段  占 len 个字节, 内容到第一个 '\0' 为止 (与 Utils_Files::WriteStringBinary 对应)
+     */
+    bool ReadString(size_t len, std::string &out);
+
+    /**
+     * @fn  bool Utils_MappedReader::ReadFixedView(size_t len, std::string_view &out);
+     *
+     * @brief   同 ReadString, 不拷贝
+     */
+    bool ReadFixedView(size_t len, std::string_view &out);
+
+    /**
+     * @fn  bool Utils_MappedReader::ReadCString(std::string_view &out);
+     *
+     * @brief   以 '\0' 结尾的字符串  游标移到 '\0' 之后, 没有 '\0' 时返回 false
+     */
+    bool ReadCString(std::string_view &out);
+
+    private:
+
+    Utils_MappedFile file_;
+    const char *data_ = nullptr;
+    size_t size_ = 0;
+    size_t pos_ = 0;
+};
+
+#endif  // UTILS_MMAP_H_
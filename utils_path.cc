@@ -0,0 +1,145 @@
+/**
+ * @file    Code\utils\utils_path.cc.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   路径拆分与拼接的实现
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#include "./utils_path.h"
+#include "./utils_string.h"
+
+#include <string.h>
+
+namespace
+{
+
+// 文件名中扩展名 '.' 的位置  隐藏文件 (开头的 '.') "." ".." 没有扩展名
+size_t ExtensionPos(std::string_view name)
+{
+    if (name == "." || name == "..")
+        return std::string_view::npos;
+    const size_t dot = name.rfind('.');
+    return (dot == 0) ? std::string_view::npos : dot;
+}
+
+// "/" 或 "C:" 这样的根  上一级保留它后面的分隔符
+inline bool IsRoot(std::string_view prefix)
+{
+    return prefix.empty() || (prefix.size() == 2 && prefix[1] == ':');
+}
+
+}  // namespace
+
+std::string_view Utils_Path::FileName(std::string_view path)
+{
+    const size_t sep = LastSep(path);
+    return sep == std::string_view::npos ? path : path.substr(sep + 1);
+}
+
+std::string_view Utils_Path::Stem(std::string_view path)
+{
+    const std::string_view name = FileName(path);
+    const size_t dot = ExtensionPos(name);
+    return dot == std::string_view::npos ? name : name.substr(0, dot);
+}
+
+std::string_view Utils_Path::Extension(std::string_view path)
+{
+    const std::string_view name = FileName(path);
+    const size_t dot = ExtensionPos(name);
+    return dot == std::string_view::npos ? std::string_view() : name.substr(dot);
+}
+
+std::string_view Utils_Path::Dir(std::string_view path)
+{
+    const size_t sep = LastSep(path);
+    return sep == std::string_view::npos ? std::string_view() : path.substr(0, sep + 1);
+}
+
+std::string_view Utils_Path::Parent(std::string_view path)
+{
+    size_t end = LastSep(path);
+    if (end == std::string_view::npos)
+        return std::string_view();
+    while (end > 0 && IsSep(path[end - 1]))
+        end--;
+    if (IsRoot(path.substr(0, end)))
+        return path.substr(0, end + 1);
+    return path.substr(0, end);
+}
+
+std::string_view Utils_Path::Back(std::string_view path)
+{
+    if (!path.empty() && IsSep(path.back()))
+        path.remove_suffix(1);
+    return Dir(path);
+}
+
+bool Utils_Path::HasExtension(std::string_view path, std::string_view ext)
+{
+    if (ext.empty())
+        return false;
+    // 没有 '.' 的 ext 比较时要求前面一个字符是 '.'
+    const bool dot = ext[0] == '.';
+    const std::string_view name = FileName(path);
+    const size_t n = ext.size() + (dot ? 0 : 1);
+    if (name.size() < n || (!dot && name[name.size() - n] != '.'))
+        return false;
+    return Utils_String::StringEqualNoCase(name.substr(name.size() - ext.size()), ext);
+}
+
+bool Utils_Path::HasExtension(std::string_view path, const std::vector<std::string> &exts)
+{
+    for (const std::string &ext : exts)
+    {
+        if (HasExtension(path, ext))
+            return true;
+    }
+    return false;
+}
+
+std::string_view Utils_Path::Join(std::string & out, std::string_view dir, std::string_view name, char sep)
+{
+    out.assign(dir.data(), dir.size());
+    if (!dir.empty() && !name.empty())
+    {
+        const bool dir_sep = IsSep(dir.back());
+        const bool name_sep = IsSep(name.front());
+        if (dir_sep && name_sep)
+            name.remove_prefix(1);
+        else if (!dir_sep && !name_sep)
+            out += sep;
+    }
+    out.append(name.data(), name.size());
+    return out;
+}
+
+size_t Utils_Path::Join(char * buf, size_t size, std::string_view dir, std::string_view name, char sep)
+{
+    bool add_sep = false;
+    if (!dir.empty() && !name.empty())
+    {
+        const bool dir_sep = IsSep(dir.back());
+        const bool name_sep = IsSep(name.front());
+        if (dir_sep && name_sep)
+            name.remove_prefix(1);
+        add_sep = !dir_sep && !name_sep;
+    }
+    const size_t total = dir.size() + (add_sep ? 1 : 0) + name.size();
+    if (buf == nullptr || size == 0)
+        return total;
+
+    size_t pos = 0;
+    auto put = [&](const char *s, size_t n) {
+        n = (n < size - 1 - pos) ? n : size - 1 - pos;
+        memcpy(buf + pos, s, n);
+        pos += n;
+    };
+    put(dir.data(), dir.size());
+    if (add_sep)
+        put(&sep, 1);
+    put(name.data(), name.size());
+    buf[pos] = '\0';
+    return total;
+}
@@ -0,0 +1,131 @@
+/**
+ * @file    Code\utils\utils_path.h.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   路径拆分与拼接  在 string_view 上操作, 不分配内存
+ *          * '/' 和 '\\' 都作为分隔符, Windows 路径和 Linux 路径都可以处理
+ *          * 返回的 string_view 指向传入的路径, 调用者保证路径在使用期间有效
+ *          * Utils_Files::GetFileName / SplitFileName 和 Utils_QT::DirBack 基于这里实现
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#pragma once
+#ifndef UTILS_PATH_H_
+#define UTILS_PATH_H_
+
+#include <stddef.h>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @class   Utils_Path utils_path.h Code\utils\utils_path.h
+ *
+ * @brief   路径工具  以 "D:\\data/img.v2.png" 为例:
+ *          *   FileName  "img.v2.png"
+ *          *   Stem      "img.v2"
+ *          *   Extension ".png"
+ *          *   Dir       "D:\\data/"      含末尾分隔符
+ *          *   Parent    "D:\\data"       不含末尾分隔符, 根目录保留 ("/", "C:\\")
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+class Utils_Path
+{
+    public:
+
+    static bool IsSep(char c)
+    {
+        return c == '/' || c == '\\';
+    }
+
+    /**
+     * @fn  static size_t Utils_Path::LastSep(std::string_view path)
+     *
+     * @brief   最后一个分隔符的位置  没有时为 npos
+     */
+    static size_t LastSep(std::string_view path)
+    {
+        return path.find_last_of("/\\");
+    }
+
+    /**
+     * @fn  static std::string_view Utils_Path::FileName(std::string_view path);
+     *
+     * @brief   最后一个分隔符之后的部分  以分隔符结尾时为空
+     */
+    static std::string_view FileName(std::string_view path);
+
+    /**
+     * @fn  static std::string_view Utils_Path::Stem(std::string_view path);
+     *
+     * @brief   文件名去掉最后一个扩展名  ".bashrc" "." ".." 没有扩展名
+     */
+    static std::string_view Stem(std::string_view path);
+
+    /**
+     * @fn  static std::string_view Utils_Path::Extension(std::string_view path);
+     *
+     * @brief   最后一个扩展名 含 '.', 没有时为空
+     */
+    static std::string_view Extension(std::string_view path);
+
+    /**
+     * @fn  static std::string_view Utils_Path::Dir(std::string_view path);
+     *
+     * @brief   到最后一个分隔符为止 (含), 没有分隔符时为空
+     */
+    static std::string_view Dir(std::string_view path);
+
+    /**
+     * @fn  static std::string_view Utils_Path::Parent(std::string_view path);
+     *
+     * @brief   上一级路径 不含末尾分隔符 (连续的分隔符一起去掉), 根目录 "/" "C:\\" 保留分隔符
+     */
+    static std::string_view Parent(std::string_view path);
+
+    /**
+     * @fn  static std::string_view Utils_Path::Back(std::string_view path);
+     *
+     * @brief   文件夹后退一层  "a/b/c/" 和 "a/b/c" 都返回 "a/b/", 没有上一层返回空
+     */
+    static std::string_view Back(std::string_view path);
+
+    /**
+     * @fn  static bool Utils_Path::HasExtension(std::string_view path, std::string_view ext);
+     *
+     * @brief   文件名是否以扩展名 ext 结尾  ext 为 ".png" 或 "png", 不区分大小写
+     *          * 按后缀比较, ".tar.gz" 可以匹配, 隐藏文件 ".png" 也匹配 ".png"
+     *          * Utils_Walker Utils_FileIndex Utils_Loader 的扩展名过滤都使用这里
+     */
+    static bool HasExtension(std::string_view path, std::string_view ext);
+
+    /**
+     * @fn  static bool Utils_Path::HasExtension(std::string_view path, const std::vector<std::string> &exts);
+     *
+     * @brief   匹配 exts 中任意一个扩展名  exts 为空时返回 false
+     */
+    static bool HasExtension(std::string_view path, const std::vector<std::string> &exts);
+
+    /**
+     * @fn  static std::string_view Utils_Path::Join(std::string &out, std::string_view dir, std::string_view name, char sep = '/');
+     *
+     * @brief   拼接到调用者的缓冲区  out 的内容被替换, 容量足够时不分配内存 (循环中重复使用同一个 out)
+     *          * dir 末尾 和 name 开头 之间恰好保留一个分隔符, 任一为空时不加分隔符
+     *
+     * @return  指向 out 的结果
+     */
+    static std::string_view Join(std::string &out, std::string_view dir, std::string_view name, char sep = '/');
+
+    /**
+     * @fn  static size_t Utils_Path::Join(char *buf, size_t size, std::string_view dir, std::string_view name, char sep = '/');
+     *
+     * @brief   拼接到字符数组  与 snprintf 相同: 最多写入 size - 1 个字符并以 '\0' 结尾
+     *
+     * @return  完整结果的长度, 大于等于 size 时表示被截断
+     */
+    static size_t Join(char *buf, size_t size, std::string_view dir, std::string_view name, char sep = '/');
+};
+
+#endif  // UTILS_PATH_H_
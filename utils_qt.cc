@@ -7,16 +7,18 @@
  */
 
 #include "./utils_qt.h"
+#include "./utils_path.h"
 #include <QDir>
 #include <QString>
 #include <QObject>
 #include <QDateTime>
 #include <QStorageInfo>
+#include <string_view>
 
 /**
  * @fn  std::string Utils_QT::DirBack(const std::string & str)
  *
- * @brief   文件夹后退一层
+ * @brief   文件夹后退一层  "a/b/c/" 和 "a/b/c" 都返回 "a/b/", 没有上一层返回空 (Utils_Path::Back, 也识别 '\\')
  *
  * @author  IRIS_Chen
  * @date    2019/11/5
@@ -27,18 +29,7 @@
  */
 std::string Utils_QT::DirBack(const std::string & str)
 {
-    // 获取从后往前的 第一个/ 位置
-    size_t index = str.find_last_of("/");
-    std::string res;
-    // 如果最后一个字符 / 则删除之后重新计算/ 位置
-    if (index == str.size() - 1)
-    {
-        res = str.substr(0, index + 1);
-        index = res.find_last_of("/");
-    }
-    res = res.substr(0, index + 1);
-
-    return res;
+    return std::string(Utils_Path::Back(str));
 }
 
 /**
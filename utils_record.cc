@@ -0,0 +1,426 @@
+/**
+ * @file    Code\utils\utils_record.cc.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   IDOI 记录文件的实现
+ *          * CRC32C: SSE4.2 每次 8 字节 crc32 指令; 查表为 slicing-by-8, 表在编译期生成
+ *          * 恢复: 从第一条记录开始, 长度不越界 且 CRC 相符 才算有效, 遇到第一条无效的记录停止
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#include "./utils_record.h"
+#include "./utils_logger.h"
+#include "./Utils_Exception.h"
+
+#include <string.h>
+#include <algorithm>
+#include <filesystem>
+#include <system_error>
+
+#if defined(__SSE4_2__) || (defined(_MSC_VER) && defined(__AVX__))
+#include <nmmintrin.h>
+#define UTILS_RECORD_CRC_SSE42 1
+#elif defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#define UTILS_RECORD_CRC_ARM 1
+#endif
+
+namespace
+{
+
+constexpr char kFileMagic[4] = { 'I', 'D', 'O', 'I' };
+constexpr char kIndexMagic[4] = { 'I', 'D', 'X', 'B' };
+constexpr char kFooterMagic[4] = { 'I', 'D', 'X', 'E' };
+
+template<typename T>
+inline T LoadLE(const void *p)
+{
+    T v;
+    memcpy(&v, p, sizeof(T));
+    return Utils_ByteOrder::kNativeLittle ? v : Utils_ByteOrder::Swap(v);
+}
+
+template<typename T>
+inline void StoreLE(void *p, T v)
+{
+    if (!Utils_ByteOrder::kNativeLittle)
+        v = Utils_ByteOrder::Swap(v);
+    memcpy(p, &v, sizeof(T));
+}
+
+// t[k][i]: 字节 i 后面跟 k 个 0 字节的 CRC
+struct Crc32cTable
+{
+    uint32_t t[8][256];
+
+    constexpr Crc32cTable() : t()
+    {
+        for (uint32_t i = 0; i < 256; i++)
+        {
+            uint32_t c = i;
+            for (int b = 0; b < 8; b++)
+                c = (c >> 1) ^ (0x82F63B78u & (0u - (c & 1u)));
+            t[0][i] = c;
+        }
+        for (int k = 1; k < 8; k++)
+            for (uint32_t i = 0; i < 256; i++)
+                t[k][i] = (t[k - 1][i] >> 8) ^ t[0][t[k - 1][i] & 0xFF];
+    }
+};
+
+constexpr Crc32cTable kCrcTable;
+
+// 记录头中的长度 和 数据 一起计算 CRC, 长度损坏也能发现
+inline uint32_t RecordCrc(uint32_t len, const void *data, size_t size)
+{
+    char le[4];
+    StoreLE(le, len);
+    return Utils_Crc32c::Extend(Utils_Crc32c::Compute(le, 4), data, size);
+}
+
+}  // namespace
+
+uint32_t Utils_Crc32c::ExtendTable(uint32_t crc, const void * data, size_t size)
+{
+    const auto &t = kCrcTable.t;
+    const uint8_t *p = static_cast<const uint8_t *>(data);
+    uint32_t c = ~crc;
+    for (; size > 0 && (reinterpret_cast<uintptr_t>(p) & 7) != 0; size--)
+        c = t[0][(c ^ *p++) & 0xFF] ^ (c >> 8);
+    for (; size >= 8; size -= 8, p += 8)
+    {
+        const uint32_t lo = LoadLE<uint32_t>(p) ^ c;
+        const uint32_t hi = LoadLE<uint32_t>(p + 4);
+        c = t[7][lo & 0xFF] ^ t[6][(lo >> 8) & 0xFF] ^ t[5][(lo >> 16) & 0xFF] ^ t[4][lo >> 24] ^
+            t[3][hi & 0xFF] ^ t[2][(hi >> 8) & 0xFF] ^ t[1][(hi >> 16) & 0xFF] ^ t[0][hi >> 24];
+    }
+    for (; size > 0; size--)
+        c = t[0][(c ^ *p++) & 0xFF] ^ (c >> 8);
+    return ~c;
+}
+
+uint32_t Utils_Crc32c::Extend(uint32_t crc, const void * data, size_t size)
+{
+#if defined(UTILS_RECORD_CRC_SSE42)
+    const uint8_t *p = static_cast<const uint8_t *>(data);
+    uint32_t c = ~crc;
+    for (; size > 0 && (reinterpret_cast<uintptr_t>(p) & 7) != 0; size--)
+        c = _mm_crc32_u8(c, *p++);
+#if defined(__x86_64__) || defined(_M_X64)
+    uint64_t c64 = c;
+    for (; size >= 8; size -= 8, p += 8)
+    {
+        uint64_t v;
+        memcpy(&v, p, 8);
+        c64 = _mm_crc32_u64(c64, v);
+    }
+    c = static_cast<uint32_t>(c64);
+#else
+    for (; size >= 4; size -= 4, p += 4)
+    {
+        uint32_t v;
+        memcpy(&v, p, 4);
+        c = _mm_crc32_u32(c, v);
+    }
+#endif
+    for (; size > 0; size--)
+        c = _mm_crc32_u8(c, *p++);
+    return ~c;
+#elif defined(UTILS_RECORD_CRC_ARM)
+    const uint8_t *p = static_cast<const uint8_t *>(data);
+    uint32_t c = ~crc;
+    for (; size >= 8; size -= 8, p += 8)
+    {
+        uint64_t v;
+        memcpy(&v, p, 8);
+        c = __crc32cd(c, v);
+    }
+    for (; size > 0; size--)
+        c = __crc32cb(c, *p++);
+    return ~c;
+#else
+    return ExtendTable(crc, data, size);
+#endif
+}
+
+// ---------------------------------------------------------------------------------------------
+
+Utils_RecordWriter::~Utils_RecordWriter()
+{
+    Close();
+}
+
+bool Utils_RecordWriter::Fail(int error)
+{
+    error_ = error;
+    return false;
+}
+
+bool Utils_RecordWriter::Open(const std::string & file, const Options & opt, bool append)
+{
+    Close();
+    error_ = 0;
+    offsets_.clear();
+    base_ = 0;
+    unsynced_ = 0;
+    sync_every_ = opt.sync_every;
+
+    Utils_BinaryWriter::Options wopt;
+    wopt.buffer_size = opt.buffer_size;
+    wopt.endian = Utils_Endian::kLittle;
+
+    std::error_code ec;
+    if (append && std::filesystem::file_size(file, ec) > 0 && !ec)
+    {
+        // 继续写入: 保留有效的记录, 截掉索引块 (重新写) 和 崩溃留下的不完整尾部
+        Utils_RecordReader reader;
+        Utils_RecordReader::Options ropt;
+        ropt.verify = false;
+        if (!reader.Open(file, ropt))
+            return Fail(reader.Error());
+        offsets_.resize(reader.size());
+        for (size_t i = 0; i < offsets_.size(); i++)
+            offsets_[i] = reader.Offset(i);
+        base_ = reader.ValidEnd();
+        reader.Close();
+
+        std::filesystem::resize_file(file, base_, ec);
+        if (ec)
+            return Fail(Error_IDOI_File_Write);
+        if (!writer_.Open(file, wopt, true))
+            return Fail(Error_IDOI_FileWritePointerNull);
+        return true;
+    }
+
+    if (!writer_.Open(file, wopt))
+        return Fail(Error_IDOI_FileWritePointerNull);
+    char header[Utils_RecordFormat::kHeaderSize];
+    memcpy(header, kFileMagic, 4);
+    StoreLE<uint16_t>(header + 4, Utils_RecordFormat::kVersion);
+    StoreLE<uint16_t>(header + 6, static_cast<uint16_t>(Utils_RecordFormat::kHeaderSize));
+    StoreLE<uint32_t>(header + 8, opt.tag);
+    StoreLE<uint32_t>(header + 12, Utils_Crc32c::Compute(header, 12));
+    if (!writer_.PutBytes(header, sizeof(header)))
+        return Fail(Error_IDOI_File_Write);
+    return true;
+}
+
+bool Utils_RecordWriter::Append(const void * data, size_t size)
+{
+    if (!IsOpen())
+        return Fail(Error_IDOI_FileWritePointerNull);
+    if (size > Utils_RecordFormat::kMaxRecord)
+        return Fail(Error_IDOI_File_Write);
+
+    static const char zeros[Utils_RecordFormat::kAlign] = {};
+    const uint32_t len = static_cast<uint32_t>(size);
+    const uint64_t pos = base_ + writer_.Tell();
+    const size_t pad = Utils_RecordFormat::AlignUp(size) - size;
+    if (!writer_.Put<uint32_t>(len) || !writer_.Put<uint32_t>(RecordCrc(len, data, size)) ||
+        !writer_.PutBytes(data, size) || !writer_.PutBytes(zeros, pad))
+        return Fail(Error_IDOI_File_Write);
+    offsets_.push_back(pos);
+
+    if (sync_every_ > 0 && ++unsynced_ >= sync_every_)
+        return Sync();
+    return true;
+}
+
+bool Utils_RecordWriter::Flush(void)
+{
+    if (!IsOpen())
+        return Fail(Error_IDOI_FileWritePointerNull);
+    return writer_.Flush() || Fail(Error_IDOI_File_Write);
+}
+
+bool Utils_RecordWriter::Sync(void)
+{
+    if (!IsOpen())
+        return Fail(Error_IDOI_FileWritePointerNull);
+    unsynced_ = 0;
+    return writer_.Sync() || Fail(Error_IDOI_File_Write);
+}
+
+bool Utils_RecordWriter::Close(void)
+{
+    if (!IsOpen())
+        return false;
+
+    // 索引块 CRC 覆盖 记录数 + 偏移 (小端)
+    const uint64_t index_pos = base_ + writer_.Tell();
+    const uint64_t count = offsets_.size();
+    char le[8];
+    StoreLE(le, count);
+    uint32_t crc = Utils_Crc32c::Compute(le, 8);
+    if (Utils_ByteOrder::kNativeLittle)
+    {
+        crc = Utils_Crc32c::Extend(crc, offsets_.data(), offsets_.size() * sizeof(uint64_t));
+    }
+    else
+    {
+        for (uint64_t off : offsets_)
+        {
+            StoreLE(le, off);
+            crc = Utils_Crc32c::Extend(crc, le, 8);
+        }
+    }
+
+    bool ok = writer_.PutBytes(kIndexMagic, 4) && writer_.Put<uint32_t>(0) && writer_.Put<uint64_t>(count) &&
+        writer_.PutArray(offsets_) && writer_.Put<uint64_t>(index_pos) && writer_.Put<uint32_t>(crc) &&
+        writer_.PutBytes(kFooterMagic, 4);
+    ok = writer_.Close() && ok;
+    offsets_.clear();
+    offsets_.shrink_to_fit();
+    return ok || Fail(Error_IDOI_File_Write);
+}
+
+// ---------------------------------------------------------------------------------------------
+
+bool Utils_RecordReader::Fail(int error)
+{
+    error_ = error;
+    return false;
+}
+
+bool Utils_RecordReader::Open(const std::string & file, const Options & opt)
+{
+    Close();
+    error_ = 0;
+    verify_ = opt.verify;
+
+    Utils_MappedReader::Options mopt;
+    mopt.advice = opt.advice;
+    if (!reader_.Open(file, mopt))
+        return Fail(Error_IDOI_FileNotExist);
+
+    const char *p = reader_.data();
+    if (reader_.size() < Utils_RecordFormat::kHeaderSize || memcmp(p, kFileMagic, 4) != 0 ||
+        LoadLE<uint16_t>(p + 4) != Utils_RecordFormat::kVersion ||
+        LoadLE<uint16_t>(p + 6) != Utils_RecordFormat::kHeaderSize ||
+        LoadLE<uint32_t>(p + 12) != Utils_Crc32c::Compute(p, 12))
+    {
+        Close();
+        return Fail(Error_IDOI_FileVerifyError);
+    }
+    tag_ = LoadLE<uint32_t>(p + 8);
+
+    if (LoadIndex())
+        return true;
+    if (!opt.recover)
+    {
+        Close();
+        return Fail(Error_IDOI_FileVerifyError);
+    }
+    Recover();
+    return true;
+}
+
+void Utils_RecordReader::Close(void)
+{
+    reader_.Close();
+    index_ = nullptr;
+    offsets_.clear();
+    offsets_.shrink_to_fit();
+    count_ = 0;
+    valid_end_ = 0;
+    tag_ = 0;
+    recovered_ = false;
+}
+
+/**
+ * @fn  bool Utils_RecordReader::LoadIndex(void)
+ *
+ * @brief   校验文件尾和索引块  索引直接指向映射, 不拷贝
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ *
+ * @return  false 没有完整的索引 (写入时崩溃 或 损坏)
+ */
+bool Utils_RecordReader::LoadIndex(void)
+{
+    const char *data = reader_.data();
+    const uint64_t size = reader_.size();
+    const uint64_t min_size = Utils_RecordFormat::kHeaderSize + Utils_RecordFormat::kIndexHeader +
+        Utils_RecordFormat::kFooterSize;
+    if (size < min_size)
+        return false;
+
+    const char *footer = data + size - Utils_RecordFormat::kFooterSize;
+    if (memcmp(footer + 12, kFooterMagic, 4) != 0)
+        return false;
+    const uint64_t index_pos = LoadLE<uint64_t>(footer);
+    if (index_pos < Utils_RecordFormat::kHeaderSize || index_pos % Utils_RecordFormat::kAlign != 0 ||
+        index_pos > size - Utils_RecordFormat::kFooterSize - Utils_RecordFormat::kIndexHeader)
+        return false;
+    const char *block = data + index_pos;
+    if (memcmp(block, kIndexMagic, 4) != 0)
+        return false;
+    const uint64_t count = LoadLE<uint64_t>(block + 8);
+    const uint64_t bytes = size - Utils_RecordFormat::kFooterSize - index_pos - Utils_RecordFormat::kIndexHeader;
+    if (count > bytes / 8 || count * 8 != bytes)
+        return false;
+    if (Utils_Crc32c::Compute(block + 8, static_cast<size_t>(8 + bytes)) != LoadLE<uint32_t>(footer + 8))
+        return false;
+
+    index_ = block + Utils_RecordFormat::kIndexHeader;
+    count_ = static_cast<size_t>(count);
+    valid_end_ = index_pos;
+    recovered_ = false;
+    return true;
+}
+
+void Utils_RecordReader::Recover(void)
+{
+    const char *data = reader_.data();
+    const uint64_t size = reader_.size();
+    uint64_t pos = Utils_RecordFormat::kHeaderSize;
+    while (size - pos >= Utils_RecordFormat::kRecordHeader)
+    {
+        const uint32_t len = LoadLE<uint32_t>(data + pos);
+        if (len > size - pos - Utils_RecordFormat::kRecordHeader)
+            break;
+        const char *payload = data + pos + Utils_RecordFormat::kRecordHeader;
+        if (RecordCrc(len, payload, len) != LoadLE<uint32_t>(data + pos + 4))
+            break;
+        offsets_.push_back(pos);
+        // 最后一条记录的补齐可能没有写完, 追加时截断 (扩展) 到对齐位置
+        pos += Utils_RecordFormat::kRecordHeader + Utils_RecordFormat::AlignUp(len);
+        if (pos > size)
+            break;
+    }
+    count_ = offsets_.size();
+    valid_end_ = pos;
+    recovered_ = true;
+}
+
+uint64_t Utils_RecordReader::Offset(size_t n) const
+{
+    return index_ != nullptr ? LoadLE<uint64_t>(index_ + n * 8) : offsets_[n];
+}
+
+bool Utils_RecordReader::Get(size_t n, std::string_view & out) const
+{
+    if (n >= count_)
+    {
+        error_ = Error_IDOI_RecordVerifyError;
+        return false;
+    }
+    const uint64_t pos = Offset(n);
+    const uint64_t end = std::min<uint64_t>(valid_end_, reader_.size());
+    if (pos < Utils_RecordFormat::kHeaderSize || pos > end || end - pos < Utils_RecordFormat::kRecordHeader)
+    {
+        error_ = Error_IDOI_RecordVerifyError;
+        return false;
+    }
+    const char *p = reader_.data() + pos;
+    const uint32_t len = LoadLE<uint32_t>(p);
+    if (len > end - pos - Utils_RecordFormat::kRecordHeader ||
+        (verify_ && RecordCrc(len, p + Utils_RecordFormat::kRecordHeader, len) != LoadLE<uint32_t>(p + 4)))
+    {
+        error_ = Error_IDOI_RecordVerifyError;
+        return false;
+    }
+    out = std::string_view(p + Utils_RecordFormat::kRecordHeader, len);
+    return true;
+}
@@ -0,0 +1,330 @@
+/**
+ * @file    Code\utils\utils_record.h.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   IDOI 记录文件  代替各个工程用 WriteData / ReadData 自己拼接的二进制格式
+ *          * 文件头 (16 字节): "IDOI" | 版本 u16 | 文件头长度 u16 | 用户标记 u32 | 前 12 字节的 CRC32C
+ *          * 记录 (只追加): 长度 u32 | CRC32C (长度 + 数据) u32 | 数据 | 补齐到 8 字节
+ *          * Close 时写入索引块: "IDXB" | 保留 u32 | 记录数 u64 | 偏移 u64 x 记录数, 最后 16 字节:
+ *            索引块偏移 u64 | 索引块 CRC32C u32 | "IDXE"
+ *          * 所有整数为小端; 数据从 8 字节对齐的位置开始, 可以直接作为数组访问
+ *          * 读取使用内存映射, 有索引时第 N 条记录 O(1) 定位; 没有有效索引 (写入时崩溃) 时从头逐条校验,
+ *            到第一条损坏的记录为止, 之前的记录都可以读取
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#pragma once
+#ifndef UTILS_RECORD_H_
+#define UTILS_RECORD_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "./utils_binary.h"
+#include "./utils_mmap.h"
+
+/**
+ * @class   Utils_Crc32c utils_record.h Code\utils\utils_record.h
+ *
+ * @brief   CRC32C (Castagnoli)  有 SSE4.2 / ARMv8 CRC 指令时使用指令, 否则查表 (每次 8 字节)
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+class Utils_Crc32c
+{
+    public:
+
+    /**
+     * @fn  static uint32_t Utils_Crc32c::Extend(uint32_t crc, const void *data, size_t size);
+     *
+     * @brief   在已有的 crc 后继续计算  Extend(Compute(a), b) == Compute(a + b)
+     */
+    static uint32_t Extend(uint32_t crc, const void *data, size_t size);
+
+    static uint32_t Compute(const void *data, size_t size)
+    {
+        return Extend(0, data, size);
+    }
+
+    static uint32_t Compute(std::string_view data)
+    {
+        return Extend(0, data.data(), data.size());
+    }
+
+    /**
+     * @fn  static uint32_t Utils_Crc32c::ExtendTable(uint32_t crc, const void *data, size_t size);
+     *
+     * @brief   查表实现  用于没有指令时 以及 校验指令实现
+     */
+    static uint32_t ExtendTable(uint32_t crc, const void *data, size_t size);
+};
+
+/**
+ * @class   Utils_RecordFormat utils_record.h Code\utils\utils_record.h
+ *
+ * @brief   格式常量
+ */
+class Utils_RecordFormat
+{
+    public:
+
+    static constexpr uint16_t kVersion = 1;
+    static constexpr size_t kHeaderSize = 16;
+    static constexpr size_t kRecordHeader = 8;      ///< 长度 + CRC
+    static constexpr size_t kIndexHeader = 16;      ///< "IDXB" + 保留 + 记录数
+    static constexpr size_t kFooterSize = 16;
+    static constexpr size_t kAlign = 8;
+    static constexpr uint32_t kMaxRecord = 0xFFFFFFF0u;
+
+    static size_t AlignUp(uint64_t n)
+    {
+        return static_cast<size_t>((n + kAlign - 1) & ~uint64_t(kAlign - 1));
+    }
+};
+
+/**
+ * @class   Utils_RecordWriter utils_record.h Code\utils\utils_record.h
+ *
+ * @brief   写入记录文件  记录经过 Utils_BinaryWriter 缓冲, 偏移保存在内存中, Close 时写入索引块
+ *          * 失败时 Error() 返回 Error_IDOI_* 错误代码
+ *          * 追加打开已有文件时先校验, 截掉旧索引块和损坏的尾部, 然后继续写入
+ *          *   Utils_RecordWriter writer;
+ *          *   writer.Open("frames.idoi");
+ *          *   for (...) writer.Append(frame.data, frame.size);
+ *          *   writer.Close();
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+class Utils_RecordWriter
+{
+    public:
+
+    struct Options
+    {
+        size_t buffer_size = size_t(1) << 20;
+        uint32_t tag = 0;               ///< 用户标记 写入文件头 (例如数据类型)
+        size_t sync_every = 0;          ///< 每写入多少条记录 fsync 一次, 0 不主动 fsync
+    };
+
+    Utils_RecordWriter() = default;
+    ~Utils_RecordWriter();
+
+    Utils_RecordWriter(const Utils_RecordWriter &) = delete;
+    Utils_RecordWriter &operator=(const Utils_RecordWriter &) = delete;
+
+    /**
+     * @fn  bool Utils_RecordWriter::Open(const std::string &file, const Options &opt, bool append = false);
+     *
+     * @brief   新建 或 追加打开  追加时文件不存在则新建, 用户标记以已有文件为准
+     */
+    bool Open(const std::string &file, const Options &opt, bool append = false);
+
+    bool Open(const std::string &file)
+    {
+        return Open(file, Options());
+    }
+
+    /**
+     * @fn  bool Utils_RecordWriter::Append(const void *data, size_t size);
+     *
+     * @brief   追加一条记录  记录编号为追加之前的 size()
+     */
+    bool Append(const void *data, size_t size);
+
+    bool Append(std::string_view data)
+    {
+        return Append(data.data(), data.size());
+    }
+
+    template<typename T>
+    bool AppendArray(const T *data, size_t count)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+        return Append(data, count * sizeof(T));
+    }
+
+    /**
+     * @fn  bool Utils_RecordWriter::Flush(void);
+     *
+     * @brief   缓冲区写入系统  其他进程可以按恢复方式读取已写入的记录
+     */
+    bool Flush(void);
+
+    /**
+     * @fn  bool Utils_RecordWriter::Sync(void);
+     *
+     * @brief   Flush 并 fsync  返回后崩溃也不会丢失已追加的记录
+     */
+    bool Sync(void);
+
+    /**
+     * @fn  bool Utils_RecordWriter::Close(void);
+     *
+     * @brief   写入索引块和文件尾并关闭  返回之前所有写入是否成功
+     */
+    bool Close(void);
+
+    bool IsOpen(void) const
+    {
+        return writer_.IsOpen();
+    }
+
+    size_t size(void) const
+    {
+        return offsets_.size();
+    }
+
+    /**
+     * @fn  int Utils_RecordWriter::Error(void) const
+     *
+     * @brief   最近一次失败的错误代码 (ErrorCode), 0 表示没有错误
+     */
+    int Error(void) const
+    {
+        return error_;
+    }
+
+    private:
+
+    bool Fail(int error);
+
+    Utils_BinaryWriter writer_;
+    std::vector<uint64_t> offsets_;
+    uint64_t base_ = 0;                 ///< 追加打开时已有的有效长度
+    size_t sync_every_ = 0;
+    size_t unsynced_ = 0;
+    int error_ = 0;
+};
+
+/**
+ * @class   Utils_RecordReader utils_record.h Code\utils\utils_record.h
+ *
+ * @brief   读取记录文件  返回的数据指向映射, 在 Close 之前有效
+ *          *   Utils_RecordReader reader;
+ *          *   if (!reader.Open("frames.idoi")) return reader.Error();
+ *          *   std::string_view frame;
+ *          *   for (size_t i = 0; i < reader.size(); i++)
+ *          *       if (reader.Get(i, frame)) ...
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+class Utils_RecordReader
+{
+    public:
+
+    struct Options
+    {
+        bool verify = true;             ///< Get 时校验 CRC
+        bool recover = true;            ///< 没有有效索引时逐条扫描恢复, false 时打开失败
+        Utils_MappedFile::Advice advice = Utils_MappedFile::kRandom;
+    };
+
+    /**
+     * @fn  bool Utils_RecordReader::Open(const std::string &file, const Options &opt);
+     *
+     * @brief   映射并校验文件头, 读取索引 或 扫描恢复
+     *
+     * @return  false 时 Error() 为 Error_IDOI_FileNotExist / Error_IDOI_FileVerifyError
+     */
+    bool Open(const std::string &file, const Options &opt);
+
+    bool Open(const std::string &file)
+    {
+        return Open(file, Options());
+    }
+
+    void Close(void);
+
+    bool IsOpen(void) const
+    {
+        return reader_.IsOpen();
+    }
+
+    size_t size(void) const
+    {
+        return count_;
+    }
+
+    uint32_t Tag(void) const
+    {
+        return tag_;
+    }
+
+    /**
+     * @fn  bool Utils_RecordReader::Recovered(void) const
+     *
+     * @brief   索引不完整 (没有正常 Close), 记录由扫描得到
+     */
+    bool Recovered(void) const
+    {
+        return recovered_;
+    }
+
+    /**
+     * @fn  uint64_t Utils_RecordReader::ValidEnd(void) const
+     *
+     * @brief   最后一条有效记录 (含补齐) 的结束位置  追加写入从这里开始
+     */
+    uint64_t ValidEnd(void) const
+    {
+        return valid_end_;
+    }
+
+    /**
+     * @fn  uint64_t Utils_RecordReader::Offset(size_t n) const;
+     *
+     * @brief   第 n 条记录 (记录头) 在文件中的偏移
+     */
+    uint64_t Offset(size_t n) const;
+
+    /**
+     * @fn  bool Utils_RecordReader::Get(size_t n, std::string_view &out) const;
+     *
+     * @brief   第 n 条记录的数据  越界 或 CRC 不符时返回 false, Error() 为 Error_IDOI_RecordVerifyError
+     */
+    bool Get(size_t n, std::string_view &out) const;
+
+    /**
+     * @fn  template<typename T> bool Utils_RecordReader::GetSpan(size_t n, Utils_MappedSpan<T> &out) const
+     *
+     * @brief   第 n 条记录作为数组  长度必须是 sizeof(T) 的整数倍
+     */
+    template<typename T>
+    bool GetSpan(size_t n, Utils_MappedSpan<T> &out) const
+    {
+        std::string_view data;
+        if (!Get(n, data) || data.size() % sizeof(T) != 0)
+            return false;
+        return reader_.SpanAt(static_cast<size_t>(data.data() - reader_.data()), data.size() / sizeof(T), out);
+    }
+
+    int Error(void) const
+    {
+        return error_;
+    }
+
+    private:
+
+    bool Fail(int error);
+    bool LoadIndex(void);
+    void Recover(void);
+
+    Utils_MappedReader reader_;
+    const char *index_ = nullptr;       ///< 映射中的偏移数组
+    std::vector<uint64_t> offsets_;     ///< 恢复得到的偏移
+    size_t count_ = 0;
+    uint64_t valid_end_ = 0;
+    uint32_t tag_ = 0;
+    bool verify_ = true;
+    bool recovered_ = false;
+    mutable int error_ = 0;
+};
+
+#endif  // UTILS_RECORD_H_
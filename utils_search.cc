@@ -0,0 +1,404 @@
+/**
+ * @file    Code\utils\utils_search.cc.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   多模式字符串查找的实现
+ *          * 先建立字典树, 再按广度优先计算失败链接, 同时把缺失的跳转补全成 DFA
+ *          * 每个状态的输出在生成时就沿失败链展开, 查找时不再走失败链
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#include "./utils_search.h"
+#include "./utils_mmap.h"
+#include "./utils_detail.h"
+
+#include <string.h>
+#include <algorithm>
+#include <thread>
+
+// x64 上 SSE2 必然存在, 其他平台回退到逐字节处理
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define UTILS_SEARCH_SSE2 1
+#endif
+
+/**
+ * @fn  static inline const uint8_t *SkipToFirst(const uint8_t *p, const uint8_t *end, const uint8_t *first, int count)
+ *
+ * @brief   跳到下一个可能的首字节  一个首字节时用 memchr, 两个或三个时 SSE2 一次比较 16 字节
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ *
+ * @param   p       起点
+ * @param   end     终点
+ * @param   first   首字节 未使用的位置填第一个首字节
+ * @param   count   首字节个数 1-3
+ *
+ * @return  首字节的位置, 没有时返回 end
+ */
+static inline const uint8_t *SkipToFirst(const uint8_t *p, const uint8_t *end, const uint8_t *first, int count)
+{
+    if (count == 1)
+    {
+        const void *q = memchr(p, first[0], static_cast<size_t>(end - p));
+        return q != nullptr ? static_cast<const uint8_t *>(q) : end;
+    }
+#ifdef UTILS_SEARCH_SSE2
+    const __m128i a = _mm_set1_epi8(static_cast<char>(first[0]));
+    const __m128i b = _mm_set1_epi8(static_cast<char>(first[1]));
+    const __m128i c = _mm_set1_epi8(static_cast<char>(first[2]));
+    for (; p + 16 <= end; p += 16)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+        __m128i hit = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, a), _mm_cmpeq_epi8(v, b)), _mm_cmpeq_epi8(v, c));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(hit));
+        if (mask != 0)
+            return p + Utils_Detail::LowestBit(mask);
+    }
+#endif
+    for (; p < end; p++)
+    {
+        if (*p == first[0] || *p == first[1] || *p == first[2])
+            return p;
+    }
+    return end;
+}
+
+int Utils_MultiSearch::Add(std::string_view pattern)
+{
+    if (built_ || pattern.empty() || patterns_.size() >= 0x7FFFFFFF)
+        return -1;
+    patterns_.emplace_back(pattern);
+    max_len_ = std::max(max_len_, pattern.size());
+    return static_cast<int>(patterns_.size() - 1);
+}
+
+/**
+ * @fn  bool Utils_MultiSearch::Build(void)
+ *
+ * @brief   生成自动机
+ *          * 1. 模式中出现的字节分配字节类, 忽略大小写时大小写字母共用一个字节类
+ *          * 2. 建立字典树, 跳转表每个状态 classes_ 项, -1 表示没有子节点
+ *          * 3. 广度优先: 子节点的失败状态为 父节点失败状态沿同一字节类的跳转, 缺失的跳转取失败状态的跳转
+ *          * 4. 输出 = 本节点结尾的模式 + 失败状态的输出
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ *
+ * @return  True if it succeeds, false if it fails
+ */
+bool Utils_MultiSearch::Build(void)
+{
+    if (built_ || patterns_.empty())
+        return false;
+
+    // 1. 字节类
+    memset(class_, 0, sizeof(class_));
+    uint32_t classes = 1;
+    for (const std::string &pat : patterns_)
+    {
+        for (char ch : pat)
+        {
+            uint8_t c = static_cast<uint8_t>(ch);
+            if (ignore_case_)
+                c = Utils_Detail::FoldCase(c);
+            if (class_[c] == 0)
+                class_[c] = static_cast<uint16_t>(classes++);
+        }
+    }
+    if (ignore_case_)
+    {
+        for (int c = 'A'; c <= 'Z'; c++)
+            class_[c] = class_[c | 0x20];
+    }
+    classes_ = classes;
+
+    // 2. 字典树
+    std::vector<int32_t> trie(classes, -1);
+    std::vector<std::vector<uint32_t>> own(1);
+    for (uint32_t id = 0; id < patterns_.size(); id++)
+    {
+        size_t s = 0;
+        for (char ch : patterns_[id])
+        {
+            size_t c = class_[static_cast<uint8_t>(ch)];
+            if (trie[s * classes + c] < 0)
+            {
+                trie[s * classes + c] = static_cast<int32_t>(own.size());
+                trie.resize(trie.size() + classes, -1);
+                own.emplace_back();
+            }
+            s = static_cast<size_t>(trie[s * classes + c]);
+        }
+        own[s].push_back(id);
+    }
+    const size_t states = own.size();
+
+    // 3. 失败链接 与 DFA 跳转
+    std::vector<uint32_t> fail(states, 0);
+    std::vector<uint32_t> order;
+    order.reserve(states);
+    order.push_back(0);
+    std::vector<uint32_t> next(states * classes, 0);
+    for (size_t k = 0; k < order.size(); k++)
+    {
+        uint32_t u = order[k];
+        for (size_t c = 0; c < classes; c++)
+        {
+            int32_t v = trie[u * classes + c];
+            uint32_t via_fail = u == 0 ? 0 : next[fail[u] * classes + c];
+            if (v >= 0)
+            {
+                fail[static_cast<size_t>(v)] = via_fail;
+                next[u * classes + c] = static_cast<uint32_t>(v);
+                order.push_back(static_cast<uint32_t>(v));
+            }
+            else
+            {
+                next[u * classes + c] = via_fail;
+            }
+        }
+    }
+
+    // 4. 输出 按广度优先顺序, 失败状态的输出已经展开
+    std::vector<std::vector<uint32_t>> outs(states);
+    for (uint32_t u : order)
+    {
+        outs[u] = own[u];
+        if (u != 0)
+            outs[u].insert(outs[u].end(), outs[fail[u]].begin(), outs[fail[u]].end());
+    }
+
+    // 重新编号 没有输出的状态在前 (初始状态为 0), 查找时一次比较就能判断是否有匹配
+    std::vector<uint32_t> id(states);
+    uint32_t quiet = 0;
+    for (uint32_t u : order)
+    {
+        if (outs[u].empty())
+            id[u] = quiet++;
+    }
+    uint32_t loud = quiet;
+    for (uint32_t u : order)
+    {
+        if (!outs[u].empty())
+            id[u] = loud++;
+    }
+    out_state_ = quiet * classes;
+
+    std::vector<uint32_t> renamed(states);
+    for (size_t u = 0; u < states; u++)
+        renamed[id[u]] = static_cast<uint32_t>(u);
+    out_begin_.assign(states + 1, 0);
+    out_.clear();
+    delta_.resize(states * classes);
+    for (size_t k = 0; k < states; k++)
+    {
+        uint32_t u = renamed[k];
+        out_begin_[k] = static_cast<uint32_t>(out_.size());
+        out_.insert(out_.end(), outs[u].begin(), outs[u].end());
+        for (size_t c = 0; c < classes; c++)
+            delta_[k * classes + c] = id[next[u * classes + c]] * classes;
+    }
+    out_begin_[states] = static_cast<uint32_t>(out_.size());
+
+    // 5. 首字节  超过 3 个时跳跃的收益不大
+    first_count_ = 0;
+    for (int c = 0; c < 256; c++)
+    {
+        if (class_[c] == 0 || trie[class_[c]] < 0)
+            continue;
+        if (first_count_ < 3)
+            first_[first_count_] = static_cast<uint8_t>(c);
+        first_count_++;
+    }
+    if (first_count_ > 3)
+        first_count_ = 0;
+    for (int i = first_count_; i < 3 && first_count_ > 0; i++)
+        first_[i] = first_[0];
+
+    built_ = true;
+    return true;
+}
+
+/**
+ * @fn  size_t Utils_MultiSearch::Run(const uint8_t *base, size_t from, size_t report, size_t to, MatchFn fn, void *ctx, int worker, std::atomic<bool> *stop) const
+ *
+ * @brief   从 from 开始以初始状态扫描到 to, 只报告在 report 及之后结尾的匹配
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ *
+ * @param           base    数据起点
+ * @param           from    扫描起点
+ * @param           report  结尾 (最后一个字节) 在 report 之前的匹配不报告
+ * @param           to      扫描终点
+ * @param           fn      匹配回调
+ * @param [in,out]  ctx     回调上下文
+ * @param           worker  线程序号
+ * @param [in,out]  stop    多线程时的停止标记, 单线程为 nullptr
+ *
+ * @return  回调的匹配数
+ */
+size_t Utils_MultiSearch::Run(const uint8_t * base, size_t from, size_t report, size_t to, MatchFn fn, void * ctx,
+                              int worker, std::atomic<bool> *stop) const
+{
+    const uint32_t *delta = delta_.data();
+    const uint16_t *cls = class_;
+    const uint8_t *p = base + from;
+    const uint8_t *end = base + to;
+    uint32_t s = 0;
+    size_t count = 0;
+    while (p < end)
+    {
+        // 没有匹配时停留在紧凑循环中
+        if (first_count_ > 0)
+        {
+            do
+            {
+                if (s == 0)
+                {
+                    p = SkipToFirst(p, end, first_, first_count_);
+                    if (p == end)
+                        return count;
+                }
+                s = delta[s + cls[*p++]];
+            } while (s < out_state_ && p < end);
+        }
+        else
+        {
+            do
+            {
+                s = delta[s + cls[*p++]];
+            } while (s < out_state_ && p < end);
+        }
+        if (s < out_state_)
+            break;
+
+        size_t e = static_cast<size_t>(p - base);
+        if (e <= report)
+            continue;
+        if (stop != nullptr && stop->load(std::memory_order_relaxed))
+            return count;
+        uint32_t state = s / classes_;
+        for (uint32_t k = out_begin_[state]; k < out_begin_[state + 1]; k++)
+        {
+            Utils_SearchMatch m;
+            m.pattern = out_[k];
+            m.len = static_cast<uint32_t>(patterns_[m.pattern].size());
+            m.pos = e - m.len;
+            count++;
+            if (!fn(ctx, m, worker))
+            {
+                if (stop != nullptr)
+                    stop->store(true, std::memory_order_relaxed);
+                return count;
+            }
+        }
+    }
+    return count;
+}
+
+size_t Utils_MultiSearch::Scan(std::string_view text, MatchFn fn, void * ctx) const
+{
+    if (!built_ || fn == nullptr)
+        return 0;
+    return Run(reinterpret_cast<const uint8_t *>(text.data()), 0, 0, text.size(), fn, ctx, 0, nullptr);
+}
+
+/**
+ * @fn  size_t Utils_MultiSearch::ScanParallel(std::string_view text, int threads, MatchFn fn, void *ctx) const
+ *
+ * @brief   多线程查找  块起点对齐到下一行的行首, 每个线程从起点之前 (最长模式 - 1) 字节开始扫描
+ *          * 只报告在本块内结尾的匹配, 跨块的匹配不会丢失也不会重复
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ *
+ * @param           text    The text
+ * @param           threads 线程数
+ * @param           fn      匹配回调
+ * @param [in,out]  ctx     回调上下文
+ *
+ * @return  回调的匹配数
+ */
+size_t Utils_MultiSearch::ScanParallel(std::string_view text, int threads, MatchFn fn, void * ctx) const
+{
+    if (!built_ || fn == nullptr)
+        return 0;
+    if (threads <= 0)
+        threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    const size_t kMinChunk = 1 << 20;
+    threads = static_cast<int>(std::min<size_t>(static_cast<size_t>(threads), text.size() / kMinChunk + 1));
+    if (threads <= 1)
+        return Scan(text, fn, ctx);
+
+    const uint8_t *base = reinterpret_cast<const uint8_t *>(text.data());
+    const size_t n = static_cast<size_t>(threads);
+    std::vector<size_t> start(n + 1);
+    start[0] = 0;
+    start[n] = text.size();
+    for (size_t i = 1; i < n; i++)
+    {
+        size_t pos = std::max(text.size() / n * i, start[i - 1]);
+        const void *nl = pos < text.size() ? memchr(base + pos, '\n', text.size() - pos) : nullptr;
+        start[i] = nl != nullptr ? static_cast<size_t>(static_cast<const uint8_t *>(nl) - base) + 1 : text.size();
+    }
+
+    std::vector<size_t> counts(n, 0);
+    std::atomic<bool> stop(false);
+    auto job = [&](size_t i) {
+        size_t from = start[i] > max_len_ - 1 ? start[i] - (max_len_ - 1) : 0;
+        counts[i] = Run(base, from, start[i], start[i + 1], fn, ctx, static_cast<int>(i), &stop);
+    };
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < n; i++)
+        workers.emplace_back(job, i);
+    job(0);
+    for (std::thread &w : workers)
+        w.join();
+
+    size_t total = 0;
+    for (size_t c : counts)
+        total += c;
+    return total;
+}
+
+std::vector<Utils_SearchMatch> Utils_MultiSearch::FindAll(std::string_view text, int threads) const
+{
+    std::vector<Utils_SearchMatch> res;
+    if (threads == 1)
+    {
+        Scan(text, [&](const Utils_SearchMatch &m) { res.push_back(m); });
+        return res;
+    }
+    // 每个线程单独收集 再按线程顺序拼接
+    std::vector<std::vector<Utils_SearchMatch>> part(threads > 0 ? static_cast<size_t>(threads)
+                                                     : std::max(1u, std::thread::hardware_concurrency()));
+    ScanParallel(text, static_cast<int>(part.size()), [&](const Utils_SearchMatch &m, int worker) {
+        part[static_cast<size_t>(worker)].push_back(m);
+    });
+    size_t total = 0;
+    for (const auto &v : part)
+        total += v.size();
+    res.reserve(total);
+    for (const auto &v : part)
+        res.insert(res.end(), v.begin(), v.end());
+    return res;
+}
+
+bool Utils_MultiSearch::FindAllInFile(const std::string & file, std::vector<Utils_SearchMatch>& out, int threads) const
+{
+    out.clear();
+    Utils_MappedFile mf;
+    if (!mf.Open(file))
+        return false;
+    mf.AdviseSequential();
+    out = FindAll(mf.view(), threads);
+    return true;
+}
+
+bool Utils_MultiSearch::Contains(std::string_view text) const
+{
+    return Scan(text, [](const Utils_SearchMatch &) { return false; }) > 0;
+}
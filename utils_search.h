@@ -0,0 +1,240 @@
+/**
+ * @file    Code\utils\utils_search.h.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   多模式字符串查找  Aho-Corasick 自动机, 用于在大量日志中同时查找几十个错误特征
+ *          * 模式中出现的字节压缩成字节类, 自动机展开成 状态 x 字节类 的跳转表, 每个字节一次查表
+ *          * 自动机回到初始状态时, 用 memchr / SSE2 跳到下一个可能的首字节
+ *          * 多线程模式按行切分数据, 每个线程向前多扫描 (最长模式 - 1) 个字节, 结果与单线程一致
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#pragma once
+#ifndef UTILS_SEARCH_H_
+#define UTILS_SEARCH_H_
+
+#include <stdint.h>
+#include <atomic>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "./utils_detail.h"
+
+/**
+ * @struct  Utils_SearchMatch
+ *
+ * @brief   一次匹配  pos 为匹配起点在数据中的偏移, pattern 为 Add 返回的编号
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+struct Utils_SearchMatch
+{
+    size_t pos = 0;
+    uint32_t pattern = 0;
+    uint32_t len = 0;       ///< 模式长度
+
+    bool operator==(const Utils_SearchMatch &other) const
+    {
+        return pos == other.pos && pattern == other.pattern && len == other.len;
+    }
+};
+
+/**
+ * @class   Utils_MultiSearch utils_search.h Code\utils\utils_search.h
+ *
+ * @brief   多模式查找  先 Add 全部模式, Build 之后只读, 可以多个线程同时查找
+ *          *   Utils_MultiSearch ms;  ms.Add("Code:1000");  ms.Add("[error]");  ms.Build();
+ *          *   ms.Scan(text, [&](const Utils_SearchMatch &m){ ... });
+ *          * 匹配按结尾位置先后回调, 同一位置结尾的较长的模式在前; 重叠的匹配都会报告
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+class Utils_MultiSearch
+{
+    public:
+
+    /**
+     * @brief   匹配回调  返回 false 停止查找; worker 为线程序号 单线程时为 0
+     */
+    typedef bool (*MatchFn)(void *ctx, const Utils_SearchMatch &m, int worker);
+
+    explicit Utils_MultiSearch(bool ignore_case = false) : ignore_case_(ignore_case) {}
+
+    /**
+     * @fn  int Utils_MultiSearch::Add(std::string_view pattern);
+     *
+     * @brief   添加一个模式  Build 之后添加无效
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param   pattern 模式 不能为空
+     *
+     * @return  模式编号 从 0 开始, 失败返回 -1
+     */
+    int Add(std::string_view pattern);
+
+    /**
+     * @fn  bool Utils_MultiSearch::Build(void);
+     *
+     * @brief   生成自动机
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @return  True if it succeeds, false 没有模式或者已经生成
+     */
+    bool Build(void);
+
+    bool IsBuilt(void) const
+    {
+        return built_;
+    }
+
+    size_t PatternCount(void) const
+    {
+        return patterns_.size();
+    }
+
+    const std::string &Pattern(uint32_t id) const
+    {
+        return patterns_[id];
+    }
+
+    /**
+     * @fn  size_t Utils_MultiSearch::StateCount(void) const
+     *
+     * @brief   自动机状态数  跳转表大小为 StateCount() * 字节类数 * 4 字节
+     */
+    size_t StateCount(void) const
+    {
+        return classes_ == 0 ? 0 : delta_.size() / classes_;
+    }
+
+    /**
+     * @fn  size_t Utils_MultiSearch::Scan(std::string_view text, MatchFn fn, void *ctx) const;
+     *
+     * @brief   单线程查找
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param           text    The text
+     * @param           fn      匹配回调
+     * @param [in,out]  ctx     回调上下文
+     *
+     * @return  回调的匹配数
+     */
+    size_t Scan(std::string_view text, MatchFn fn, void *ctx) const;
+
+    /**
+     * @fn  size_t Utils_MultiSearch::ScanParallel(std::string_view text, int threads, MatchFn fn, void *ctx) const;
+     *
+     * @brief   多线程查找  数据按字节均分后对齐到行首, 第 i 个线程的匹配都在第 i+1 个之前
+     *          * 回调会被多个线程同时调用, 用 worker 区分; 数据小于 1MB 时退化为单线程
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param           text    The text
+     * @param           threads 线程数 小于等于 0 时使用 CPU 核数
+     * @param           fn      匹配回调
+     * @param [in,out]  ctx     回调上下文
+     *
+     * @return  回调的匹配数
+     */
+    size_t ScanParallel(std::string_view text, int threads, MatchFn fn, void *ctx) const;
+
+    /**
+     * @fn  template<typename Fn> size_t Utils_MultiSearch::Scan(std::string_view text, Fn &&fn) const
+     *
+     * @brief   单线程查找  fn(const Utils_SearchMatch &) 返回 void 或 bool (false 停止)
+     */
+    template<typename Fn>
+    size_t Scan(std::string_view text, Fn &&fn) const
+    {
+        return Scan(text, &Utils_Detail::Invoke<std::remove_reference_t<Fn>, const Utils_SearchMatch &>, const_cast<void *>(static_cast<const void *>(&fn)));
+    }
+
+    /**
+     * @fn  template<typename Fn> size_t Utils_MultiSearch::ScanParallel(std::string_view text, int threads, Fn &&fn) const
+     *
+     * @brief   多线程查找  fn(const Utils_SearchMatch &, int worker) 返回 void 或 bool, 需要线程安全
+     */
+    template<typename Fn>
+    size_t ScanParallel(std::string_view text, int threads, Fn &&fn) const
+    {
+        return ScanParallel(text, threads, &Utils_Detail::Invoke<std::remove_reference_t<Fn>, const Utils_SearchMatch &>,
+                            const_cast<void *>(static_cast<const void *>(&fn)));
+    }
+
+    /**
+     * @fn  std::vector<Utils_SearchMatch> Utils_MultiSearch::FindAll(std::string_view text, int threads = 1) const;
+     *
+     * @brief   查找全部匹配  多线程时结果顺序与单线程相同
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param   text    The text
+     * @param   threads (Optional) 线程数 小于等于 0 时使用 CPU 核数
+     *
+     * @return  全部匹配
+     */
+    std::vector<Utils_SearchMatch> FindAll(std::string_view text, int threads = 1) const;
+
+    /**
+     * @fn  bool Utils_MultiSearch::FindAllInFile(const std::string &file, std::vector<Utils_SearchMatch> &out, int threads = 1) const;
+     *
+     * @brief   映射文件后查找全部匹配  pos 为文件偏移
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param           file    The file
+     * @param [in,out]  out     全部匹配
+     * @param           threads (Optional) 线程数 小于等于 0 时使用 CPU 核数
+     *
+     * @return  True if it succeeds, false 文件打开失败
+     */
+    bool FindAllInFile(const std::string &file, std::vector<Utils_SearchMatch> &out, int threads = 1) const;
+
+    /**
+     * @fn  bool Utils_MultiSearch::Contains(std::string_view text) const;
+     *
+     * @brief   是否包含任意一个模式  找到第一个即返回
+     */
+    bool Contains(std::string_view text) const;
+
+    private:
+
+    /**
+     * @fn  size_t Utils_MultiSearch::Run(const uint8_t *base, size_t from, size_t report, size_t to, MatchFn fn, void *ctx, int worker, std::atomic<bool> *stop) const;
+     *
+     * @brief   从 from 开始以初始状态扫描到 to, 只报告在 report 及之后结尾的匹配
+     */
+    size_t Run(const uint8_t *base, size_t from, size_t report, size_t to, MatchFn fn, void *ctx, int worker,
+               std::atomic<bool> *stop) const;
+
+    bool ignore_case_ = false;
+    bool built_ = false;
+    std::vector<std::string> patterns_;
+    size_t max_len_ = 0;
+
+    uint16_t class_[256] = {};          ///< 字节 -> 字节类, 0 为不在任何模式中出现的字节
+    uint32_t classes_ = 0;
+    std::vector<uint32_t> delta_;       ///< 跳转表 下标为 状态 * classes_ + 字节类, 值为目标状态 * classes_
+    uint32_t out_state_ = 0;            ///< 有输出的状态编号排在最后, 跳转结果不小于 out_state_ 时有匹配
+    std::vector<uint32_t> out_begin_;   ///< 状态的输出在 out_ 中的范围, 下标为 状态
+    std::vector<uint32_t> out_;         ///< 模式编号 包括经失败链继承的输出
+
+    uint8_t first_[4] = {};             ///< 可能的首字节 最多 3 个时启用跳跃
+    int first_count_ = 0;
+};
+
+#endif  // UTILS_SEARCH_H_
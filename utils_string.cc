@@ -8,13 +8,27 @@
 
 // 通用字符串操作类 
 #include "./utils_string.h"
+#include "./utils_format.h"
 #include <map>
 #include <stdlib.h>
 #include <algorithm>
 #include <sstream>
 #include <string.h>
+#include <stdint.h>
 #include <time.h>
 
+// x64 上 SSE2 必然存在, 其他平台回退到逐字节处理
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define UTILS_STRING_SSE2 1
+#endif
+
+// AVX2 需要编译选项打开 (/arch:AVX2, -mavx2), 目前只用于 Base64
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define UTILS_STRING_AVX2 1
+#endif
+
 /**
  * @fn  std::vector<std::string> Utils_String::Str2Vec(const std::string & str, const char separator, bool skip_empty)
  *
@@ -32,14 +46,7 @@
 std::vector<std::string> Utils_String::Str2Vec(const std::string & str, const char separator, bool skip_empty)
 {
     std::vector<std::string> res;
-    std::istringstream iss(str);
-    for (std::string item; getline(iss, item, separator);)
-    {
-        if (skip_empty && item.empty())
-            continue;
-        else
-            res.push_back(item);
-    }
+    Str2Vec(str, res, separator, skip_empty);
     return res;
 }
 
@@ -61,19 +68,7 @@ std::vector<std::string> Utils_String::Str2Vec(const std::string & str, const ch
 std::vector<std::string> Utils_String::Str2Vector(const std::string & str, const std::string & delimiters, bool skip_empty)
 {
     std::vector<std::string> res;
-    std::string::size_type pos, prev = 0;
-    while ((pos = str.find_first_of(delimiters, prev)) != std::string::npos)
-    {
-        if (pos > prev)
-        {
-            if (skip_empty && 1 == pos - prev)
-                break;
-            res.emplace_back(str, prev, pos - prev);
-        }
-        prev = pos + 1;
-    }
-    if (prev < str.size())
-        res.emplace_back(str, prev, str.size() - prev);
+    Str2Vector(str, res, delimiters, skip_empty);
     return res;
 }
 
@@ -112,11 +107,10 @@ const char* Utils_String::String2ConstChar(const std::string &str)
  */
 char * Utils_String::String2Char(const std::string & str)
 {
+    // 连同中间的 \0 和结尾的 \0 一起拷贝
     char *ch = new char[str.size() + 1];
-    strcpy(ch, str.c_str());
-
+    memcpy(ch, str.c_str(), str.size() + 1);
     return ch;
-
 }
 
 /**
@@ -180,56 +174,97 @@ std::string Utils_String::CharArr2String(char * buffer, int len)
 
 bool Utils_String::CharArr2String(std::string * str, char * buffer, int len)
 {
-    if (len == -1)
-    {
-        while (*buffer != '\0')
-        {
-            *str += *buffer;
-            buffer++;
-        }
-    }
-    else
-    {
-        while (len--)
-        {
-            *str += *buffer;
-            buffer++;
-        }
-    }
+    if (str == nullptr || buffer == nullptr)
+        return false;
+    str->append(buffer, len < 0 ? strlen(buffer) : static_cast<size_t>(len));
     return true;
 }
 
-std::string Utils_String::ShowCharArr(uchar * buffer, int len)
+/**
+ * @fn  static void AppendHexBytes(std::string &res, const uchar *buffer, size_t len)
+ *
+ * @brief   每个字节输出 "XX " 两位查表, 一次性扩容
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ *
+ * @param [in,out]  res     The result
+ * @param           buffer  The buffer
+ * @param           len     The length
+ */
+static void AppendHexBytes(std::string &res, const uchar *buffer, size_t len)
 {
-    std::string res = "";
-    if (len == -1)
+    const char *hex = Utils_Format::HexPairs(true);
+    size_t old = res.size();
+    res.resize(old + len * 3);
+    char *out = &res[old];
+    for (size_t i = 0; i < len; i++)
     {
-        while (*buffer != '\0')
-        {
-            res += UChar2Hex(*buffer++);
-            res += " ";
-        }
-    }
-    else
-    {
-        while (len--)
-        {
-            res += UChar2Hex(*buffer++) + " ";
-        }
+        memcpy(out + i * 3, hex + buffer[i] * 2, 2);
+        out[i * 3 + 2] = ' ';
     }
+}
+
+// 将 char arr 输出出来 显示  "68 13 00 " 的形式  len == -1 时到 \0 为止
+std::string Utils_String::ShowCharArr(uchar * buffer, int len)
+{
+    std::string res;
+    if (buffer == nullptr)
+        return res;
+    size_t n = len < 0 ? strlen(reinterpret_cast<const char *>(buffer)) : static_cast<size_t>(len);
+    AppendHexBytes(res, buffer, n);
     return res;
 }
 
 std::string Utils_String::ShowCharArr(const std::string * str)
 {
-    std::string res = "";
-    for (const auto &s : *str)
-    {
-        res += UChar2Hex(s) + " ";
-    }
+    std::string res;
+    if (str == nullptr)
+        return res;
+    AppendHexBytes(res, reinterpret_cast<const uchar *>(str->data()), str->size());
     return res;
 }
 
+/**
+ * @struct  HexNibbles
+ *
+ * @brief   hex 反查表  每个字符对应 Hex2Num(ch) 的值, 非法字符的结果也与 Hex2Num 相同
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+struct HexNibbles
+{
+    uchar v[256];
+};
+
+static constexpr HexNibbles MakeHexNibbles()
+{
+    HexNibbles t{};
+    for (int i = 0; i < 256; i++)
+        t.v[i] = static_cast<uchar>(Utils_String::Hex2Num(static_cast<char>(i)));
+    return t;
+}
+
+static constexpr HexNibbles kHexNibbles = MakeHexNibbles();
+
+// 从 src 开始 每 step 个字符取两位 hex, 共 count 个字节
+static void DecodeHexPairs(const char *src, size_t step, uchar *dst, size_t count)
+{
+    const uchar *s = reinterpret_cast<const uchar *>(src);
+    for (size_t i = 0; i < count; i++, s += step)
+        dst[i] = static_cast<uchar>((kHexNibbles.v[s[0]] << 4) | kHexNibbles.v[s[1]]);
+}
+
+// 解码后的字节数  第 3 个字符是空格时按有空格处理, 末尾不足两位的字符忽略
+static size_t HexDecodedSize(const std::string &str, bool flg_space, size_t &step)
+{
+    // 不足 3 个字符时 按 flg_space 处理
+    if (str.size() > 2 && str[2] == ' ')   flg_space = true;
+    step = flg_space ? 3 : 2;
+    return (flg_space ? (str.size() + 1) : str.size()) / step;
+}
+
 /**
  * @fn  std::string Utils_String::Hex2String(const std::string & str, bool flg_space)
  *
@@ -246,22 +281,10 @@ std::string Utils_String::ShowCharArr(const std::string * str)
  */
 std::string Utils_String::Hex2String(const std::string & str, bool flg_space)
 {
-    // 出错 只有两个值 默认不符合 操作
-    if (str.size() < 3)    return nullptr;
-    // 默认够长 判断是否存在空格
-    if (str[2] == ' ')   flg_space = true;
-    int step = flg_space ? 3 : 2;
-
-    int res_size = (flg_space?(str.size() + 1): str.size()) / step;
-    std::string res;
-    res.resize(res_size);
-
-    for (int i = 0; i < res_size;i++)
-    {
-        uchar ch = Hex2Uchar(str.substr(static_cast<size_t>(i*step), 2));
-        // 根据是否有空格选择 移动
-        res[i] = (char)ch;
-    }
+    size_t step;
+    size_t res_size = HexDecodedSize(str, flg_space, step);
+    std::string res(res_size, '\0');
+    DecodeHexPairs(str.data(), step, reinterpret_cast<uchar *>(&res[0]), res_size);
     return res;
 }
 
@@ -303,8 +326,12 @@ std::string Utils_String::UChar2String(uchar *buffer)
  */
 char * Utils_String::ConstChar2Char(const char* buffer)
 {
-    char* res = new char[100];  // 足够的长度避免溢出
-    strcpy(res, buffer);
+    if (buffer == nullptr)
+        return nullptr;
+    // 按实际长度分配, 原来固定 100 字节 超长时溢出
+    size_t len = strlen(buffer) + 1;
+    char *res = new char[len];
+    memcpy(res, buffer, len);
     return res;
 }
 
@@ -357,39 +384,27 @@ std::string Utils_String::AddQuoteString(std::string str, const std::string q)
     return (q + str + q);
 }
 
-/**
- * @fn  int Utils_String::StringVersionToInt(const std::string & str)
- *
- * @brief   将 1.1 这种转换成 int 版本号  1.1 == 101   10.11 == 1011
- *
- * @author  IRIS_Chen
- * @date    2019/11/28
- *
- * @param   str The string
- *
- * @return  An int
- */
-int Utils_String::StringVersionToInt(const std::string & str)
+void Utils_String::AppendQuoteString(std::string & dst, std::string_view str, char q)
 {
-    std::vector<std::string> tmp_str = Str2Vec(str, '.');
-    assert(tmp_str.size() == 2);
-    int res = 0;
-    for (const auto& s : tmp_str)
+    dst.reserve(dst.size() + str.size() + 2);
+    dst += q;
+    // 按引号分段拷贝
+    size_t pos = 0;
+    for (size_t hit = str.find(q); hit != std::string_view::npos; hit = str.find(q, pos))
     {
-        int tmp = std::stoi(s);
-        if (tmp < 0)
-            tmp = -tmp;
-        res = res * 100 + tmp;
+        dst.append(str.data() + pos, hit - pos + 1);
+        dst += q;
+        pos = hit + 1;
     }
-    return res;
+    dst.append(str.data() + pos, str.size() - pos);
+    dst += q;
 }
 
-
 /**
  * @fn  std::string Utils_String::NumToString(int num, int width, int base)
  *
- * @brief   Number to string 整型数据 前补 0 占位符显示 进制 为 8 10 16  \
- *  *       如果超过给出的宽度 原始宽度显示  16进制 大写输出
+ * @brief   Number to string 整型数据 前补 0 占位符显示 进制 为 2 - 36  \
+ *  *       如果超过给出的宽度 原始宽度显示  字母大写输出
  * * 
  *
  * @author  IRIS_Chen
@@ -403,60 +418,10 @@ int Utils_String::StringVersionToInt(const std::string & str)
  */
 std::string Utils_String::NumToString(int num, int width, int base)
 {
-
-#if 0
-    // 保证 存在进制 只考虑 2 8 , 10 16 进制
-    static std::map<int, char> t_base = {
-        { 2,'0' },
-        { 8,'o' },
-        { 10,'d' },
-        { 16,'x' } };
-    if (!t_base.count(base))
-        return "";
-    // 二进制 特殊处理
-    if (base == 2)
-    {
-        std::string str_8 = NumToString(num, width, 8);
-        //  设置8进制 转2进制码表, 转换之后 去除前缀0 即可
-        static const std::vector<std::string> table = { "000","001","010","011","100","101","110","111" };
-
-        std::string str_2 = "";
-        for (auto s : str_8)
-        {
-            if(s =='0')
-                continue;
-            str_2 += table[s - '0'];
-        }
-        // 去掉前面所有的 0值 从1 开始
-        int pos = static_cast<int>(str_2.find_first_of('1'));
-
-        // #TODO(Schen00) 处理, 得到的长度小于width 的情况
-        return pos == std::string::npos ?"":str_2.substr (pos);
-    }
-
-    std::string format = "%0" + std::to_string(width) + t_base.find(base)->second;
-
-    char *buf = new char[20];
-    sprintf(buf, format.c_str(), num);
-    return std::string(buf);
-#else
-
-    // 不限制进制, 暴力处理
-    std::string res = "";
-    while (num)
-    {
-        res = (base == 16 ? Num2Hex(num % base) : (char)(num % base + '0')) + res;
-        num /= base;
-    }
-    // 不足位 补0  足位 不删除
-    int cnt = width - res.size();
-    while (cnt-- > 0)
-    {
-        res = "0" + res;
-    }
+    // 两位查表 写入栈上缓冲区  0 输出 "0" 补零后 "000"  进制非法返回空
+    std::string res;
+    Utils_Format::AppendInt(res, num, width, base);
     return res;
-
-#endif
 }
 
 
@@ -477,70 +442,14 @@ std::string Utils_String::NumToString(int num, int width, int base)
  */
 std::string Utils_String::NumToString(const float &num, int precision)
 {
-    char *buf = new char[20];
-    std::string format_ = "%." + std::to_string(precision) + "f";
-    sprintf(buf, format_.c_str(), num);
-    return std::string(buf);
-}
-
-// 将字符串转换成数字 根据进制  "123" ==> 123  
-int Utils_String::String2Num(const std::string & str, int base)
-{
-    int res = 0;
-
-    for (const char &s : str)
-    {
-        res = res*base + (base == 16 ? Hex2Num(s) : s - '0');
-    }
+    std::string res;
+    Utils_Format::AppendFloat(res, num, precision);
     return res;
 }
 
 
 
 
-/**
- * @fn  uchar Utils_String::Hex2Uchar(const std::string & str)
- *
- * @brief   Hexadecimal 2 uchar 将两个 hex 字符 转换成 0-256
- *
- * @author  IRIS_Chen
- * @date    2019/12/18
- *
- * @param   str The string 默认初始两位字符  FF == 255   00 = 0  0D = 14
- *
- * @return  An uchar
- */
-uchar Utils_String::Hex2Uchar(const std::string & str)
-{
-    uchar res = 0;
-    for (const auto &s:str)
-    {
-        res = (res << 4) + Hex2Num(s);
-    }
-    return res;
-}
-
-/**
- * @fn  int Utils_String::Hex2Num(const char ch)
- *
- * @brief   根据 各种情况 转换字母  一位字母 大于 48 的 +9  然后取后4位的值
- * *        将 0-F 转换成 0-15
- *
- * @author  IRIS_Chen
- * @date    2019/12/16
- *
- * @param   ch  The ch
- *
- * @return  An int
- */
-int Utils_String::Hex2Num(const char ch)
-{
-    //int res = (ch & '@' ? ch + 9 : ch) & 0x0F;
-    //LInfo("ch:{},res:{}", ch, res);
-    return (ch & '@' ? ch + 9 : ch) & 0x0F;
-}
-
-
 
 /**
  * @fn  char Utils_String::Num2Hex(int num, bool Up )
@@ -582,35 +491,9 @@ char Utils_String::Num2Hex(int num, bool Up /* = true */)
  */
 std::string Utils_String::Num2Hex(uchar num, bool Up)
 {
-    std::string res= NumToString((int)num, 2, 16);
-    return Up ? StringUpper(res) : StringLowwer (res);
+    return std::string(Utils_Format::HexPairs(Up) + num * 2, 2);
 }
 
-/**
- * @fn  int Utils_String::Hex2Num(const std::string & str)
- *
- * @brief   连续的 16 进制字符 转换成数字 // 空格滤除
- *
- * @author  IRIS_Chen
- * @date    2019/12/16
- *
- * @param   str The string
- *
- * @return  An int
- */
-int Utils_String::Hex2Num(const std::string & str)
-{
-    int res = 0;
-    for (const auto &s : str)
-        if(s != ' ' )
-            res = (res << 4) + Hex2Num(s);
-    return res;
-}
-
-
-
-
-
 /**
  * @fn  uchar * Utils_String::Hex2CharArr(uchar *&buffer, const std::string & str, bool flg_space)
  *
@@ -627,30 +510,14 @@ int Utils_String::Hex2Num(const std::string & str)
  */
 uchar * Utils_String::Hex2CharArr(uchar *&buffer, const std::string & str, bool flg_space)
 {
-    // 出错 只有两个值 默认不符合 操作
-    if (str.size() < 3)    return nullptr;
-    // 默认够长 判断是否存在空格
-    if (str[2] == ' ')   flg_space = true;
-
-    int step = flg_space ? 3 : 2;
-
-    // 拓展空间 保证有足够的空间存储数组
-    buffer = new uchar[(str.size() + 1) / step + 1];
-
-    // std::string str2 = "";
-
-    for (int i = 0; i < static_cast<int>(str.size());i += step)
-    {
-        uchar ch = Hex2Uchar(str.substr(static_cast<size_t>(i), 2));
-        // 根据是否有空格选择 移动
-        *(buffer + i / step) = ch;
-
-        // str2 += std::to_string((int)ch) + "-";
-    }
-    // LInfo("charArr:{}", str2);
+    // 与 Hex2String 相同的解码  没有完整的两位时 返回 nullptr
+    size_t step;
+    size_t count = HexDecodedSize(str, flg_space, step);
+    if (count == 0)    return nullptr;
 
+    buffer = new uchar[count];
+    DecodeHexPairs(str.data(), step, buffer, count);
     return buffer;
-
 }
 
 #if 0
@@ -670,7 +537,7 @@ uchar * Utils_String::Hex2CharArr(uchar *buffer, const std::string & str, bool f
 
     for (int i = 0; i < static_cast<int>(str.size());)
     {
-        uchar ch = Hex2Uchar(str.substr(static_cast<size_t>(i), 2));
+        uchar ch = Hex2Uchar(std::string_view(str).substr(static_cast<size_t>(i), 2));
         // 根据是否有空格选择 移动
         *(buffer + i / step) = ch;
         i += step;
@@ -700,18 +567,276 @@ uchar * Utils_String::Hex2CharArr(uchar *buffer, const std::string & str, bool f
  */
 std::string Utils_String::CharArr2Hex(uchar * buffer, int length, int flg_space)
 {
-    std::string str = "";
-    // 读取数组中所有字符
-    for (int i = 0; i < length; i++)
+    std::string str;
+    if (buffer == nullptr || length <= 0)
+        return str;
+    // 如果开启空格的话  每两个字符 之间加入一个空格 最后一个不加
+    if (flg_space)
     {
-        str += Num2Hex(*buffer++);
-        // 如果开启空格的话  每两个字符 之间加入一个空格 最后一个不加
-        if (flg_space && i != length - 1)
-            str += " ";
+        AppendHexBytes(str, buffer, static_cast<size_t>(length));
+        str.pop_back();
+        return str;
     }
+    const char *hex = Utils_Format::HexPairs(true);
+    str.resize(static_cast<size_t>(length) * 2);
+    for (size_t i = 0; i < static_cast<size_t>(length); i++)
+        memcpy(&str[i * 2], hex + buffer[i] * 2, 2);
     return str;
 }
 
+/**
+ * @struct  Base64Table
+ *
+ * @brief   Base64 编码字母表 和 反查表, 反查表中非法字符为 0xFF
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+struct Base64Table
+{
+    char enc[64];
+    uint8_t dec[256];
+};
+
+static constexpr Base64Table MakeBase64Table(char c62, char c63)
+{
+    Base64Table t{};
+    for (int i = 0; i < 256; i++)
+        t.dec[i] = 0xFF;
+    for (int i = 0; i < 64; i++)
+    {
+        char c = i < 26 ? static_cast<char>('A' + i)
+            : i < 52 ? static_cast<char>('a' + i - 26)
+            : i < 62 ? static_cast<char>('0' + i - 52)
+            : i == 62 ? c62 : c63;
+        t.enc[i] = c;
+        t.dec[static_cast<uint8_t>(c)] = static_cast<uint8_t>(i);
+    }
+    return t;
+}
+
+static constexpr Base64Table kBase64Std = MakeBase64Table('+', '/');
+static constexpr Base64Table kBase64Url = MakeBase64Table('-', '_');
+
+#ifdef UTILS_STRING_AVX2
+/**
+ * @fn  static inline __m256i Base64EncodeBlock(const uint8_t *src, bool url)
+ *
+ * @brief   24 字节 -> 32 个 Base64 字符, 读取 src[0, 28)
+ *          * 每个 128 位通道取 12 字节, 按 [b1 b0 b2 b1] 重排, 乘法移位拆出 4 个 6 位索引
+ *          * 索引按区间 (A-Z a-z 0-9 + /) 查表得到偏移, 与索引相加即为字符
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ *
+ * @param   src Source data
+ * @param   url True 使用 URL-safe 字母表
+ *
+ * @return  32 个字符
+ */
+static inline __m256i Base64EncodeBlock(const uint8_t *src, bool url)
+{
+    __m256i in = _mm256_inserti128_si256(
+        _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src))),
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 12)), 1);
+    in = _mm256_shuffle_epi8(in, _mm256_setr_epi8(
+        1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+        1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+
+    __m256i t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00));
+    __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+    __m256i t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0));
+    __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+    __m256i idx = _mm256_or_si256(t1, t3);
+
+    // 0-25 -> 0, 26-51 -> 1, 52-61 -> 2..11, 62 -> 12, 63 -> 13
+    __m256i sel = _mm256_subs_epu8(idx, _mm256_set1_epi8(51));
+    sel = _mm256_sub_epi8(sel, _mm256_cmpgt_epi8(idx, _mm256_set1_epi8(25)));
+    const char c62 = static_cast<char>((url ? '-' : '+') - 62);
+    const char c63 = static_cast<char>((url ? '_' : '/') - 63);
+    const __m256i lut = _mm256_setr_epi8(
+        65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, c62, c63, 0, 0,
+        65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, c62, c63, 0, 0);
+    return _mm256_add_epi8(idx, _mm256_shuffle_epi8(lut, sel));
+}
+
+/**
+ * @fn  static inline bool Base64DecodeBlock(const char *src, uint8_t *dst, bool url)
+ *
+ * @brief   32 个 Base64 字符 -> 24 字节, 遇到非法字符 (包括 '=') 返回 false 且不写 dst
+ *          * 按高低半字节两次查表做合法性检查, 再按高半字节查表得到每个字符的偏移
+ *          * URL-safe 先将 '-' '_' 与 '+' '/' 互换, 复用标准表
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ *
+ * @param           src Source characters
+ * @param [in,out]  dst 写入 24 字节
+ * @param           url True 使用 URL-safe 字母表
+ *
+ * @return  True if it succeeds, false if it fails
+ */
+static inline bool Base64DecodeBlock(const char *src, uint8_t *dst, bool url)
+{
+    const __m256i mask_2f = _mm256_set1_epi8(0x2f);
+    __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src));
+    if (url)
+    {
+        // '+' <-> '-', '/' <-> '_' 互换, 输入中的 '+' '/' 变成非法字符
+        __m256i pm = _mm256_or_si256(_mm256_cmpeq_epi8(in, _mm256_set1_epi8('+')),
+                                     _mm256_cmpeq_epi8(in, _mm256_set1_epi8('-')));
+        __m256i su = _mm256_or_si256(_mm256_cmpeq_epi8(in, mask_2f),
+                                     _mm256_cmpeq_epi8(in, _mm256_set1_epi8('_')));
+        in = _mm256_xor_si256(in, _mm256_and_si256(pm, _mm256_set1_epi8('+' ^ '-')));
+        in = _mm256_xor_si256(in, _mm256_and_si256(su, _mm256_set1_epi8('/' ^ '_')));
+    }
+
+    const __m256i lut_lo = _mm256_setr_epi8(
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+    const __m256i lut_hi = _mm256_setr_epi8(
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    const __m256i lut_roll = _mm256_setr_epi8(
+        0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+
+    __m256i hi_nibbles = _mm256_and_si256(_mm256_srli_epi32(in, 4), mask_2f);
+    __m256i lo_nibbles = _mm256_and_si256(in, mask_2f);
+    __m256i hi = _mm256_shuffle_epi8(lut_hi, hi_nibbles);
+    __m256i lo = _mm256_shuffle_epi8(lut_lo, lo_nibbles);
+    if (!_mm256_testz_si256(lo, hi))
+        return false;
+
+    __m256i eq_2f = _mm256_cmpeq_epi8(in, mask_2f);
+    __m256i roll = _mm256_shuffle_epi8(lut_roll, _mm256_add_epi8(eq_2f, hi_nibbles));
+    __m256i v = _mm256_add_epi8(in, roll);
+
+    // 4 个 6 位 -> 3 字节, 每个通道 12 字节, 再拼到低 24 字节
+    v = _mm256_maddubs_epi16(v, _mm256_set1_epi32(0x01400140));
+    v = _mm256_madd_epi16(v, _mm256_set1_epi32(0x00011000));
+    v = _mm256_shuffle_epi8(v, _mm256_setr_epi8(
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+    v = _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm256_castsi256_si128(v));
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(dst + 16), _mm256_extracti128_si256(v, 1));
+    return true;
+}
+#endif
+
+size_t Utils_String::Base64Encode(const void * src, size_t len, char * dst, bool url)
+{
+    const char *enc = url ? kBase64Url.enc : kBase64Std.enc;
+    const uint8_t *s = static_cast<const uint8_t *>(src);
+    char *d = dst;
+    size_t i = 0;
+#ifdef UTILS_STRING_AVX2
+    for (; i + 28 <= len; i += 24, d += 32)
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(d), Base64EncodeBlock(s + i, url));
+#endif
+    for (; i + 3 <= len; i += 3, d += 4)
+    {
+        uint32_t v = (uint32_t(s[i]) << 16) | (uint32_t(s[i + 1]) << 8) | s[i + 2];
+        d[0] = enc[v >> 18];
+        d[1] = enc[(v >> 12) & 0x3F];
+        d[2] = enc[(v >> 6) & 0x3F];
+        d[3] = enc[v & 0x3F];
+    }
+    if (i < len)
+    {
+        uint32_t v = uint32_t(s[i]) << 16;
+        if (i + 1 < len)
+            v |= uint32_t(s[i + 1]) << 8;
+        *d++ = enc[v >> 18];
+        *d++ = enc[(v >> 12) & 0x3F];
+        if (i + 1 < len)
+            *d++ = enc[(v >> 6) & 0x3F];
+        else if (!url)
+            *d++ = '=';
+        if (!url)
+            *d++ = '=';
+    }
+    return static_cast<size_t>(d - dst);
+}
+
+bool Utils_String::Base64Decode(std::string_view src, void * dst, size_t * out_len, bool url)
+{
+    const uint8_t *dec = url ? kBase64Url.dec : kBase64Std.dec;
+    size_t n = src.size();
+    size_t pad = 0;
+    if (n > 0 && src[n - 1] == '=')
+        pad = (n > 1 && src[n - 2] == '=') ? 2 : 1;
+    // 有 '=' 时必须补齐到 4 的倍数, 标准模式必须有 '='
+    if ((pad > 0 || !url) && n % 4 != 0)
+        return false;
+    n -= pad;
+    if (n % 4 == 1)
+        return false;
+
+    const uint8_t *s = reinterpret_cast<const uint8_t *>(src.data());
+    uint8_t *d = static_cast<uint8_t *>(dst);
+    size_t i = 0;
+#ifdef UTILS_STRING_AVX2
+    // 遇到非法字符时退出, 由下面的逐个处理确认并返回 false
+    for (; i + 32 <= n; i += 32, d += 24)
+    {
+        if (!Base64DecodeBlock(src.data() + i, d, url))
+            break;
+    }
+#endif
+    for (; i + 4 <= n; i += 4, d += 3)
+    {
+        uint32_t a = dec[s[i]], b = dec[s[i + 1]], c = dec[s[i + 2]], e = dec[s[i + 3]];
+        if ((a | b | c | e) & 0x80)
+            return false;
+        uint32_t v = (a << 18) | (b << 12) | (c << 6) | e;
+        d[0] = static_cast<uint8_t>(v >> 16);
+        d[1] = static_cast<uint8_t>(v >> 8);
+        d[2] = static_cast<uint8_t>(v);
+    }
+    // 剩余 2 或 3 个字符, 未使用的低位必须为 0
+    if (i < n)
+    {
+        uint32_t a = dec[s[i]], b = dec[s[i + 1]];
+        uint32_t c = (i + 2 < n) ? dec[s[i + 2]] : 0;
+        if ((a | b | c) & 0x80)
+            return false;
+        *d++ = static_cast<uint8_t>((a << 2) | (b >> 4));
+        if (i + 2 < n)
+        {
+            if (c & 0x03)
+                return false;
+            *d++ = static_cast<uint8_t>((b << 4) | (c >> 2));
+        }
+        else if (b & 0x0F)
+            return false;
+    }
+    if (out_len != nullptr)
+        *out_len = static_cast<size_t>(d - static_cast<uint8_t *>(dst));
+    return true;
+}
+
+std::string Utils_String::Base64Encode(std::string_view src, bool url)
+{
+    std::string res(Base64EncodeSize(src.size(), url), '\0');
+    Base64Encode(src.data(), src.size(), &res[0], url);
+    return res;
+}
+
+bool Utils_String::Base64Decode(std::string_view src, std::string & dst, bool url)
+{
+    dst.resize(Base64DecodeSize(src.size()));
+    size_t len = 0;
+    if (!Base64Decode(src, &dst[0], &len, url))
+    {
+        dst.clear();
+        return false;
+    }
+    dst.resize(len);
+    return true;
+}
+
 
 
 /**
@@ -728,14 +853,8 @@ std::string Utils_String::CharArr2Hex(uchar * buffer, int length, int flg_space)
  */
 std::string Utils_String::StringUpper(const std::string & str)
 {
-    std::string res = "";
-    for (const auto &s : str)
-    {
-        if (s >= 'a' &&s <= 'z')
-            res += s - 32;
-        else
-            res += s;
-    }
+    std::string res(str);
+    StringUpperInPlace(res);
     return res;
 }
 
@@ -753,15 +872,161 @@ std::string Utils_String::StringUpper(const std::string & str)
  */
 std::string Utils_String::StringLowwer(const std::string & str)
 {
-    std::string res = "";
-    for (const auto &s : str)
+    std::string res(str);
+    StringLowwerInPlace(res);
+    return res;
+}
+
+/**
+ * @fn  static inline void CaseConvert(const char *src, char *dst, size_t len, char first)
+ *
+ * @brief   ASCII 大小写转换的公共实现, first 为 'A' 时转小写, 为 'a' 时转大写
+ *          * 将 [first, first+25] 平移到 int8 的最小值附近, 一次有符号比较得到掩码, 异或 0x20
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ *
+ * @param           src     Source buffer
+ * @param [in,out]  dst     Destination buffer
+ * @param           len     The length
+ * @param           first   需要翻转的字母区间起点
+ */
+static inline void CaseConvert(const char *src, char *dst, size_t len, char first)
+{
+    size_t i = 0;
+#ifdef UTILS_STRING_SSE2
+    const __m128i shift = _mm_set1_epi8(static_cast<char>(0x80 - first));
+    const __m128i limit = _mm_set1_epi8(static_cast<char>(-128 + 26));
+    const __m128i flip = _mm_set1_epi8(0x20);
+    for (; i + 16 <= len; i += 16)
     {
-        if (s >= 'A' &&s <= 'Z')
-            res += s + 32;
-        else
-            res += s;
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        __m128i in_range = _mm_cmplt_epi8(_mm_add_epi8(v, shift), limit);
+        v = _mm_xor_si128(v, _mm_and_si128(in_range, flip));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), v);
     }
-    return res;
+#endif
+    for (; i < len; i++)
+    {
+        char c = src[i];
+        dst[i] = (c >= first && c <= first + 25) ? static_cast<char>(c ^ 0x20) : c;
+    }
+}
+
+/**
+ * @fn  static inline uint64_t LowwerWord(uint64_t x)
+ *
+ * @brief   SWAR 一次将 8 个字节中的 ASCII 大写字母转换成小写, 非 ASCII 字节不变
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ *
+ * @param   x   8 个字节
+ *
+ * @return  转换之后的 8 个字节
+ */
+static inline uint64_t LowwerWord(uint64_t x)
+{
+    const uint64_t ones = 0x0101010101010101ULL;
+    const uint64_t high = 0x8080808080808080ULL;
+    uint64_t heptets = x & (ones * 0x7F);
+    uint64_t ge_A = heptets + ones * (0x80 - 'A');   // >= 'A' 时最高位置 1
+    uint64_t gt_Z = heptets + ones * (0x7F - 'Z');   // >  'Z' 时最高位置 1
+    uint64_t upper = (ge_A ^ gt_Z) & ~x & high;
+    return x | (upper >> 2);
+}
+
+static inline uint64_t LoadWord(const char *p, size_t n)
+{
+    uint64_t w = 0;
+    memcpy(&w, p, n);
+    return w;
+}
+
+// 大小写转换 in place 和 写入缓冲区  不分配内存
+void Utils_String::StringUpperInPlace(std::string & str)
+{
+    CaseConvert(str.data(), &str[0], str.size(), 'a');
+}
+
+void Utils_String::StringLowwerInPlace(std::string & str)
+{
+    CaseConvert(str.data(), &str[0], str.size(), 'A');
+}
+
+void Utils_String::StringUpper(const char * src, char * dst, size_t len)
+{
+    CaseConvert(src, dst, len, 'a');
+}
+
+void Utils_String::StringLowwer(const char * src, char * dst, size_t len)
+{
+    CaseConvert(src, dst, len, 'A');
+}
+
+/**
+ * @fn  bool Utils_String::StringEqualNoCase(std::string_view a, std::string_view b)
+ *
+ * @brief   忽略大小写比较 每次比较 8 字节, 不生成副本
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ *
+ * @param   a   The first string
+ * @param   b   The second string
+ *
+ * @return  True if equal ignoring case, false if not
+ */
+bool Utils_String::StringEqualNoCase(std::string_view a, std::string_view b)
+{
+    if (a.size() != b.size())
+        return false;
+    size_t n = a.size(), i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        if (LowwerWord(LoadWord(a.data() + i, 8)) != LowwerWord(LoadWord(b.data() + i, 8)))
+            return false;
+    }
+    if (i == n)
+        return true;
+    return LowwerWord(LoadWord(a.data() + i, n - i)) == LowwerWord(LoadWord(b.data() + i, n - i));
+}
+
+bool Utils_String::StringStartsWithNoCase(std::string_view str, std::string_view prefix)
+{
+    return str.size() >= prefix.size() && StringEqualNoCase(str.substr(0, prefix.size()), prefix);
+}
+
+/**
+ * @fn  size_t Utils_String::StringHashNoCase(std::string_view str)
+ *
+ * @brief   忽略大小写的哈希  每 8 字节转小写后 乘法混合, 最后加入长度做雪崩
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ *
+ * @param   str The string
+ *
+ * @return  The hash value
+ */
+size_t Utils_String::StringHashNoCase(std::string_view str)
+{
+    const uint64_t prime = 0x9E3779B97F4A7C15ULL;
+    uint64_t h = 0xCBF29CE484222325ULL ^ (str.size() * prime);
+    size_t n = str.size(), i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        h = (h ^ LowwerWord(LoadWord(str.data() + i, 8))) * prime;
+        h ^= h >> 29;
+    }
+    if (i < n)
+    {
+        h = (h ^ LowwerWord(LoadWord(str.data() + i, n - i))) * prime;
+    }
+    h ^= h >> 32;
+    h *= 0xD6E8FEB86659FD93ULL;
+    h ^= h >> 32;
+    return static_cast<size_t>(h);
 }
 
 /**
@@ -824,6 +1089,40 @@ uchar Utils_String::Commu_CheckSum(uchar * dat, int len)
     return res;
 }
 
+/**
+ * @struct  Crc16Table
+ *
+ * @brief   CRC16 Modbus 的 256 项查表 编译期生成
+ */
+struct Crc16Table
+{
+    unsigned short v[256];
+    constexpr Crc16Table() : v()
+    {
+        for (int i = 0; i < 256; i++)
+        {
+            unsigned short crc = static_cast<unsigned short>(i);
+            for (int j = 0; j < 8; j++)
+                crc = (crc & 1) ? static_cast<unsigned short>((crc >> 1) ^ 0xA001) : static_cast<unsigned short>(crc >> 1);
+            v[i] = crc;
+        }
+    }
+};
+
+static constexpr Crc16Table kCrc16;
+
+unsigned short Utils_String::Commu_CheckCRC16(const uchar * dat, int len)
+{
+    unsigned short crc = 0xFFFF;
+    if (dat == nullptr || len < 1)
+        return crc;
+    for (int i = 0; i < len; i++)
+    {
+        crc = static_cast<unsigned short>((crc >> 8) ^ kCrc16.v[(crc ^ dat[i]) & 0xFF]);
+    }
+    return crc;
+}
+
 /**
  * @fn  uchar Utils_String::Commu_CheckXOR(const std::string & str)
  *
@@ -11,8 +11,11 @@
 
 #include <vector>
 #include <string>
+#include <string_view>
 #include <iostream>
 
+#include "./utils_format.h"
+
 /**
  * @class   Utils_String utils_string.h Code\utils\utils_string.h
  *
@@ -28,60 +31,45 @@ class Utils_String
     // 将vector 里面的内容转换成 字符串字符流输出
     template<typename T>
     /**
-     * @fn  static void Utils_String::CoutVectorIdx(T & vec,bool new_line = true)
+     * @fn  static void Utils_String::CoutVectorIdx(const T & vec,bool new_line = true, const Utils_Format::Sink &sink = Utils_Format::StdoutSink())
      *
-     * @brief   Cout vector index
+     * @brief   Cout vector index  经过 Utils_Format::PrintRange 流式输出, 不再整体拼接字符串
      *
      * @author  IRIS_Chen
      * @date    2019/12/25
      *
-     * @param [in,out]  vec         The vector
-     * @param           new_line    (Optional) True to new line
+     * @param   vec         The vector
+     * @param   new_line    (Optional) True to new line
+     * @param   sink        (Optional) 输出目标 默认 stdout, 也可以是文件 或 LogSink()
      */
-    static void CoutVectorIdx(T & vec,bool new_line = true)
+    static void CoutVectorIdx(const T & vec, bool new_line = true, const Utils_Format::Sink &sink = Utils_Format::StdoutSink())
     {
-        std::ostringstream buffer;
-        size_t n = vec.size();
-        std::string new_line_char = new_line ? "\n" : "";
-        if (n == 0)
-        {
-            buffer << "Vector is Null";
-        }
-        else
-        {
-            for (int i = 0; i < n; i++)
-                buffer << "\tidx:" << i << "\t:" << vec[i] << new_line_char;
-        }
-        std::cout << buffer.str() << endl;
+        Utils_Format::PrintOptions opt;
+        opt.index = true;
+        opt.index_prefix = "\tidx:";
+        opt.index_suffix = "\t:";
+        opt.sep = new_line ? "\n" : "";
+        Utils_Format::Print(sink, vec, opt);
     }
 
     template<typename T>
     /**
-     * @fn  static void Utils_String::CoutVector(T & vec, bool new_line = true)
+     * @fn  static void Utils_String::CoutVector(const T & vec, bool new_line = true, const Utils_Format::Sink &sink = Utils_Format::StdoutSink())
      *
-     * @brief   Cout vector
+     * @brief   Cout vector  经过 Utils_Format::PrintRange 流式输出, 不再整体拼接字符串
      *
      * @author  IRIS_Chen
      * @date    2019/12/25
      *
-     * @param [in,out]  vec         The vector
-     * @param           new_line    (Optional) True to new line
+     * @param   vec         The vector
+     * @param   new_line    (Optional) True to new line
+     * @param   sink        (Optional) 输出目标 默认 stdout
      */
-    static void CoutVector(T & vec, bool new_line = true)
+    static void CoutVector(const T & vec, bool new_line = true, const Utils_Format::Sink &sink = Utils_Format::StdoutSink())
     {
-        std::ostringstream buffer;
-        size_t n = vec.size();
-        std::string new_line_char = new_line ? "\n" : " ";
-        if (n == 0)
-        {
-            buffer << "Vector is Null";
-        }
-        else
-        {
-            for (int i = 0; i < n; i++)
-                buffer << vec[i] << new_line_char;
-        }
-        std::cout << buffer.str() << endl;
+        Utils_Format::PrintOptions opt;
+        opt.sep = new_line ? "\n" : " ";
+        Utils_Format::Print(sink, vec, opt);
     }
 
 
@@ -109,13 +97,16 @@ class Utils_String
                            const char separator,
                            bool skip_empty = true)  ///< True to skip empty
     {
-        std::istringstream iss(str);
-        for (std::string item; getline(iss, item, separator);)
+        // 与 getline 一致: 末尾的分割符不产生空元素
+        size_t prev = 0;
+        while (prev < str.size())
         {
-            if (skip_empty && item.empty())
-                continue;
-            else
-                elem.push_back(item);
+            size_t pos = str.find(separator, prev);
+            if (pos == std::string::npos)
+                pos = str.size();
+            if (pos > prev || !skip_empty)
+                elem.emplace_back(str.substr(prev, pos - prev));
+            prev = pos + 1;
         }
         return elem;
     }
@@ -164,16 +155,12 @@ class Utils_String
         std::string::size_type pos, prev = 0;
         while ((pos = str.find_first_of(delimiters, prev)) != std::string::npos)
         {
-            if (pos > prev)
-            {
-                if (skip_empty && 1 == pos - prev)
-                    break;
-                elem.emplace_back(str, prev, pos - prev);
-            }
+            if (pos > prev || !skip_empty)
+                elem.emplace_back(str.substr(prev, pos - prev));
             prev = pos + 1;
         }
         if (prev < str.size())
-            elem.emplace_back(str, prev, str.size() - prev);
+            elem.emplace_back(str.substr(prev));
         return elem;
     }
 
@@ -211,7 +198,7 @@ class Utils_String
     /**
      * @fn  static char* Utils_String::String2Char(const std::string &str);
      *
-     * @brief   String 2 character
+     * @brief   String 2 character  new[] 分配, 调用者负责 delete[]
      *
      * @author  IRIS_Chen
      * @date    2019/12/25
@@ -292,7 +279,7 @@ class Utils_String
      */
     static bool CharArr2String(std::string *str, char *buffer, int len = -1);
 
-    // 将 char arr 输出出来 显示
+    // 将 char arr 输出出来 显示 "68 13 00 " 的形式, 大段数据使用 Utils_Format::HexDump
     static std::string ShowCharArr(uchar* buffer, int len = -1);
     static std::string ShowCharArr(const std::string *str);
 
@@ -300,7 +287,7 @@ class Utils_String
     /**
      * @fn  static std::string Utils_String::Hex2String(const std::string &str, bool flg_space = true);
      *
-     * @brief   将 hex 字符串转换成 string 字符串
+     * @brief   将 hex 字符串转换成 string 字符串  第三个字符为空格时按 "XX " 解析, 末尾不足两位的忽略
      *
      * @author  IRIS_Chen
      * @date    2019/12/25
@@ -342,7 +329,7 @@ class Utils_String
     /**
      * @fn  static char Utils_String::*ConstChar2Char(const char* buffer);
      *
-     * @brief   Constant character 2 character
+     * @brief   Constant character 2 character  按长度 new[] 分配, 调用者负责 delete[]
      *
      * @author  IRIS_Chen
      * @date    2019/12/25
@@ -413,18 +400,174 @@ class Utils_String
     static std::string AddQuoteString(std::string str,const std::string q = "\"");
 
     /**
-     * @fn  static int Utils_String::StringVersionToInt(const std::string &str);
+     * @fn  static void Utils_String::AppendQuoteString(std::string &dst, std::string_view str, char q = '"');
+     *
+     * @brief   AddQuoteString 的转义版本 追加到 dst, 字符串中的引号写成两个 (CSV RFC 4180)
+     *          * a"b -> "a""b"
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param [in,out]  dst Destination
+     * @param           str The string
+     * @param           q   (Optional) 引号
+     */
+    static void AppendQuoteString(std::string &dst, std::string_view str, char q = '"');
+
+    /**
+     * @fn  static constexpr int Utils_String::DigitValue(const char ch)
      *
-     * @brief   string 1.1 版本 生成 版本号 数字
+     * @brief   字符对应的数值 '0'-'9' 'a'-'z' 'A'-'Z' 对应 0-35, 其他字符返回 -1
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param   ch  The ch
+     *
+     * @return  0-35, 非法字符 -1
+     */
+    static constexpr int DigitValue(const char ch)
+    {
+        return (ch >= '0' && ch <= '9') ? ch - '0'
+            : (ch >= 'a' && ch <= 'z') ? ch - 'a' + 10
+            : (ch >= 'A' && ch <= 'Z') ? ch - 'A' + 10
+            : -1;
+    }
+
+    /**
+     * @fn  static constexpr int Utils_String::StringVersionToInt(std::string_view str, int depth = 0)
+     *
+     * @brief   string 1.1 版本 生成 版本号 数字  1.1 == 101   10.11 == 1011   1.2.3 == 10203
+     *          * 每一级占两位十进制, 允许前缀 v/V, 遇到 '.' 和数字以外的字符结束 (1.2.3-rc1 == 10203)
+     *          * depth > 0 时 补齐或截断到 depth 级, 便于不同级数的版本比较  ("1.2", 3) == 10200
+     *          * 编译期可用: static_assert(Utils_String::StringVersionToInt("1.1") == 101, "");
      *
      * @author  IRIS_Chen
      * @date    2019/12/3
      *
+     * @param   str     The string
+     * @param   depth   (Optional) 级数 0 表示按字符串实际级数
+     *
+     * @return  版本号 数字, 字符串不是版本号 某一级超过 99 或结果超过 int 时返回 -1
+     */
+    static constexpr int StringVersionToInt(std::string_view str, int depth = 0)
+    {
+        // 每一级不超过 99, 结果不超过 int  否则返回 -1
+        constexpr long long kMax = 0x7FFFFFFF;
+        size_t i = 0;
+        if (i < str.size() && (str[i] == 'v' || str[i] == 'V'))
+            i++;
+        long long res = 0;
+        int level = 0, part = 0;
+        bool has_digit = false;
+        for (; i < str.size(); i++)
+        {
+            char c = str[i];
+            if (c >= '0' && c <= '9')
+            {
+                part = part * 10 + (c - '0');
+                if (part > 99)
+                    return -1;
+                has_digit = true;
+            }
+            else if (c == '.' && has_digit)
+            {
+                if (depth <= 0 || level < depth)
+                    res = res * 100 + part;
+                if (res > kMax)
+                    return -1;
+                level++;
+                part = 0;
+                has_digit = false;
+            }
+            else
+            {
+                break;
+            }
+        }
+        // 结尾的 "1." 视为 "1.0"
+        if (!has_digit && level == 0)
+            return -1;
+        if (depth <= 0 || level < depth)
+            res = res * 100 + part;
+        level++;
+        for (; depth > 0 && level < depth && res <= kMax; level++)
+            res *= 100;
+        return res > kMax ? -1 : static_cast<int>(res);
+    }
+
+    /**
+     * @struct  Version
+     *
+     * @brief   任意级数的版本号 (最多 8 级), 用于编译期的版本判断
+     *          * static_assert(Utils_String::ParseVersion("1.10.0") > Utils_String::ParseVersion("1.9"), "");
+     */
+    struct Version
+    {
+        int part[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };    ///< 各级版本号
+        int depth = 0;      ///< 实际级数 0 表示解析失败
+
+        constexpr int Compare(const Version &other) const
+        {
+            for (int i = 0; i < 8; i++)
+            {
+                if (part[i] != other.part[i])
+                    return part[i] < other.part[i] ? -1 : 1;
+            }
+            return 0;
+        }
+        friend constexpr bool operator==(const Version &a, const Version &b) { return a.Compare(b) == 0; }
+        friend constexpr bool operator!=(const Version &a, const Version &b) { return a.Compare(b) != 0; }
+        friend constexpr bool operator<(const Version &a, const Version &b) { return a.Compare(b) < 0; }
+        friend constexpr bool operator>(const Version &a, const Version &b) { return a.Compare(b) > 0; }
+        friend constexpr bool operator<=(const Version &a, const Version &b) { return a.Compare(b) <= 0; }
+        friend constexpr bool operator>=(const Version &a, const Version &b) { return a.Compare(b) >= 0; }
+    };
+
+    /**
+     * @fn  static constexpr Version Utils_String::ParseVersion(std::string_view str)
+     *
+     * @brief   解析 "v1.2.3" 形式的版本号, 规则同 StringVersionToInt, 每一级不限两位, 超过 int 时解析失败
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
      * @param   str The string
      *
-     * @return  An int
+     * @return  A Version, 解析失败 depth == 0
      */
-    static int StringVersionToInt(const std::string &str);
+    static constexpr Version ParseVersion(std::string_view str)
+    {
+        Version v;
+        size_t i = 0;
+        if (i < str.size() && (str[i] == 'v' || str[i] == 'V'))
+            i++;
+        bool has_digit = false;
+        for (; i < str.size() && v.depth < 8; i++)
+        {
+            char c = str[i];
+            if (c >= '0' && c <= '9')
+            {
+                // 超过 int 时解析失败
+                if (v.part[v.depth] > (0x7FFFFFFF - (c - '0')) / 10)
+                    return Version();
+                v.part[v.depth] = v.part[v.depth] * 10 + (c - '0');
+                has_digit = true;
+            }
+            else if (c == '.' && has_digit)
+            {
+                v.depth++;
+                has_digit = false;
+            }
+            else
+            {
+                break;
+            }
+        }
+        if (has_digit && v.depth < 8)
+            v.depth++;
+        return v;
+    }
 
     /**
      * @fn  static std::string Utils_String::NumToString(int num, int width = 3,int base=10);
@@ -457,8 +600,39 @@ class Utils_String
      */
     static std::string NumToString(const float &num, int precision);
 
-    // 默认10字符串转换成数字
-    static int String2Num(const std::string &str, int base = 10);
+    /**
+     * @fn  static constexpr int Utils_String::String2Num(std::string_view str, int base = 10)
+     *
+     * @brief   默认10 字符串转换成数字  进制 2-36, 允许前导 '-', 遇到非法字符停止
+     *          * 编译期可用: constexpr int kBaud = Utils_String::String2Num("115200");
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param   str     The string
+     * @param   base    (Optional) The base
+     *
+     * @return  An int, 进制非法返回 0
+     */
+    static constexpr int String2Num(std::string_view str, int base = 10)
+    {
+        if (base < 2 || base > 36)
+            return 0;
+        size_t i = 0;
+        bool neg = false;
+        if (i < str.size() && (str[i] == '-' || str[i] == '+'))
+            neg = (str[i++] == '-');
+        // 无符号累加 超长输入按 2^64 回绕, 不溢出
+        unsigned long long res = 0;
+        for (; i < str.size(); i++)
+        {
+            int d = DigitValue(str[i]);
+            if (d < 0 || d >= base)
+                break;
+            res = res * static_cast<unsigned>(base) + static_cast<unsigned>(d);
+        }
+        return static_cast<int>(neg ? 0 - res : res);
+    }
 
     /**
      * @def Utils_String::Num2Str
@@ -471,7 +645,7 @@ class Utils_String
     #define Num2Str NumToString
 
     /**
-     * @fn  static uchar Utils_String::Hex2Uchar(const std::string &str);
+     * @fn  static constexpr uchar Utils_String::Hex2Uchar(std::string_view str)
      *
      * @brief   将两位 hex 值计算得到 int 值
      *
@@ -482,12 +656,19 @@ class Utils_String
      *
      * @return  An uchar
      */
-    static uchar Hex2Uchar(const std::string &str);
+    static constexpr uchar Hex2Uchar(std::string_view str)
+    {
+        uchar res = 0;
+        for (char s : str)
+            res = static_cast<uchar>((res << 4) + Hex2Num(s));
+        return res;
+    }
 
     /**
-     * @fn  static int Utils_String::Hex2Num(const char ch);
+     * @fn  static constexpr int Utils_String::Hex2Num(const char ch)
      *
      * @brief   将一位hex 16进制值 转化为 数字
+     *          * 一位字母 大于 48 的 +9  然后取后4位的值  将 0-F 转换成 0-15
      *
      * @author  IRIS_Chen
      * @date    2019/12/18
@@ -496,7 +677,10 @@ class Utils_String
      *
      * @return  An int
      */
-    static int Hex2Num(const char ch);
+    static constexpr int Hex2Num(const char ch)
+    {
+        return (ch & '@' ? ch + 9 : ch) & 0x0F;
+    }
     #define Char2Num Hex2Num        // 针对一位的数据
 
     /**
@@ -540,9 +724,9 @@ class Utils_String
     #define  UChar2Hex Num2Hex
 
     /**
-     * @fn  static int Utils_String::Hex2Num(const std::string &str);
+     * @fn  static constexpr int Utils_String::Hex2Num(std::string_view str)
      *
-     * @brief   将字符串按照16进制转换成数字
+     * @brief   将字符串按照16进制转换成数字  空格滤除, 编译期可用
      *
      * @author  IRIS_Chen
      * @date    2019/12/18
@@ -551,7 +735,16 @@ class Utils_String
      *
      * @return  An int
      */
-    static int Hex2Num(const std::string &str);
+    static constexpr int Hex2Num(std::string_view str)
+    {
+        unsigned res = 0;
+        for (char s : str)
+        {
+            if (s != ' ')
+                res = (res << 4) + static_cast<unsigned>(Hex2Num(s));
+        }
+        return static_cast<int>(res);
+    }
 
     /**
      * @fn  static uchar * Utils_String::Hex2CharArr(uchar *&buffer, const std::string &str, bool flg_space = true);
@@ -585,6 +778,108 @@ class Utils_String
      */
     static std::string CharArr2Hex(uchar *buffer, int length = 16, int flg_space = 1);
 
+    /**
+     * @fn  static constexpr size_t Utils_String::Base64EncodeSize(size_t len, bool url = false)
+     *
+     * @brief   len 字节编码之后的字符数  标准 Base64 用 '=' 补齐到 4 的倍数, URL-safe 不补齐
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param   len The length
+     * @param   url (Optional) True 使用 URL-safe 字母表 ('-' '_')
+     *
+     * @return  编码之后的长度
+     */
+    static constexpr size_t Base64EncodeSize(size_t len, bool url = false)
+    {
+        return url ? (len * 4 + 2) / 3 : (len + 2) / 3 * 4;
+    }
+
+    /**
+     * @fn  static constexpr size_t Utils_String::Base64DecodeSize(size_t len)
+     *
+     * @brief   len 个字符解码之后的最大字节数  用于准备输出缓冲区
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param   len The length
+     *
+     * @return  解码长度的上界
+     */
+    static constexpr size_t Base64DecodeSize(size_t len)
+    {
+        return (len + 3) / 4 * 3;
+    }
+
+    /**
+     * @fn  static size_t Utils_String::Base64Encode(const void *src, size_t len, char *dst, bool url = false);
+     *
+     * @brief   Base64 编码写入调用者的缓冲区  不分配内存, 不写结尾的 '\0'
+     *          * 定义 __AVX2__ 时 (/arch:AVX2, -mavx2) 每次处理 24 字节, 否则逐 3 字节处理
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param           src Source data
+     * @param           len The length
+     * @param [in,out]  dst 至少 Base64EncodeSize(len, url) 字节
+     * @param           url (Optional) True 使用 URL-safe 字母表, 不补 '='
+     *
+     * @return  写入的字符数
+     */
+    static size_t Base64Encode(const void *src, size_t len, char *dst, bool url = false);
+
+    /**
+     * @fn  static bool Utils_String::Base64Decode(std::string_view src, void *dst, size_t *out_len, bool url = false);
+     *
+     * @brief   严格的 Base64 解码  不接受空白, 另一种字母表的字符, 错误位置的 '=', 末尾非零的填充位
+     *          * 标准模式长度必须是 4 的倍数, URL-safe 模式 '=' 可有可无
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param           src     Base64 字符串
+     * @param [in,out]  dst     至少 Base64DecodeSize(src.size()) 字节
+     * @param [in,out]  out_len 解码得到的字节数, 可以为 nullptr
+     * @param           url     (Optional) True 使用 URL-safe 字母表
+     *
+     * @return  True if it succeeds, false 输入不合法 (dst 内容不确定)
+     */
+    static bool Base64Decode(std::string_view src, void *dst, size_t *out_len, bool url = false);
+
+    /**
+     * @fn  static std::string Utils_String::Base64Encode(std::string_view src, bool url = false);
+     *
+     * @brief   Base64 编码 返回字符串
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param   src Source data
+     * @param   url (Optional) True 使用 URL-safe 字母表
+     *
+     * @return  编码结果
+     */
+    static std::string Base64Encode(std::string_view src, bool url = false);
+
+    /**
+     * @fn  static bool Utils_String::Base64Decode(std::string_view src, std::string &dst, bool url = false);
+     *
+     * @brief   Base64 解码到 dst  失败时 dst 清空
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param           src Base64 字符串
+     * @param [in,out]  dst Destination
+     * @param           url (Optional) True 使用 URL-safe 字母表
+     *
+     * @return  True if it succeeds, false if it fails
+     */
+    static bool Base64Decode(std::string_view src, std::string &dst, bool url = false);
+
 /**
  * @def Utils_String::CharArr2String
  *
@@ -650,6 +945,128 @@ class Utils_String
      */
     static std::string StringLowwer(const std::string &str);
 
+    /**
+     * @fn  static void Utils_String::StringUpperInPlace(std::string &str);
+     *
+     * @brief   原地转换成大写 只处理 ASCII 字符, 不分配内存 SSE2 一次处理 16 字节
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param [in,out]  str The string
+     */
+    static void StringUpperInPlace(std::string &str);
+
+    /**
+     * @fn  static void Utils_String::StringLowwerInPlace(std::string &str);
+     *
+     * @brief   原地转换成小写 只处理 ASCII 字符, 不分配内存 SSE2 一次处理 16 字节
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param [in,out]  str The string
+     */
+    static void StringLowwerInPlace(std::string &str);
+
+    /**
+     * @fn  static void Utils_String::StringUpper(const char *src, char *dst, size_t len);
+     *
+     * @brief   将 src 的 len 个字符转换成大写写入 dst, dst 至少 len 字节, 允许 src == dst
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param           src Source buffer
+     * @param [in,out]  dst Destination buffer
+     * @param           len The length
+     */
+    static void StringUpper(const char *src, char *dst, size_t len);
+
+    /**
+     * @fn  static void Utils_String::StringLowwer(const char *src, char *dst, size_t len);
+     *
+     * @brief   将 src 的 len 个字符转换成小写写入 dst, dst 至少 len 字节, 允许 src == dst
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param           src Source buffer
+     * @param [in,out]  dst Destination buffer
+     * @param           len The length
+     */
+    static void StringLowwer(const char *src, char *dst, size_t len);
+
+    /**
+     * @fn  static bool Utils_String::StringEqualNoCase(std::string_view a, std::string_view b);
+     *
+     * @brief   忽略 ASCII 大小写比较两个字符串是否相等, 不生成小写副本
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param   a   The first string
+     * @param   b   The second string
+     *
+     * @return  True if equal ignoring case, false if not
+     */
+    static bool StringEqualNoCase(std::string_view a, std::string_view b);
+
+    /**
+     * @fn  static bool Utils_String::StringStartsWithNoCase(std::string_view str, std::string_view prefix);
+     *
+     * @brief   忽略大小写判断 str 是否以 prefix 开头
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param   str     The string
+     * @param   prefix  The prefix
+     *
+     * @return  True if str starts with prefix, false if not
+     */
+    static bool StringStartsWithNoCase(std::string_view str, std::string_view prefix);
+
+    /**
+     * @fn  static size_t Utils_String::StringHashNoCase(std::string_view str);
+     *
+     * @brief   忽略大小写的哈希值, 与 StringEqualNoCase 一致, 每次处理 8 字节
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param   str The string
+     *
+     * @return  The hash value
+     */
+    static size_t StringHashNoCase(std::string_view str);
+
+    /**
+     * @struct  Utils_String::NoCaseHash
+     *
+     * @brief   unordered_map 使用的忽略大小写哈希  std::unordered_map<std::string, T, NoCaseHash, NoCaseEqual>
+     */
+    struct NoCaseHash
+    {
+        size_t operator()(std::string_view str) const
+        {
+            return StringHashNoCase(str);
+        }
+    };
+
+    /**
+     * @struct  Utils_String::NoCaseEqual
+     *
+     * @brief   unordered_map 使用的忽略大小写比较
+     */
+    struct NoCaseEqual
+    {
+        bool operator()(std::string_view a, std::string_view b) const
+        {
+            return StringEqualNoCase(a, b);
+        }
+    };
+
 
     /**
      * @fn  static uchar Utils_String::Commu_CheckXOR(const uchar* buffer, int len);
@@ -723,6 +1140,22 @@ class Utils_String
      */
     static uchar Commu_CheckSum(uchar *dat, int len = -1);
 
+    /**
+     * @fn  static unsigned short Utils_String::Commu_CheckCRC16(const uchar *dat, int len);
+     *
+     * @brief   CRC16 校验 Modbus 多项式 0xA001 初值 0xFFFF, 查表计算
+     *          * 串口帧中按 低字节在前 存放
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param   dat The dat
+     * @param   len The length
+     *
+     * @return  CRC16 值
+     */
+    static unsigned short Commu_CheckCRC16(const uchar *dat, int len);
+
 };
 
 #endif  //UTILS_STRING_H__
\ No newline at end of file
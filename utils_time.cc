@@ -11,6 +11,8 @@
 #include <time.h>
 #include "./utils.h"
 #include "./utils_time.h"
+#include "./utils_format.h"
+#include "./utils_builder.h"
 
 
 /**
@@ -38,10 +40,11 @@ float Utils_Time::CalcPeriodMs(int flg, std::string str)
     {
         // 计算得到的ms 值  生成 字符串输出
         time_ms = static_cast<float>(clock() - gTime_tmp)*1000.0f / CLOCKS_PER_SEC;
-        str = "Funciton [ " + str + " ] in " \
-            + __FILE__ + " - " + std::to_string(__LINE__) \
-            + ":  " + std::to_string(time_ms) + "ms";
-        LDebug(str);
+        Utils_StringBuilder<256> msg;
+        msg.Append("Funciton [ ").Append(str).Append(" ] in ")
+            .Append(__FILE__).Append(" - ").Append(__LINE__)
+            .Append(":  ").AppendFloat(time_ms, 6).Append("ms");
+        LDebug("{}", msg.c_str());
     }
     return time_ms;
 }
@@ -72,10 +75,11 @@ float Utils_Time::CalcPeriodFps(int flg /*= 0*/, std::string str /*= "funcPeroid
         // 计算得到的ms 值  生成 字符串输出
         time_fps = CLOCKS_PER_SEC / static_cast<float>(clock() - gFps_tmp);
         gFps_tmp = 0;
-        str = "Processs [ " + str + " ] in" \
-            + __FILE__ + std::to_string(__LINE__) \
-            + ":  " + std::to_string(time_fps) + "fps";
-        LDebug(str);
+        Utils_StringBuilder<256> msg;
+        msg.Append("Processs [ ").Append(str).Append(" ] in")
+            .Append(__FILE__).Append(__LINE__)
+            .Append(":  ").AppendFloat(time_fps, 6).Append("fps");
+        LDebug("{}", msg.c_str());
     }
     return time_fps;
 }
@@ -101,24 +105,23 @@ std::string Utils_Time::GetTime(char c, bool rand_flg)
     struct tm ltm;
     localtime_s(&ltm, &t);
 
-    std::string format_ = "%04d%02d%02d-%02d%02d";
-    char *buf = new char[20];
-    sprintf(buf, format_.c_str(), \
-            ltm.tm_year + 1900,
-            ltm.tm_mon + 1,
-            ltm.tm_mday,
-            ltm.tm_hour,
-            ltm.tm_min);
-
-    // 根据 buf 生成 字符串
-    std::string str =  std::string(buf);
+    // YYYYMMDD-HHMM 直接写到栈上缓冲区
+    char buf[32];
+    size_t n = 0;
+    n += Utils_Format::FormatInt(buf + n, sizeof(buf) - n, ltm.tm_year + 1900, 4);
+    n += Utils_Format::FormatInt(buf + n, sizeof(buf) - n, ltm.tm_mon + 1, 2);
+    n += Utils_Format::FormatInt(buf + n, sizeof(buf) - n, ltm.tm_mday, 2);
+    buf[n++] = '-';
+    n += Utils_Format::FormatInt(buf + n, sizeof(buf) - n, ltm.tm_hour, 2);
+    n += Utils_Format::FormatInt(buf + n, sizeof(buf) - n, ltm.tm_min, 2);
 
     // 如果随机 加入三位随机值
     if (rand_flg)
     {
-        str += c + std::to_string(rand() % 100);
+        buf[n++] = c;
+        n += Utils_Format::FormatInt(buf + n, sizeof(buf) - n, rand() % 100);
     }
-    return str;
+    return std::string(buf, n);
 }
 
 
@@ -137,18 +140,11 @@ std::string Utils_Time::GetDate(void)
     time_t t = time(nullptr);
     struct tm ltm;
     localtime_s(&ltm, &t);
-    std::string str = Utils_String::NumToString(1900 + ltm.tm_year, 4)
-        + Utils_String::NumToString(1 + ltm.tm_mon, 2)   // 设置月份
-        + Utils_String::NumToString(ltm.tm_mday, 2);
 
-    std::string format_ = "%04d%02d%02d";
-    char *buf = new char[20];
-    sprintf(buf, format_.c_str(), \
-            ltm.tm_year + 1900,
-            ltm.tm_mon + 1,
-            ltm.tm_mday);
-    // 根据 buf 生成 字符串
-    std::string str = std::string(buf);
-    return str;
+    char buf[16];
+    size_t n = 0;
+    n += Utils_Format::FormatInt(buf + n, sizeof(buf) - n, ltm.tm_year + 1900, 4);
+    n += Utils_Format::FormatInt(buf + n, sizeof(buf) - n, ltm.tm_mon + 1, 2);   // 设置月份
+    n += Utils_Format::FormatInt(buf + n, sizeof(buf) - n, ltm.tm_mday, 2);
+    return std::string(buf, n);
 }
-
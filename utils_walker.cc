@@ -0,0 +1,454 @@
+/**
+ * @file    Code\utils\utils_walker.cc.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   多线程目录遍历的实现
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#include "./utils_walker.h"
+#include "./utils_glob.h"
+#include "./utils_path.h"
+
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+#endif
+
+#ifdef _WIN32
+static constexpr char kSep = '\\';
+#else
+static constexpr char kSep = '/';
+#endif
+
+namespace
+{
+
+struct DirTask
+{
+    std::string path;
+    int depth;      ///< 目录中的项的深度
+};
+
+// 每个线程一个队列  自己从尾部取, 窃取从头部取
+struct alignas(64) WorkQueue
+{
+    std::mutex mutex;
+    std::deque<DirTask> tasks;
+};
+
+struct WalkState
+{
+    const Utils_Walker::Options *opt;
+    Utils_Walker::EntryFn fn;
+    void *ctx;
+    std::unique_ptr<WorkQueue[]> queues;
+    int workers;
+    std::atomic<size_t> pending{ 0 };   ///< 在队列中 和 正在读取的目录数
+    std::atomic<size_t> reported{ 0 };
+    std::atomic<bool> stop{ false };
+    std::mutex visited_mutex;
+    std::set<std::pair<uint64_t, uint64_t>> visited;   ///< 跟随符号链接时 已进入的目录 (设备号, inode)
+};
+
+bool FirstVisit(WalkState &st, uint64_t dev, uint64_t ino)
+{
+    std::lock_guard<std::mutex> lock(st.visited_mutex);
+    return st.visited.emplace(dev, ino).second;
+}
+
+void PushDir(WalkState &st, int worker, std::string path, int depth)
+{
+    st.pending.fetch_add(1, std::memory_order_relaxed);
+    WorkQueue &q = st.queues[worker];
+    std::lock_guard<std::mutex> lock(q.mutex);
+    q.tasks.push_back({ std::move(path), depth });
+}
+
+bool PopDir(WalkState &st, int worker, DirTask &task)
+{
+    WorkQueue &own = st.queues[worker];
+    {
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty())
+        {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            return true;
+        }
+    }
+    // 窃取 从下一个线程开始轮询, 取最早放入的目录 (靠近根, 子树较大)
+    for (int k = 1; k < st.workers; k++)
+    {
+        WorkQueue &q = st.queues[(worker + k) % st.workers];
+        std::lock_guard<std::mutex> lock(q.mutex);
+        if (!q.tasks.empty())
+        {
+            task = std::move(q.tasks.front());
+            q.tasks.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @fn  void OnEntry(WalkState &st, int worker, std::string &path, size_t base, std::string_view name, Utils_WalkEntry::Type type, int depth, bool descend)
+ *
+ * @brief   处理一个目录项  path[0, base) 为所在目录 (含结尾分隔符), 追加 name 之后回调, 返回前截断
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ *
+ * @param           st      遍历状态
+ * @param           worker  线程序号
+ * @param [in,out]  path    路径缓冲区
+ * @param           base    目录部分长度
+ * @param           name    文件名
+ * @param           type    类型 跟随的符号链接为目标的类型
+ * @param           depth   深度
+ * @param           descend 目录是否进入 (跟随链接时已访问过的目录为 false)
+ */
+void OnEntry(WalkState &st, int worker, std::string &path, size_t base, std::string_view name,
+             Utils_WalkEntry::Type type, int depth, bool descend)
+{
+    const Utils_Walker::Options &opt = *st.opt;
+    if (opt.skip_hidden && name[0] == '.')
+        return;
+    path.resize(base);
+    path.append(name.data(), name.size());
+
+    if (type == Utils_WalkEntry::kDir)
+    {
+        if (descend && (opt.max_depth < 0 || depth < opt.max_depth))
+            PushDir(st, worker, path, depth + 1);
+        if (!opt.report_dirs)
+            return;
+    }
+    else
+    {
+        if (opt.filter != nullptr && !opt.filter->Match(name))
+            return;
+        if (!opt.extensions.empty() && !Utils_Path::HasExtension(name, opt.extensions))
+            return;
+    }
+
+    Utils_WalkEntry e;
+    e.path = std::string_view(path);
+    e.name = e.path.substr(base);
+    e.type = type;
+    e.depth = depth;
+    st.reported.fetch_add(1, std::memory_order_relaxed);
+    if (!st.fn(st.ctx, e, worker))
+        st.stop.store(true, std::memory_order_relaxed);
+}
+
+#ifdef _WIN32
+
+// 打开目录读取 卷序列号 + 文件索引, 作为符号链接去重的标识
+bool DirId(const std::string &path, uint64_t &dev, uint64_t &ino)
+{
+    HANDLE h = CreateFileA(path.c_str(), 0, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+                           OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS, nullptr);
+    if (h == INVALID_HANDLE_VALUE)
+        return false;
+    BY_HANDLE_FILE_INFORMATION info;
+    BOOL ok = GetFileInformationByHandle(h, &info);
+    CloseHandle(h);
+    if (!ok)
+        return false;
+    dev = info.dwVolumeSerialNumber;
+    ino = (static_cast<uint64_t>(info.nFileIndexHigh) << 32) | info.nFileIndexLow;
+    return true;
+}
+
+void ScanDir(WalkState &st, int worker, const DirTask &task, std::string &path)
+{
+    path = task.path;
+    if (path.empty() || (path.back() != '\\' && path.back() != '/'))
+        path += kSep;
+    const size_t base = path.size();
+    path += '*';
+
+    WIN32_FIND_DATAA fd;
+    HANDLE h = FindFirstFileExA(path.c_str(), FindExInfoBasic, &fd, FindExSearchNameMatch, nullptr,
+                                FIND_FIRST_EX_LARGE_FETCH);
+    if (h == INVALID_HANDLE_VALUE)
+        return;
+    do
+    {
+        const char *name = fd.cFileName;
+        if (name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0')))
+            continue;
+        const bool is_dir = (fd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+        const bool is_link = (fd.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT) != 0 &&
+            (fd.dwReserved0 == IO_REPARSE_TAG_SYMLINK || fd.dwReserved0 == IO_REPARSE_TAG_MOUNT_POINT);
+        Utils_WalkEntry::Type type = is_dir ? Utils_WalkEntry::kDir : Utils_WalkEntry::kFile;
+        bool descend = true;
+        if (is_link)
+        {
+            if (!st.opt->follow_symlinks)
+            {
+                type = Utils_WalkEntry::kSymlink;
+            }
+            else if (is_dir)
+            {
+                uint64_t dev = 0, ino = 0;
+                path.resize(base);
+                path += name;
+                descend = DirId(path, dev, ino) && FirstVisit(st, dev, ino);
+            }
+        }
+        OnEntry(st, worker, path, base, name, type, task.depth, descend);
+    }
+    while (!st.stop.load(std::memory_order_relaxed) && FindNextFileA(h, &fd));
+    FindClose(h);
+}
+
+bool RootId(const std::string &root, uint64_t &dev, uint64_t &ino)
+{
+    return DirId(root, dev, ino);
+}
+
+#else
+
+// 根据 stat 结果得到类型
+Utils_WalkEntry::Type ModeType(mode_t mode)
+{
+    if (S_ISREG(mode))
+        return Utils_WalkEntry::kFile;
+    if (S_ISDIR(mode))
+        return Utils_WalkEntry::kDir;
+    if (S_ISLNK(mode))
+        return Utils_WalkEntry::kSymlink;
+    return Utils_WalkEntry::kOther;
+}
+
+/**
+ * @fn  void HandleDirent(WalkState &st, int worker, int dirfd, const DirTask &task, std::string &path, size_t base, const char *name, unsigned char d_type)
+ *
+ * @brief   d_type 已知且不是需要跟随的链接时 不调用 stat; 否则 fstatat 相对目录句柄, 不重新解析整个路径
+ */
+void HandleDirent(WalkState &st, int worker, int dirfd, const DirTask &task, std::string &path, size_t base,
+                  const char *name, unsigned char d_type)
+{
+    if (name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0')))
+        return;
+
+    Utils_WalkEntry::Type type;
+    switch (d_type)
+    {
+        case DT_REG:
+            type = Utils_WalkEntry::kFile;
+            break;
+        case DT_DIR:
+            type = Utils_WalkEntry::kDir;
+            break;
+        case DT_LNK:
+            type = Utils_WalkEntry::kSymlink;
+            break;
+        case DT_UNKNOWN:
+        {
+            struct stat sb;
+            if (fstatat(dirfd, name, &sb, AT_SYMLINK_NOFOLLOW) != 0)
+                return;
+            type = ModeType(sb.st_mode);
+            break;
+        }
+        default:
+            type = Utils_WalkEntry::kOther;
+            break;
+    }
+
+    bool descend = true;
+    if (type == Utils_WalkEntry::kSymlink && st.opt->follow_symlinks)
+    {
+        struct stat sb;
+        if (fstatat(dirfd, name, &sb, 0) != 0)
+            return;     // 断开的链接
+        type = ModeType(sb.st_mode);
+        if (type == Utils_WalkEntry::kDir)
+            descend = FirstVisit(st, static_cast<uint64_t>(sb.st_dev), static_cast<uint64_t>(sb.st_ino));
+    }
+    else if (type == Utils_WalkEntry::kDir && st.opt->follow_symlinks)
+    {
+        // 跟随链接时 普通目录也要记录, 否则链接回到祖先目录时会重复遍历
+        struct stat sb;
+        if (fstatat(dirfd, name, &sb, AT_SYMLINK_NOFOLLOW) == 0)
+            descend = FirstVisit(st, static_cast<uint64_t>(sb.st_dev), static_cast<uint64_t>(sb.st_ino));
+    }
+    OnEntry(st, worker, path, base, name, type, task.depth, descend);
+}
+
+#if defined(__linux__)
+struct LinuxDirent64
+{
+    uint64_t d_ino;
+    int64_t d_off;
+    unsigned short d_reclen;
+    unsigned char d_type;
+    char d_name[1];
+};
+#endif
+
+void ScanDir(WalkState &st, int worker, const DirTask &task, std::string &path)
+{
+    int fd = open(task.path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd < 0)
+        return;
+    path = task.path;
+    if (path.empty() || path.back() != '/')
+        path += kSep;
+    const size_t base = path.size();
+
+#if defined(__linux__)
+    // getdents64 一次读取一批目录项, 比 readdir 少一层拷贝和加锁
+    alignas(8) char buf[32 * 1024];
+    for (;;)
+    {
+        long n = syscall(SYS_getdents64, fd, buf, sizeof(buf));
+        if (n <= 0)
+            break;
+        for (long off = 0; off < n;)
+        {
+            const LinuxDirent64 *d = reinterpret_cast<const LinuxDirent64 *>(buf + off);
+            off += d->d_reclen;
+            HandleDirent(st, worker, fd, task, path, base, d->d_name, d->d_type);
+            if (st.stop.load(std::memory_order_relaxed))
+                break;
+        }
+        if (st.stop.load(std::memory_order_relaxed))
+            break;
+    }
+    close(fd);
+#else
+    DIR *dir = fdopendir(fd);
+    if (dir == nullptr)
+    {
+        close(fd);
+        return;
+    }
+    for (struct dirent *d = readdir(dir); d != nullptr && !st.stop.load(std::memory_order_relaxed); d = readdir(dir))
+        HandleDirent(st, worker, fd, task, path, base, d->d_name, d->d_type);
+    closedir(dir);
+#endif
+}
+
+bool RootId(const std::string &root, uint64_t &dev, uint64_t &ino)
+{
+    struct stat sb;
+    if (stat(root.c_str(), &sb) != 0)
+        return false;
+    dev = static_cast<uint64_t>(sb.st_dev);
+    ino = static_cast<uint64_t>(sb.st_ino);
+    return true;
+}
+
+#endif
+
+void WorkerLoop(WalkState &st, int worker)
+{
+    std::string path;
+    path.reserve(512);
+    DirTask task;
+    int idle = 0;
+    while (!st.stop.load(std::memory_order_relaxed))
+    {
+        if (PopDir(st, worker, task))
+        {
+            ScanDir(st, worker, task, path);
+            st.pending.fetch_sub(1, std::memory_order_acq_rel);
+            idle = 0;
+            continue;
+        }
+        if (st.pending.load(std::memory_order_acquire) == 0)
+            break;
+        // 其他线程正在读取目录 稍后会有新的子目录
+        if (++idle < 64)
+            std::this_thread::yield();
+        else
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+}
+
+}  // namespace
+
+int Utils_Walker::WorkerCount(const Options & opt)
+{
+    int n = opt.threads > 0 ? opt.threads : static_cast<int>(std::thread::hardware_concurrency());
+    return n > 0 ? n : 1;
+}
+
+size_t Utils_Walker::Walk(const std::string & root, const Options & opt, EntryFn fn, void * ctx)
+{
+    if (root.empty() || fn == nullptr)
+        return 0;
+
+    WalkState st;
+    st.opt = &opt;
+    st.fn = fn;
+    st.ctx = ctx;
+    st.workers = WorkerCount(opt);
+    st.queues.reset(new WorkQueue[static_cast<size_t>(st.workers)]);
+    if (opt.follow_symlinks)
+    {
+        uint64_t dev = 0, ino = 0;
+        if (RootId(root, dev, ino))
+            FirstVisit(st, dev, ino);
+    }
+
+    PushDir(st, 0, root, 0);
+    std::vector<std::thread> threads;
+    for (int w = 1; w < st.workers; w++)
+        threads.emplace_back(WorkerLoop, std::ref(st), w);
+    WorkerLoop(st, 0);
+    for (std::thread &t : threads)
+        t.join();
+    return st.reported.load();
+}
+
+size_t Utils_Walker::Walk(const std::string & root, const Options & opt, Utils_BoundedChannel<std::string>& out)
+{
+    size_t n = Walk(root, opt, [&out](const Utils_WalkEntry &e) { return out.Push(std::string(e.path)); });
+    out.Close();
+    return n;
+}
+
+std::vector<std::string> Utils_Walker::List(const std::string & root, const Options & opt)
+{
+    // 每个线程单独的结果 最后合并, 回调中不加锁
+    std::vector<std::vector<std::string>> parts(static_cast<size_t>(WorkerCount(opt)));
+    Walk(root, opt, [&parts](const Utils_WalkEntry &e, int worker) { parts[worker].emplace_back(e.path); });
+
+    std::vector<std::string> res;
+    size_t total = 0;
+    for (const auto &p : parts)
+        total += p.size();
+    res.reserve(total);
+    for (auto &p : parts)
+        std::move(p.begin(), p.end(), std::back_inserter(res));
+    std::sort(res.begin(), res.end());
+    return res;
+}
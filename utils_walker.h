@@ -0,0 +1,141 @@
+/**
+ * @file    Code\utils\utils_walker.h.
+ * @copyright   Copyright (c) 2019 IRIS_Chen IRIS Lab
+ *
+ * @brief   多线程递归遍历目录  代替 _findfirst 递归的 ListAllFiles
+ *          * Linux 使用 open + getdents64 批量读取目录项, d_type 已知时不调用 stat, 未知时 fstatat 相对目录句柄
+ *          * Windows 使用 FindFirstFileEx (FindExInfoBasic + LARGE_FETCH), 其他 POSIX 系统使用 readdir
+ *          * 每个线程一个目录队列, 自己从尾部取 (深度优先, 路径前缀在缓存中), 空闲时从其他线程头部窃取
+ *          * 结果通过回调或 Utils_BoundedChannel 流式输出, 不需要等全部遍历完
+ * @changelog   2026/10/19    IRIS_Chen Created.
+ */
+
+#pragma once
+#ifndef UTILS_WALKER_H_
+#define UTILS_WALKER_H_
+
+#include <stdint.h>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "./utils_concurrent.h"
+#include "./utils_detail.h"
+
+class Utils_Glob;
+
+/**
+ * @struct  Utils_WalkEntry
+ *
+ * @brief   遍历到的一项  path 和 name 只在回调期间有效
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+struct Utils_WalkEntry
+{
+    enum Type : uint8_t
+    {
+        kFile,
+        kDir,
+        kSymlink,   ///< 不跟随符号链接时的链接本身
+        kOther,     ///< 设备 管道 套接字等
+    };
+
+    std::string_view path;  ///< 完整路径 根目录 + 分隔符 + ... + name
+    std::string_view name;  ///< 文件名
+    Type type;
+    int depth;              ///< 根目录下的直接子项为 0
+};
+
+/**
+ * @class   Utils_Walker utils_walker.h Code\utils\utils_walker.h
+ *
+ * @brief   目录遍历  输出顺序不确定, 需要固定顺序时对结果排序
+ *          *   Utils_Walker::Options opt;
+ *          *   opt.extensions = { ".jpg", ".png" };
+ *          *   Utils_Walker::Walk("/data/archive", opt, [&](const Utils_WalkEntry &e, int worker) { ... });
+ *
+ * @author  IRIS_Chen
+ * @date    2026/10/19
+ */
+class Utils_Walker
+{
+    public:
+
+    /**
+     * @struct  Options
+     *
+     * @brief   遍历选项  过滤条件只作用于文件, 目录总是进入 (受 max_depth 限制)
+     */
+    struct Options
+    {
+        int threads = 0;                        ///< 线程数 小于等于 0 时使用 CPU 核数
+        int max_depth = -1;                     ///< 最大深度 0 只列出根目录下的项, 小于 0 不限制
+        bool follow_symlinks = false;           ///< 跟随符号链接, 已访问的目录 (设备号 + inode) 不重复进入
+        bool report_dirs = false;               ///< 目录也作为结果输出
+        bool skip_hidden = false;               ///< 跳过 '.' 开头的文件和目录
+        const Utils_Glob *filter = nullptr;     ///< 文件名通配符, 调用期间需要有效
+        std::vector<std::string> extensions;    ///< 扩展名 ".jpg" 或 "jpg", 忽略大小写, 为空时不过滤
+    };
+
+    /**
+     * @brief   回调  返回 false 停止遍历; 多个线程同时调用, worker 为线程序号 [0, WorkerCount)
+     */
+    typedef bool (*EntryFn)(void *ctx, const Utils_WalkEntry &entry, int worker);
+
+    /**
+     * @fn  static size_t Utils_Walker::Walk(const std::string &root, const Options &opt, EntryFn fn, void *ctx);
+     *
+     * @brief   遍历 root 下的所有项  调用线程作为 0 号线程参与遍历, 返回时所有线程已结束
+     *
+     * @author  IRIS_Chen
+     * @date    2026/10/19
+     *
+     * @param           root    根目录
+     * @param           opt     选项
+     * @param           fn      回调
+     * @param [in,out]  ctx     回调上下文
+     *
+     * @return  回调的次数
+     */
+    static size_t Walk(const std::string &root, const Options &opt, EntryFn fn, void *ctx);
+
+    /**
+     * @fn  template<typename Fn> static size_t Utils_Walker::Walk(const std::string &root, const Options &opt, Fn &&fn)
+     *
+     * @brief   fn(const Utils_WalkEntry &, int worker) 或 fn(const Utils_WalkEntry &), 返回 void 或 bool, 需要线程安全
+     */
+    template<typename Fn>
+    static size_t Walk(const std::string &root, const Options &opt, Fn &&fn)
+    {
+        return Walk(root, opt, &Utils_Detail::Invoke<std::remove_reference_t<Fn>, const Utils_WalkEntry &>, const_cast<void *>(static_cast<const void *>(&fn)));
+    }
+
+    /**
+     * @fn  static size_t Utils_Walker::Walk(const std::string &root, const Options &opt, Utils_BoundedChannel<std::string> &out);
+     *
+     * @brief   完整路径写入通道, 遍历结束后关闭通道  通道满时遍历线程等待 (背压)
+     *          * 在生产者线程中调用, 消费者 Pop 直到返回 false; 消费者提前 Close 时遍历停止
+     *
+     * @return  写入的个数
+     */
+    static size_t Walk(const std::string &root, const Options &opt, Utils_BoundedChannel<std::string> &out);
+
+    /**
+     * @fn  static std::vector<std::string> Utils_Walker::List(const std::string &root, const Options &opt);
+     *
+     * @brief   收集全部路径并排序
+     */
+    static std::vector<std::string> List(const std::string &root, const Options &opt);
+
+    /**
+     * @fn  static int Utils_Walker::WorkerCount(const Options &opt);
+     *
+     * @brief   实际使用的线程数  用于按 worker 分配结果缓冲区
+     */
+    static int WorkerCount(const Options &opt);
+};
+
+#endif  // UTILS_WALKER_H_